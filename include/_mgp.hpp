@@ -357,6 +357,49 @@ inline mgp_vertex *vertices_iterator_next(mgp_vertices_iterator *it) {
   return MgInvoke<mgp_vertex *>(mgp_vertices_iterator_next, it);
 }
 
+inline size_t vertices_iterator_next_batch(mgp_vertices_iterator *it, mgp_vertex_batch *batch) {
+  return MgInvoke<size_t>(mgp_vertices_iterator_next_batch, it, batch);
+}
+
+// mgp_graph_csr
+
+inline mgp_graph_csr *graph_export_csr(mgp_graph *graph, const char *weight_property, mgp_memory *memory) {
+  return MgInvoke<mgp_graph_csr *>(mgp_graph_export_csr, graph, weight_property, memory);
+}
+
+inline mgp_graph_csr *graph_project_csr(mgp_graph *graph, const char *const *labels, size_t labels_count,
+                                        const char *const *edge_types, size_t edge_types_count,
+                                        const char *weight_property, mgp_memory *memory) {
+  return MgInvoke<mgp_graph_csr *>(mgp_graph_project_csr, graph, labels, labels_count, edge_types, edge_types_count,
+                                   weight_property, memory);
+}
+
+inline void graph_csr_destroy(mgp_graph_csr *csr) { mgp_graph_csr_destroy(csr); }
+
+inline size_t graph_csr_vertex_count(mgp_graph_csr *csr) { return MgInvoke<size_t>(mgp_graph_csr_vertex_count, csr); }
+
+inline size_t graph_csr_edge_count(mgp_graph_csr *csr) { return MgInvoke<size_t>(mgp_graph_csr_edge_count, csr); }
+
+inline const int64_t *graph_csr_vertex_ids(mgp_graph_csr *csr) {
+  return MgInvoke<const int64_t *>(mgp_graph_csr_vertex_ids, csr);
+}
+
+inline const size_t *graph_csr_offsets(mgp_graph_csr *csr) {
+  return MgInvoke<const size_t *>(mgp_graph_csr_offsets, csr);
+}
+
+inline const size_t *graph_csr_targets(mgp_graph_csr *csr) {
+  return MgInvoke<const size_t *>(mgp_graph_csr_targets, csr);
+}
+
+inline const int64_t *graph_csr_edge_ids(mgp_graph_csr *csr) {
+  return MgInvoke<const int64_t *>(mgp_graph_csr_edge_ids, csr);
+}
+
+inline const double *graph_csr_weights(mgp_graph_csr *csr) {
+  return MgInvoke<const double *>(mgp_graph_csr_weights, csr);
+}
+
 // mgp_edges_iterator
 
 inline void edges_iterator_destroy(mgp_edges_iterator *it) { mgp_edges_iterator_destroy(it); }
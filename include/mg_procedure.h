@@ -1374,6 +1374,107 @@ enum mgp_error mgp_duration_sub(struct mgp_duration *first, struct mgp_duration
 enum mgp_error mgp_vertices_iterator_next(struct mgp_vertices_iterator *it, struct mgp_vertex **result);
 ///@}
 
+/// @name Batched Graph Access
+///
+/// The following functions copy graph data directly into caller-provided
+/// columnar buffers, without creating a mgp_vertex or a mgp_value for every
+/// element. They are meant for analytics procedures which need to read the
+/// whole graph into their own data structures.
+///@{
+
+/// Columnar buffers filled by mgp_vertices_iterator_next_batch.
+/// All buffers are owned by the caller. `ids` must have room for `capacity`
+/// elements. `has_labels` must have room for `labels_count * capacity`
+/// elements, while `property_values` and `property_present` must each have
+/// room for `properties_count * capacity` elements. Per-label and
+/// per-property buffers are laid out column by column, i.e. the value for
+/// the i-th vertex and the j-th property is at index `j * capacity + i`.
+struct mgp_vertex_batch {
+  size_t capacity;
+  int64_t *ids;
+  size_t labels_count;
+  const char *const *label_names;
+  int *has_labels;
+  size_t properties_count;
+  const char *const *property_names;
+  double *property_values;
+  int *property_present;
+};
+
+/// Read up to `batch->capacity` vertices, starting with the vertex returned
+/// by mgp_vertices_iterator_get, into the buffers of `batch`.
+/// Only integer and double properties are exported, converted to double.
+/// For any other (or missing) property value `property_present` is set to 0
+/// and `property_values` to 0.0.
+/// After the call the iterator points to the first vertex which wasn't read,
+/// so batched and regular iteration may be mixed. Any mgp_vertex previously
+/// obtained from the iterator is invalidated.
+/// Result is the number of vertices written, 0 if the end of the iteration
+/// has been reached.
+/// Return mgp_error::MGP_ERROR_INVALID_ARGUMENT if `capacity` is 0 or a
+/// required buffer is NULL.
+/// Return mgp_error::MGP_ERROR_DELETED_OBJECT if a vertex has been deleted.
+enum mgp_error mgp_vertices_iterator_next_batch(struct mgp_vertices_iterator *it, struct mgp_vertex_batch *batch,
+                                                size_t *result);
+
+/// Adjacency of a graph in compressed sparse row (CSR) form.
+/// Vertices are numbered densely from 0 in iteration order. Outgoing edges
+/// of the i-th vertex are stored in the range [offsets[i], offsets[i + 1])
+/// of the edge arrays.
+struct mgp_graph_csr;
+
+/// Export the outgoing adjacency of the graph in CSR form.
+/// If `weight_property` is not NULL, the numeric value of that edge property
+/// is exported as an edge weight; edges without a numeric value get the
+/// weight 1.0.
+/// Resulting mgp_graph_csr must be freed with mgp_graph_csr_destroy.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_graph_csr.
+/// Return mgp_error::MGP_ERROR_DELETED_OBJECT if a vertex has been deleted.
+enum mgp_error mgp_graph_export_csr(struct mgp_graph *graph, const char *weight_property, struct mgp_memory *memory,
+                                    struct mgp_graph_csr **result);
+
+/// Export the outgoing adjacency of a part of the graph in CSR form.
+/// Only vertices with at least one of the `labels_count` labels, and only
+/// edges of one of the `edge_types_count` types between such vertices are
+/// exported; passing 0 as a count disables that filter. `weight_property` is
+/// handled the same as in mgp_graph_export_csr.
+/// The same projection may be shared by procedures running against the same
+/// state of the graph, so repeated calls don't have to rebuild it.
+/// Resulting mgp_graph_csr must be freed with mgp_graph_csr_destroy.
+/// Return mgp_error::MGP_ERROR_INVALID_ARGUMENT if a non-zero count is given without names.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_graph_csr.
+/// Return mgp_error::MGP_ERROR_DELETED_OBJECT if a vertex has been deleted.
+enum mgp_error mgp_graph_project_csr(struct mgp_graph *graph, const char *const *labels, size_t labels_count,
+                                     const char *const *edge_types, size_t edge_types_count,
+                                     const char *weight_property, struct mgp_memory *memory,
+                                     struct mgp_graph_csr **result);
+
+/// Free the memory used by a mgp_graph_csr.
+void mgp_graph_csr_destroy(struct mgp_graph_csr *csr);
+
+/// Get the number of vertices in the CSR.
+enum mgp_error mgp_graph_csr_vertex_count(struct mgp_graph_csr *csr, size_t *result);
+
+/// Get the number of edges in the CSR.
+enum mgp_error mgp_graph_csr_edge_count(struct mgp_graph_csr *csr, size_t *result);
+
+/// Get the array of `vertex_count` vertex IDs, indexed by the dense vertex index.
+enum mgp_error mgp_graph_csr_vertex_ids(struct mgp_graph_csr *csr, const int64_t **result);
+
+/// Get the array of `vertex_count + 1` offsets into the edge arrays.
+enum mgp_error mgp_graph_csr_offsets(struct mgp_graph_csr *csr, const size_t **result);
+
+/// Get the array of `edge_count` dense indices of edge destination vertices.
+enum mgp_error mgp_graph_csr_targets(struct mgp_graph_csr *csr, const size_t **result);
+
+/// Get the array of `edge_count` edge IDs.
+enum mgp_error mgp_graph_csr_edge_ids(struct mgp_graph_csr *csr, const int64_t **result);
+
+/// Get the array of `edge_count` edge weights.
+/// Result is NULL if the CSR was exported without a weight property.
+enum mgp_error mgp_graph_csr_weights(struct mgp_graph_csr *csr, const double **result);
+///@}
+
 /// @name Type System
 ///
 /// The following structures and functions are used to build a type
@@ -98,6 +98,8 @@ class Nodes;
 using GraphNodes = Nodes;
 class GraphRelationships;
 class Relationships;
+class NodeBatchReader;
+class GraphCsr;
 class Node;
 class Relationship;
 struct MapItem;
@@ -212,6 +214,23 @@ class Graph {
   /// @brief Returns the graph node with the given ID.
   Node GetNodeById(Id node_id) const;
 
+  /// @brief Returns a reader which copies graph nodes into columnar buffers, `batch_size` nodes at a time.
+  /// @param labels labels whose presence is read for every node
+  /// @param properties numeric properties which are read for every node
+  NodeBatchReader ReadNodesBatched(size_t batch_size, std::vector<std::string> labels = {},
+                                   std::vector<std::string> properties = {}) const;
+
+  /// @brief Exports the graph's outgoing adjacency in compressed sparse row form.
+  /// @param weight_property numeric relationship property exported as weights; no weights are exported if empty
+  GraphCsr ExportCsr(std::string_view weight_property = {}) const;
+
+  /// @brief Exports the outgoing adjacency of the nodes with any of `labels` and of the relationships with any of
+  /// `types` in compressed sparse row form. Empty filters match everything. The projection may be shared with other
+  /// procedures that run against the same state of the graph.
+  /// @param weight_property numeric relationship property exported as weights; no weights are exported if empty
+  GraphCsr ProjectCsr(const std::vector<std::string> &labels, const std::vector<std::string> &types,
+                      std::string_view weight_property = {}) const;
+
   /// @brief Returns whether the graph contains a node with the given ID.
   bool ContainsNode(Id node_id) const;
   /// @brief Returns whether the graph contains the given node.
@@ -301,6 +320,82 @@ class Nodes {
   mgp_vertices_iterator *nodes_iterator_ = nullptr;
 };
 
+/// @brief Reads graph nodes into columnar buffers; wrapper for @ref mgp_vertices_iterator_next_batch.
+class NodeBatchReader {
+ public:
+  NodeBatchReader(mgp_graph *graph, size_t batch_size, std::vector<std::string> labels,
+                  std::vector<std::string> properties);
+
+  NodeBatchReader(const NodeBatchReader &) = delete;
+  NodeBatchReader &operator=(const NodeBatchReader &) = delete;
+  NodeBatchReader(NodeBatchReader &&other) noexcept;
+  NodeBatchReader &operator=(NodeBatchReader &&) = delete;
+
+  ~NodeBatchReader();
+
+  /// @brief Reads the next batch of nodes and returns its size; 0 means that all nodes have been read.
+  size_t Next();
+
+  /// @brief Returns the number of nodes in the current batch.
+  size_t Size() const;
+
+  /// @brief Returns the ID of the `row`-th node in the current batch.
+  int64_t NodeId(size_t row) const;
+
+  /// @brief Returns whether the `row`-th node in the current batch has the `label_index`-th requested label.
+  bool HasLabel(size_t label_index, size_t row) const;
+
+  /// @brief Returns the `property_index`-th requested property of the `row`-th node in the current batch, if it is
+  /// numeric.
+  std::optional<double> GetProperty(size_t property_index, size_t row) const;
+
+ private:
+  mgp_vertices_iterator *nodes_iterator_ = nullptr;
+  size_t size_ = 0;
+  std::vector<std::string> labels_;
+  std::vector<std::string> properties_;
+  std::vector<const char *> label_names_;
+  std::vector<const char *> property_names_;
+  std::vector<int64_t> ids_;
+  std::vector<int> has_labels_;
+  std::vector<double> property_values_;
+  std::vector<int> property_present_;
+  mgp_vertex_batch batch_{};
+};
+
+/// @brief Compressed sparse row view of the graph adjacency; wrapper class for @ref mgp_graph_csr.
+/// Nodes are numbered densely from 0; relationships of the i-th node span [Offsets()[i], Offsets()[i + 1]).
+class GraphCsr {
+ public:
+  explicit GraphCsr(mgp_graph_csr *csr);
+
+  GraphCsr(const GraphCsr &) = delete;
+  GraphCsr &operator=(const GraphCsr &) = delete;
+  GraphCsr(GraphCsr &&other) noexcept;
+  GraphCsr &operator=(GraphCsr &&other) noexcept;
+
+  ~GraphCsr();
+
+  /// @brief Returns the number of nodes.
+  size_t NodeCount() const;
+  /// @brief Returns the number of relationships.
+  size_t RelationshipCount() const;
+
+  /// @brief Returns the node IDs, indexed by the dense node index.
+  const int64_t *NodeIds() const;
+  /// @brief Returns the NodeCount() + 1 offsets into the relationship arrays.
+  const size_t *Offsets() const;
+  /// @brief Returns the dense indices of relationship destinations.
+  const size_t *Targets() const;
+  /// @brief Returns the relationship IDs.
+  const int64_t *RelationshipIds() const;
+  /// @brief Returns the relationship weights, or nullptr if the graph was exported without weights.
+  const double *Weights() const;
+
+ private:
+  mgp_graph_csr *csr_;
+};
+
 /// @brief View of graph relationships.
 // NB: Necessary because of the MGP API not having a method that returns a mgp_edges_iterator over all graph
 // relationships.
@@ -2038,6 +2133,37 @@ inline GraphNodes Graph::Nodes() const {
 
 inline GraphRelationships Graph::Relationships() const { return GraphRelationships(graph_); }
 
+inline NodeBatchReader Graph::ReadNodesBatched(size_t batch_size, std::vector<std::string> labels,
+                                               std::vector<std::string> properties) const {
+  return NodeBatchReader(graph_, batch_size, std::move(labels), std::move(properties));
+}
+
+inline GraphCsr Graph::ExportCsr(std::string_view weight_property) const {
+  const std::string weight_property_str(weight_property);
+  auto *csr = mgp::MemHandlerCallback(graph_export_csr, graph_,
+                                      weight_property_str.empty() ? nullptr : weight_property_str.c_str());
+  return GraphCsr(csr);
+}
+
+inline GraphCsr Graph::ProjectCsr(const std::vector<std::string> &labels, const std::vector<std::string> &types,
+                                  std::string_view weight_property) const {
+  std::vector<const char *> label_names;
+  label_names.reserve(labels.size());
+  for (const auto &label : labels) {
+    label_names.push_back(label.c_str());
+  }
+  std::vector<const char *> type_names;
+  type_names.reserve(types.size());
+  for (const auto &type : types) {
+    type_names.push_back(type.c_str());
+  }
+  const std::string weight_property_str(weight_property);
+  auto *csr = mgp::MemHandlerCallback(graph_project_csr, graph_, label_names.data(), label_names.size(),
+                                      type_names.data(), type_names.size(),
+                                      weight_property_str.empty() ? nullptr : weight_property_str.c_str());
+  return GraphCsr(csr);
+}
+
 inline Node Graph::GetNodeById(const Id node_id) const {
   auto *mgp_node = mgp::MemHandlerCallback(graph_get_vertex_by_id, graph_, mgp_vertex_id{.as_int = node_id.AsInt()});
   if (mgp_node == nullptr) {
@@ -2202,6 +2328,114 @@ inline Nodes::Iterator Nodes::cbegin() const { return Iterator(nodes_iterator_);
 
 inline Nodes::Iterator Nodes::cend() const { return Iterator(nullptr); }
 
+// NodeBatchReader:
+
+inline NodeBatchReader::NodeBatchReader(mgp_graph *graph, size_t batch_size, std::vector<std::string> labels,
+                                        std::vector<std::string> properties)
+    : nodes_iterator_(mgp::MemHandlerCallback(graph_iter_vertices, graph)),
+      labels_(std::move(labels)),
+      properties_(std::move(properties)),
+      ids_(batch_size),
+      has_labels_(labels_.size() * batch_size),
+      property_values_(properties_.size() * batch_size),
+      property_present_(properties_.size() * batch_size) {
+  for (const auto &label : labels_) {
+    label_names_.push_back(label.c_str());
+  }
+  for (const auto &property : properties_) {
+    property_names_.push_back(property.c_str());
+  }
+  batch_ = mgp_vertex_batch{.capacity = batch_size,
+                            .ids = ids_.data(),
+                            .labels_count = label_names_.size(),
+                            .label_names = label_names_.data(),
+                            .has_labels = has_labels_.data(),
+                            .properties_count = property_names_.size(),
+                            .property_names = property_names_.data(),
+                            .property_values = property_values_.data(),
+                            .property_present = property_present_.data()};
+}
+
+inline NodeBatchReader::NodeBatchReader(NodeBatchReader &&other) noexcept
+    : nodes_iterator_(other.nodes_iterator_),
+      size_(other.size_),
+      labels_(std::move(other.labels_)),
+      properties_(std::move(other.properties_)),
+      label_names_(std::move(other.label_names_)),
+      property_names_(std::move(other.property_names_)),
+      ids_(std::move(other.ids_)),
+      has_labels_(std::move(other.has_labels_)),
+      property_values_(std::move(other.property_values_)),
+      property_present_(std::move(other.property_present_)),
+      batch_(other.batch_) {
+  // Moved vectors keep their buffers, so the pointers in `batch_` remain valid.
+  other.nodes_iterator_ = nullptr;
+}
+
+inline NodeBatchReader::~NodeBatchReader() {
+  if (nodes_iterator_ != nullptr) {
+    mgp::vertices_iterator_destroy(nodes_iterator_);
+  }
+}
+
+inline size_t NodeBatchReader::Next() {
+  size_ = mgp::vertices_iterator_next_batch(nodes_iterator_, &batch_);
+  return size_;
+}
+
+inline size_t NodeBatchReader::Size() const { return size_; }
+
+inline int64_t NodeBatchReader::NodeId(size_t row) const { return ids_[row]; }
+
+inline bool NodeBatchReader::HasLabel(size_t label_index, size_t row) const {
+  return has_labels_[(label_index * batch_.capacity) + row] != 0;
+}
+
+inline std::optional<double> NodeBatchReader::GetProperty(size_t property_index, size_t row) const {
+  const auto index = (property_index * batch_.capacity) + row;
+  if (property_present_[index] == 0) {
+    return std::nullopt;
+  }
+  return property_values_[index];
+}
+
+// GraphCsr:
+
+inline GraphCsr::GraphCsr(mgp_graph_csr *csr) : csr_(csr) {}
+
+inline GraphCsr::GraphCsr(GraphCsr &&other) noexcept : csr_(other.csr_) { other.csr_ = nullptr; }
+
+inline GraphCsr &GraphCsr::operator=(GraphCsr &&other) noexcept {
+  if (this != &other) {
+    if (csr_ != nullptr) {
+      mgp::graph_csr_destroy(csr_);
+    }
+    csr_ = other.csr_;
+    other.csr_ = nullptr;
+  }
+  return *this;
+}
+
+inline GraphCsr::~GraphCsr() {
+  if (csr_ != nullptr) {
+    mgp::graph_csr_destroy(csr_);
+  }
+}
+
+inline size_t GraphCsr::NodeCount() const { return mgp::graph_csr_vertex_count(csr_); }
+
+inline size_t GraphCsr::RelationshipCount() const { return mgp::graph_csr_edge_count(csr_); }
+
+inline const int64_t *GraphCsr::NodeIds() const { return mgp::graph_csr_vertex_ids(csr_); }
+
+inline const size_t *GraphCsr::Offsets() const { return mgp::graph_csr_offsets(csr_); }
+
+inline const size_t *GraphCsr::Targets() const { return mgp::graph_csr_targets(csr_); }
+
+inline const int64_t *GraphCsr::RelationshipIds() const { return mgp::graph_csr_edge_ids(csr_); }
+
+inline const double *GraphCsr::Weights() const { return mgp::graph_csr_weights(csr_); }
+
 // GraphRelationships:
 
 inline GraphRelationships::GraphRelationships(mgp_graph *graph) : graph_(graph) {}
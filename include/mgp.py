@@ -1156,6 +1156,52 @@ class Vertices:
         return self._len
 
 
+class GraphCsr:
+    """
+    Compressed sparse row (CSR) projection of the graph's outgoing adjacency.
+
+    Projected vertices are numbered densely from 0. Edges of the i-th vertex
+    are stored between `offsets()[i]` and `offsets()[i + 1]` of the edge
+    lists. Access to a GraphCsr is only valid during a single execution of a
+    procedure in a query.
+    """
+
+    __slots__ = ("_csr",)
+
+    def __init__(self, csr):
+        if not isinstance(csr, _mgp.GraphCsr):
+            raise TypeError("Expected '_mgp.GraphCsr', got '{}'".format(type(csr)))
+        self._csr = csr
+
+    def vertex_count(self) -> int:
+        """Get the number of projected vertices."""
+        return self._csr.vertex_count()
+
+    def edge_count(self) -> int:
+        """Get the number of projected edges."""
+        return self._csr.edge_count()
+
+    def vertex_ids(self) -> typing.List[VertexId]:
+        """Get the vertex IDs, indexed by the dense vertex index."""
+        return self._csr.vertex_ids()
+
+    def offsets(self) -> typing.List[int]:
+        """Get the `vertex_count() + 1` offsets into the edge lists."""
+        return self._csr.offsets()
+
+    def targets(self) -> typing.List[int]:
+        """Get the dense indices of edge destinations."""
+        return self._csr.targets()
+
+    def edge_ids(self) -> typing.List[EdgeId]:
+        """Get the edge IDs."""
+        return self._csr.edge_ids()
+
+    def weights(self) -> typing.Optional[typing.List[float]]:
+        """Get the edge weights, or None if the graph was projected without a weight property."""
+        return self._csr.weights()
+
+
 class Graph:
     """State of the graph database in current ProcCtx."""
 
@@ -1241,6 +1287,37 @@ class Graph:
             raise InvalidContextError()
         return Vertices(self._graph)
 
+    def project_csr(
+        self,
+        labels: typing.Iterable[str] = (),
+        edge_types: typing.Iterable[str] = (),
+        weight_property: typing.Optional[str] = None,
+    ) -> GraphCsr:
+        """
+        Project the outgoing adjacency of the graph in compressed sparse row form.
+
+        The projection may be shared with other procedures running against
+        the same state of the graph, so it isn't rebuilt on every call.
+
+        Args:
+            labels: Only vertices with at least one of the labels are projected. All vertices are projected if empty.
+            edge_types: Only edges of one of the types are projected. All edges are projected if empty.
+            weight_property: Numeric edge property projected as edge weights.
+
+        Returns:
+            `GraphCsr` with the projected adjacency.
+
+        Raises:
+            InvalidContextError: If context is invalid.
+            UnableToAllocateError: If unable to allocate the projection.
+
+        Examples:
+            ```csr = graph.project_csr(labels=["Account"], edge_types=["TRANSFER"], weight_property="amount")```
+        """
+        if not self.is_valid():
+            raise InvalidContextError()
+        return GraphCsr(self._graph.project_csr(list(labels), list(edge_types), weight_property))
+
     def is_mutable(self) -> bool:
         """
         Check if the graph is mutable. Thus it can be used to modify vertices and edges.
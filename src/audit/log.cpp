@@ -8,132 +8,39 @@
 
 #include "audit/log.hpp"
 
-#include <sstream>
-
-#include <fmt/format.h>
-#include <json/json.hpp>
+#include <algorithm>
+#include <thread>
 #include <utility>
 
-#include "communication/bolt/v1/mg_types.hpp"
-#include "query/string_helpers.hpp"
+#include "audit/record.hpp"
 #include "utils/logging.hpp"
-#include "utils/string.hpp"
-#include "utils/temporal.hpp"
-
-#include <mutex>
 
 namespace memgraph::audit {
 
-// Helper function that converts a `communication::bolt::Value` to `nlohmann::json`.
-inline nlohmann::json BoltValueToJson(const communication::bolt::Value &value) {
-  nlohmann::json ret;
-  switch (value.type()) {
-    using enum memgraph::communication::bolt::Value::Type;
-    case Null:
-      break;
-    case Bool:
-      ret = value.ValueBool();
-      break;
-    case Int:
-      ret = value.ValueInt();
-      break;
-    case Double:
-      ret = value.ValueDouble();
-      break;
-    case String:
-      ret = value.ValueString();
-      break;
-    case List: {
-      ret = nlohmann::json::array();
-      for (const auto &item : value.ValueList()) {
-        ret.push_back(BoltValueToJson(item));
-      }
-      break;
-    }
-    case Map: {
-      auto const &bolt_value_map = value.ValueMap();
-      auto const info = memgraph::communication::bolt::BoltMapToMgTypeInfo(bolt_value_map);
-      if (info) {
-        switch (info->type) {
-          case communication::bolt::MgType::Enum: {
-            ret = info->value_str;
-            break;
-          }
-        }
-      } else {
-        ret = nlohmann::json::object();
-        for (const auto &[map_k, map_v] : bolt_value_map) {
-          ret.push_back(nlohmann::json::object_t::value_type(map_k, BoltValueToJson(map_v)));
-        }
-      }
-      break;
-    }
-    case Date: {
-      std::stringstream ss;
-      ss << utils::Date(value.ValueDate().MicrosecondsSinceEpoch());
-      ret = ss.str();
-      break;
-    }
-    case Duration: {
-      std::stringstream ss;
-      ss << utils::Duration(value.ValueDuration().microseconds);
-      ret = ss.str();
-      break;
-    }
-    case LocalTime: {
-      std::stringstream ss;
-      ss << utils::LocalTime(value.ValueLocalTime().MicrosecondsSinceEpoch());
-      ret = ss.str();
-      break;
-    }
-    case LocalDateTime: {
-      std::stringstream ss;
-      ss << value.ValueLocalDateTime();
-      ret = ss.str();
-      break;
-    }
-    case ZonedDateTime: {
-      const auto &temp_value = value.ValueZonedDateTime();
-      std::stringstream ss;
-      ss << utils::ZonedDateTime(temp_value.SysTimeSinceEpoch(), temp_value.GetTimezone());
-      ret = ss.str();
-      break;
-    }
-    case Point2d: {
-      std::stringstream ss;
-      ss << query::CypherConstructionFor(value.ValuePoint2d());
-      ret = ss.str();
-      break;
-    }
-    case Point3d: {
-      std::stringstream ss;
-      ss << query::CypherConstructionFor(value.ValuePoint3d());
-      ret = ss.str();
-      break;
-    }
-    case Vertex:
-    case Edge:
-    case UnboundedEdge:
-    case Path: {
-      // Should not be sent for audit
-      break;
-    }
-  }
-  return ret;
-}
+namespace {
+std::atomic<uint64_t> next_log_id{0};
+
+// Bounds of a single thread's buffer. Small enough that a pool of idle
+// threads doesn't hold on to much memory, large enough to absorb a burst
+// between two flushes.
+constexpr uint64_t kMinThreadBufferSize = 16;
+constexpr uint64_t kMaxThreadBufferSize = 4096;
+}  // namespace
 
-Log::Log(std::filesystem::path storage_directory, int32_t buffer_size, int32_t buffer_flush_interval_millis)
+Log::Log(std::filesystem::path storage_directory, int32_t buffer_size, int32_t buffer_flush_interval_millis,
+         Format format)
     : storage_directory_(std::move(storage_directory)),
-      buffer_size_(buffer_size),
+      thread_buffer_size_(ThreadBufferSize(buffer_size)),
       buffer_flush_interval_millis_(buffer_flush_interval_millis),
-      started_(false) {}
+      format_(format),
+      started_(false),
+      id_(next_log_id.fetch_add(1, std::memory_order_relaxed)) {}
 
 void Log::Start() {
   MG_ASSERT(!started_, "Trying to start an already started audit log!");
 
   utils::EnsureDirOrDie(storage_directory_);
 
-  buffer_.emplace(buffer_size_);
   started_ = true;
 
   ReopenLog();
@@ -141,13 +48,55 @@ void Log::Start() {
 }
 
 Log::~Log() {
-  if (!started_) return;
+  if (started_) {
+    started_ = false;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
 
-  started_ = false;
-  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    scheduler_.Stop();
+    Flush();
+  }
+
+  // Threads that are still alive free their buffers when they exit
+  auto *producer = producers_.load(std::memory_order_acquire);
+  while (producer) {
+    ProducerBuffer::Release(std::exchange(producer, producer->next));
+  }
+}
+
+uint64_t Log::ThreadBufferSize(int32_t buffer_size) {
+  const uint64_t threads = std::max(std::thread::hardware_concurrency(), 1U);
+  return std::clamp(static_cast<uint64_t>(std::max(buffer_size, 1)) / threads, kMinThreadBufferSize,
+                    kMaxThreadBufferSize);
+}
+
+Log::ProducerBuffer *Log::LocalBuffer() {
+  struct CachedBuffer {
+    CachedBuffer() = default;
+    CachedBuffer(const CachedBuffer &) = delete;
+    CachedBuffer &operator=(const CachedBuffer &) = delete;
+    ~CachedBuffer() { Reset(); }
 
-  scheduler_.Stop();
-  Flush();
+    void Reset() {
+      if (buffer) ProducerBuffer::Release(std::exchange(buffer, nullptr));
+    }
+
+    uint64_t log_id{0};
+    ProducerBuffer *buffer{nullptr};
+  };
+  thread_local CachedBuffer cached;
+  if (cached.buffer && cached.log_id == id_) return cached.buffer;
+  // The thread recorded into another log before
+  cached.Reset();
+
+  // First entry recorded by this thread, register a new buffer with the flusher.
+  auto *buffer = new ProducerBuffer(thread_buffer_size_);
+  buffer->next = producers_.load(std::memory_order_relaxed);
+  while (!producers_.compare_exchange_weak(buffer->next, buffer, std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+  }
+  cached.log_id = id_;
+  cached.buffer = buffer;
+  return buffer;
 }
 
 void Log::Record(const std::string &address, const std::string &username, const std::string &query,
@@ -156,31 +105,63 @@ void Log::Record(const std::string &address, const std::string &username, const
   auto timestamp =
       std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch())
           .count();
-  buffer_->emplace(Item{timestamp, address, username, query, params, db});
+  auto encode = [&](std::string *slot) { EncodeRecord(slot, timestamp, address, username, query, params, db); };
+  if (LocalBuffer()->TryPush(encode)) return;
+
+  std::string encoded;
+  encode(&encoded);
+  auto guard = std::lock_guard{overflow_lock_};
+  overflow_.push_back(std::move(encoded));
 }
 
 void Log::ReopenLog() {
   if (!started_.load(std::memory_order_relaxed)) return;
   auto guard = std::lock_guard{lock_};
   if (log_.IsOpen()) log_.Close();
-  log_.Open(storage_directory_ / "audit.log", utils::OutputFile::Mode::APPEND_TO_EXISTING);
+  log_.Open(storage_directory_ / (format_ == Format::BINARY ? "audit.bin" : "audit.log"),
+            utils::OutputFile::Mode::APPEND_TO_EXISTING);
 }
 
 void Log::Flush() {
   auto guard = std::lock_guard{lock_};
-  for (uint64_t i = 0; i < buffer_size_; ++i) {
-    auto item = buffer_->pop();
-    if (!item) break;
-
-    auto params_json = nlohmann::json::object();
-    for (const auto &[k, v] : item->params) {
-      params_json.push_back(nlohmann::json::object_t::value_type(k, BoltValueToJson(v)));
+  write_buffer_.clear();
+  auto append = [this](const std::string &encoded) {
+    if (format_ == Format::BINARY) {
+      write_buffer_.append(encoded);
+      return;
+    }
+    auto record = DecodeRecord(encoded);
+    MG_ASSERT(record, "Audit log record couldn't be decoded!");
+    AppendTextRecord(&write_buffer_, *record);
+  };
+
+  auto overflow_guard = std::unique_lock{overflow_lock_};
+  ProducerBuffer *previous = nullptr;
+  for (auto *producer = producers_.load(std::memory_order_acquire); producer;) {
+    // Checked before draining, so the last entries of an abandoned buffer are drained
+    const bool abandoned = producer->Abandoned();
+    producer->Drain(append);
+    auto *next = producer->next;
+    // The head can't be unlinked without racing the threads registering new buffers
+    if (abandoned && previous) {
+      previous->next = next;
+      ProducerBuffer::Release(producer);
+    } else {
+      previous = producer;
     }
+    producer = next;
+  }
 
-    log_.Write(fmt::format("{}.{:06d},{},{},{},{},{}\n", item->timestamp / 1000000, item->timestamp % 1000000,
-                           item->address, item->username, item->db, utils::Escape(item->query),
-                           utils::Escape(params_json.dump())));
+  // Overflowed entries follow the buffered ones they were recorded after
+  auto overflow = std::exchange(overflow_, {});
+  overflow_guard.unlock();
+  if (!overflow.empty()) {
+    spdlog::warn("Audit log buffer full, {} entries were queued under a lock. Consider increasing --audit-buffer-size.",
+                 overflow.size());
+    std::ranges::for_each(overflow, append);
   }
+  if (write_buffer_.empty()) return;
+  log_.Write(write_buffer_);
   log_.Sync();
 }
 
@@ -10,10 +10,12 @@
 
 #include <atomic>
 #include <filesystem>
-#include <optional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "communication/bolt/v1/value.hpp"
-#include "data_structures/ring_buffer.hpp"
 #include "utils/file.hpp"
 #include "utils/scheduler.hpp"
 
@@ -21,19 +23,24 @@ namespace memgraph::audit {
 
 /// This class implements an audit log. Functions used for logging are
 /// thread-safe, functions used for setup aren't thread-safe.
+///
+/// Every thread that records entries gets its own bounded single-producer
+/// buffer of binary encoded records, so recording doesn't take a lock. The
+/// buffer size is split between the threads, see `ThreadBufferSize`. If a
+/// thread's buffer is full the entry goes to a shared overflow queue under a
+/// lock instead, so no entry is ever lost. A scheduler thread drains all
+/// buffers and the overflow queue and writes them to the log file with a
+/// single write per flush. Buffers of threads that exited are freed once
+/// they're drained.
 class Log {
- private:
-  struct Item {
-    int64_t timestamp;
-    std::string address;
-    std::string username;
-    std::string query;
-    memgraph::communication::bolt::map_t params;
-    std::string db;
+ public:
+  enum class Format : uint8_t {
+    TEXT,    //!< `audit.log`, one CSV line with JSON parameters per entry
+    BINARY,  //!< `audit.bin`, length-prefixed records, see `audit/record.hpp`
   };
 
- public:
-  Log(std::filesystem::path storage_directory, int32_t buffer_size, int32_t buffer_flush_interval_millis);
+  Log(std::filesystem::path storage_directory, int32_t buffer_size, int32_t buffer_flush_interval_millis,
+      Format format = Format::TEXT);
 
   ~Log();
 
@@ -47,25 +54,96 @@ class Log {
   /// they won't do anything. Isn't thread-safe.
   void Start();
 
-  /// Adds an entry to the audit log. Thread-safe.
+  /// Adds an entry to the audit log. Thread-safe, only takes a lock when the
+  /// thread's buffer is full.
   void Record(const std::string &address, const std::string &username, const std::string &query,
               const memgraph::communication::bolt::map_t &params, const std::string &db);
 
   /// Reopens the log file. Used for log file rotation. Thread-safe.
   void ReopenLog();
 
+  /// Number of entries each recording thread can buffer, an equal share of
+  /// `buffer_size` for every hardware thread, within reasonable bounds.
+  static uint64_t ThreadBufferSize(int32_t buffer_size);
+
  private:
+  /// Single-producer single-consumer ring of encoded records. The owning
+  /// thread is the only producer and the flushing thread the only consumer.
+  /// Both the thread and the log hold a reference to it, the last one to
+  /// release it deletes it.
+  class ProducerBuffer {
+   public:
+    explicit ProducerBuffer(uint64_t capacity)
+        : capacity_(capacity), slots_(std::make_unique<std::string[]>(capacity)) {}
+
+    static void Release(ProducerBuffer *buffer) {
+      if (buffer->references_.fetch_sub(1, std::memory_order_acq_rel) == 1) delete buffer;
+    }
+
+    /// Whether the producing thread released the buffer, it only has to be
+    /// drained once more then. Only meaningful for the log's reference.
+    bool Abandoned() const { return references_.load(std::memory_order_acquire) == 1; }
+
+    template <typename TEncode>
+    bool TryPush(TEncode &&encode) {
+      const auto tail = tail_.load(std::memory_order_relaxed);
+      if (tail - head_.load(std::memory_order_acquire) == capacity_) return false;
+      auto &slot = slots_[tail % capacity_];
+      slot.clear();
+      encode(&slot);
+      tail_.store(tail + 1, std::memory_order_release);
+      return true;
+    }
+
+    template <typename TConsume>
+    void Drain(TConsume &&consume) {
+      const auto head = head_.load(std::memory_order_relaxed);
+      const auto tail = tail_.load(std::memory_order_acquire);
+      for (auto i = head; i != tail; ++i) {
+        auto &slot = slots_[i % capacity_];
+        consume(slot);
+        // Slots keep their capacity so steady-state recording doesn't allocate, but an occasional huge query
+        // shouldn't pin its memory forever.
+        if (slot.capacity() > kMaxRetainedSlotCapacity) std::string{}.swap(slot);
+      }
+      head_.store(tail, std::memory_order_release);
+    }
+
+    ProducerBuffer *next{nullptr};
+
+   private:
+    static constexpr uint64_t kMaxRetainedSlotCapacity = 4096;
+
+    const uint64_t capacity_;
+    std::unique_ptr<std::string[]> slots_;
+    alignas(64) std::atomic<uint64_t> head_{0};
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    std::atomic<uint32_t> references_{2};
+  };
+
+  ProducerBuffer *LocalBuffer();
+
   void Flush();
 
   std::filesystem::path storage_directory_;
-  int32_t buffer_size_;
+  uint64_t thread_buffer_size_;
   int32_t buffer_flush_interval_millis_;
+  Format format_;
   std::atomic<bool> started_;
 
-  std::optional<RingBuffer<Item>> buffer_;
+  // Used to tell apart a thread's cached buffer of this log from one of a destroyed log at the same address.
+  const uint64_t id_;
+  // Lock-free list of all producer buffers. Threads only push to its head, abandoned buffers behind the head are
+  // unlinked by the flush.
+  std::atomic<ProducerBuffer *> producers_{nullptr};
+  // Entries of threads whose buffer was full. The flush holds the lock while it drains the buffers, so an entry in
+  // the queue is never written before the entries its thread buffered earlier.
+  std::mutex overflow_lock_;
+  std::vector<std::string> overflow_;
   utils::Scheduler scheduler_;
 
   utils::OutputFile log_;
+  std::string write_buffer_;
   std::mutex lock_;
 };
 
@@ -0,0 +1,233 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Licensed as a Memgraph Enterprise file under the Memgraph Enterprise
+// License (the "License"); by using this file, you agree to be bound by the terms of the License, and you may not use
+// this file except in compliance with the License. You may obtain a copy of the License at https://memgraph.com/legal.
+//
+//
+
+#include "audit/record.hpp"
+
+#include <cstring>
+#include <sstream>
+
+#include <fmt/format.h>
+#include <json/json.hpp>
+
+#include "communication/bolt/v1/decoder/decoder.hpp"
+#include "communication/bolt/v1/encoder/base_encoder.hpp"
+#include "communication/bolt/v1/mg_types.hpp"
+#include "query/string_helpers.hpp"
+#include "utils/endian.hpp"
+#include "utils/string.hpp"
+#include "utils/temporal.hpp"
+
+namespace memgraph::audit {
+
+namespace {
+
+// Records are always encoded with the newest Bolt value layout, independently of the client's protocol version.
+constexpr int kBoltVersion = 5;
+
+class StringOutputBuffer {
+ public:
+  explicit StringOutputBuffer(std::string *out) : out_(out) {}
+
+  void Write(const uint8_t *data, uint64_t len) { out_->append(reinterpret_cast<const char *>(data), len); }
+
+ private:
+  std::string *out_;
+};
+
+class StringInputBuffer {
+ public:
+  explicit StringInputBuffer(std::string_view data) : data_(data) {}
+
+  bool Read(uint8_t *data, size_t len) {
+    if (len > data_.size()) return false;
+    std::memcpy(data, data_.data(), len);
+    data_.remove_prefix(len);
+    return true;
+  }
+
+  bool Empty() const { return data_.empty(); }
+
+ private:
+  std::string_view data_;
+};
+
+void WriteStringView(communication::bolt::BaseEncoder<StringOutputBuffer> &encoder, std::string_view value) {
+  encoder.WriteTypeSize(value.size(), communication::bolt::MarkerString);
+  encoder.WriteRAW(value.data(), value.size());
+}
+
+bool ReadString(communication::bolt::Decoder<StringInputBuffer> &decoder, std::string *out) {
+  communication::bolt::Value value;
+  if (!decoder.ReadValue(&value, communication::bolt::Value::Type::String)) return false;
+  *out = std::move(value.ValueString());
+  return true;
+}
+
+// Helper function that converts a `communication::bolt::Value` to `nlohmann::json`.
+nlohmann::json BoltValueToJson(const communication::bolt::Value &value) {
+  nlohmann::json ret;
+  switch (value.type()) {
+    using enum memgraph::communication::bolt::Value::Type;
+    case Null:
+      break;
+    case Bool:
+      ret = value.ValueBool();
+      break;
+    case Int:
+      ret = value.ValueInt();
+      break;
+    case Double:
+      ret = value.ValueDouble();
+      break;
+    case String:
+      ret = value.ValueString();
+      break;
+    case List: {
+      ret = nlohmann::json::array();
+      for (const auto &item : value.ValueList()) {
+        ret.push_back(BoltValueToJson(item));
+      }
+      break;
+    }
+    case Map: {
+      auto const &bolt_value_map = value.ValueMap();
+      auto const info = memgraph::communication::bolt::BoltMapToMgTypeInfo(bolt_value_map);
+      if (info) {
+        switch (info->type) {
+          case communication::bolt::MgType::Enum: {
+            ret = info->value_str;
+            break;
+          }
+        }
+      } else {
+        ret = nlohmann::json::object();
+        for (const auto &[map_k, map_v] : bolt_value_map) {
+          ret.push_back(nlohmann::json::object_t::value_type(map_k, BoltValueToJson(map_v)));
+        }
+      }
+      break;
+    }
+    case Date: {
+      std::stringstream ss;
+      ss << utils::Date(value.ValueDate().MicrosecondsSinceEpoch());
+      ret = ss.str();
+      break;
+    }
+    case Duration: {
+      std::stringstream ss;
+      ss << utils::Duration(value.ValueDuration().microseconds);
+      ret = ss.str();
+      break;
+    }
+    case LocalTime: {
+      std::stringstream ss;
+      ss << utils::LocalTime(value.ValueLocalTime().MicrosecondsSinceEpoch());
+      ret = ss.str();
+      break;
+    }
+    case LocalDateTime: {
+      std::stringstream ss;
+      ss << value.ValueLocalDateTime();
+      ret = ss.str();
+      break;
+    }
+    case ZonedDateTime: {
+      const auto &temp_value = value.ValueZonedDateTime();
+      std::stringstream ss;
+      ss << utils::ZonedDateTime(temp_value.SysTimeSinceEpoch(), temp_value.GetTimezone());
+      ret = ss.str();
+      break;
+    }
+    case Point2d: {
+      std::stringstream ss;
+      ss << query::CypherConstructionFor(value.ValuePoint2d());
+      ret = ss.str();
+      break;
+    }
+    case Point3d: {
+      std::stringstream ss;
+      ss << query::CypherConstructionFor(value.ValuePoint3d());
+      ret = ss.str();
+      break;
+    }
+    case Vertex:
+    case Edge:
+    case UnboundedEdge:
+    case Path: {
+      // Should not be sent for audit
+      break;
+    }
+  }
+  return ret;
+}
+
+}  // namespace
+
+void EncodeRecord(std::string *out, int64_t timestamp, std::string_view address, std::string_view username,
+                  std::string_view query, const communication::bolt::map_t &params, std::string_view db) {
+  const auto begin = out->size();
+  out->resize(begin + kRecordSizePrefix);
+
+  StringOutputBuffer buffer(out);
+  communication::bolt::BaseEncoder<StringOutputBuffer> encoder(buffer);
+  encoder.UpdateVersion(kBoltVersion);
+  encoder.WriteInt(timestamp);
+  WriteStringView(encoder, address);
+  WriteStringView(encoder, username);
+  WriteStringView(encoder, query);
+  encoder.WriteMap(params);
+  WriteStringView(encoder, db);
+
+  const auto size = utils::HostToLittleEndian(static_cast<uint32_t>(out->size() - begin - kRecordSizePrefix));
+  std::memcpy(out->data() + begin, &size, kRecordSizePrefix);
+}
+
+std::optional<uint64_t> NextRecordSize(std::string_view data) {
+  if (data.size() < kRecordSizePrefix) return std::nullopt;
+  uint32_t size{0};
+  std::memcpy(&size, data.data(), kRecordSizePrefix);
+  const uint64_t total = kRecordSizePrefix + utils::LittleEndianToHost(size);
+  if (data.size() < total) return std::nullopt;
+  return total;
+}
+
+std::optional<Record> DecodeRecord(std::string_view data) {
+  const auto size = NextRecordSize(data);
+  if (!size || *size != data.size()) return std::nullopt;
+  data.remove_prefix(kRecordSizePrefix);
+
+  StringInputBuffer buffer(data);
+  communication::bolt::Decoder<StringInputBuffer> decoder(buffer);
+  decoder.UpdateVersion(kBoltVersion);
+
+  Record record;
+  communication::bolt::Value value;
+  if (!decoder.ReadValue(&value, communication::bolt::Value::Type::Int)) return std::nullopt;
+  record.timestamp = value.ValueInt();
+  if (!ReadString(decoder, &record.address)) return std::nullopt;
+  if (!ReadString(decoder, &record.username)) return std::nullopt;
+  if (!ReadString(decoder, &record.query)) return std::nullopt;
+  if (!decoder.ReadValue(&value, communication::bolt::Value::Type::Map)) return std::nullopt;
+  record.params = std::move(value.ValueMap());
+  if (!ReadString(decoder, &record.db)) return std::nullopt;
+  if (!buffer.Empty()) return std::nullopt;
+  return record;
+}
+
+void AppendTextRecord(std::string *out, const Record &record) {
+  auto params_json = nlohmann::json::object();
+  for (const auto &[k, v] : record.params) {
+    params_json.push_back(nlohmann::json::object_t::value_type(k, BoltValueToJson(v)));
+  }
+
+  fmt::format_to(std::back_inserter(*out), "{}.{:06d},{},{},{},{},{}\n", record.timestamp / 1000000,
+                 record.timestamp % 1000000, record.address, record.username, record.db, utils::Escape(record.query),
+                 utils::Escape(params_json.dump()));
+}
+
+}  // namespace memgraph::audit
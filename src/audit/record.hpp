@@ -0,0 +1,52 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Licensed as a Memgraph Enterprise file under the Memgraph Enterprise
+// License (the "License"); by using this file, you agree to be bound by the terms of the License, and you may not use
+// this file except in compliance with the License. You may obtain a copy of the License at https://memgraph.com/legal.
+//
+//
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "communication/bolt/v1/value.hpp"
+
+namespace memgraph::audit {
+
+/// A single audit log entry.
+struct Record {
+  int64_t timestamp;
+  std::string address;
+  std::string username;
+  std::string query;
+  communication::bolt::map_t params;
+  std::string db;
+};
+
+/// Size of the little-endian length prefix that precedes every binary record.
+inline constexpr uint64_t kRecordSizePrefix = sizeof(uint32_t);
+
+/// Appends the binary representation of a record to `out`. The record is
+/// framed with a `kRecordSizePrefix` byte length followed by the Bolt
+/// (PackStream) encoding of its fields, so encoding doesn't allocate anything
+/// except the output itself.
+void EncodeRecord(std::string *out, int64_t timestamp, std::string_view address, std::string_view username,
+                  std::string_view query, const communication::bolt::map_t &params, std::string_view db);
+
+/// Returns the size of the first binary record in `data` (including its
+/// length prefix) or `std::nullopt` if `data` doesn't hold a whole record.
+std::optional<uint64_t> NextRecordSize(std::string_view data);
+
+/// Decodes a single binary record (including its length prefix). Returns
+/// `std::nullopt` if the record is malformed.
+std::optional<Record> DecodeRecord(std::string_view data);
+
+/// Appends the text (CSV line with JSON parameters) representation of a record
+/// to `out`. This is the format of the text audit log.
+void AppendTextRecord(std::string *out, const Record &record);
+
+}  // namespace memgraph::audit
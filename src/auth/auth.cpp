@@ -400,11 +400,16 @@ void Auth::LinkUser(User &user) const {
 
 std::optional<User> Auth::GetUser(const std::string &username_orig) const {
   auto username = utils::ToLowerCase(username_orig);
+  {
+    auto cache = user_cache_.Lock();
+    if (auto it = cache->find(username); it != cache->end()) return it->second;
+  }
+
   auto existing_user = storage_.Get(kUserPrefix + username);
   if (!existing_user) return std::nullopt;
-
   auto user = User::Deserialize(ParseJson(*existing_user));
   LinkUser(user);
+  user_cache_.WithLock([&](auto &cache) { CacheEntry(cache, std::move(username), user); });
   return user;
 }
 
@@ -548,10 +553,16 @@ bool Auth::AccessControlled() const { return HasUsers() || UsingAuthModule(); }
 
 std::optional<Role> Auth::GetRole(const std::string &rolename_orig) const {
   auto rolename = utils::ToLowerCase(rolename_orig);
+  {
+    auto cache = role_cache_.Lock();
+    if (auto it = cache->find(rolename); it != cache->end()) return it->second;
+  }
+
   auto existing_role = storage_.Get(kRolePrefix + rolename);
   if (!existing_role) return std::nullopt;
-
-  return Role::Deserialize(ParseJson(*existing_role));
+  auto role = Role::Deserialize(ParseJson(*existing_role));
+  role_cache_.WithLock([&](auto &cache) { CacheEntry(cache, std::move(rolename), role); });
+  return role;
 }
 
 void Auth::SaveRole(const Role &role, system::Transaction *system_tx) {
@@ -11,6 +11,7 @@
 #include <mutex>
 #include <optional>
 #include <regex>
+#include <unordered_map>
 #include <vector>
 
 #include "auth/exceptions.hpp"
@@ -401,7 +402,13 @@ class Auth final {
    */
   bool NameRegexMatch(const std::string &user_or_role) const;
 
-  void UpdateEpoch() { ++epoch_; }
+  // Every durable change to users, roles or links goes through here (locally and on replicas applying system
+  // deltas), so this is also where the deserialized user/role cache gets invalidated.
+  void UpdateEpoch() {
+    ++epoch_;
+    user_cache_->clear();
+    role_cache_->clear();
+  }
 
   /**
    * Returns whether the prerequisites for authentication aided by external module are met:
@@ -439,5 +446,20 @@ class Auth final {
   std::unordered_map<std::string, auth::Module> modules_;
   Config config_;
   Epoch epoch_{kStartEpoch};
+
+  // Deserialized users (already linked to their role) and roles, keyed by the lowercase name. Only existing users and
+  // roles are cached, so looking up arbitrary names doesn't grow the caches. Const getters may run concurrently under
+  // the SynchedAuth read lock, hence the extra lock here.
+  mutable utils::Synchronized<std::unordered_map<std::string, User>, std::mutex> user_cache_;
+  mutable utils::Synchronized<std::unordered_map<std::string, Role>, std::mutex> role_cache_;
+
+  // A full cache starts over, it's only there to avoid parsing the same users and roles over and over
+  static constexpr size_t kMaxCachedEntries = 1024;
+
+  template <typename T>
+  static void CacheEntry(std::unordered_map<std::string, T> &cache, std::string name, const T &value) {
+    if (cache.size() >= kMaxCachedEntries) cache.clear();
+    cache.insert_or_assign(std::move(name), value);
+  }
 };
 }  // namespace memgraph::auth
@@ -23,6 +23,12 @@ inline constexpr size_t kChunkHeaderSize = 2;
 inline constexpr size_t kChunkMaxDataSize = 65535;
 inline constexpr size_t kChunkWholeSize = kChunkHeaderSize + kChunkMaxDataSize;
 
+/**
+ * Number of bytes of finished chunks, headers included, that the encoder
+ * buffer coalesces before writing them to the output stream in a single call.
+ */
+inline constexpr size_t kChunkCoalesceSize = kChunkWholeSize;
+
 /**
  * Handshake size defined in the Bolt protocol.
  */
@@ -40,8 +40,12 @@ namespace memgraph::communication::bolt {
  * can control when the message is over and the whole message isn't
  * unnecessarily buffered in memory.
  *
- * The current implementation stores only a single chunk into memory and sends
- * it immediately to the output stream when new data arrives.
+ * The current implementation stores a single chunk into memory. Finished
+ * chunks that are flushed with `have_more` set are coalesced into a pending
+ * buffer which is sent to the output stream once it grows over
+ * `kChunkCoalesceSize` or once a chunk is flushed without `have_more`. That
+ * way a stream of small messages (e.g. Record messages) is sent using a
+ * single write instead of two writes per message.
  *
  * @tparam TOutputStream the output stream that should be used
  */
@@ -93,17 +97,31 @@ class ChunkedEncoderBuffer {
     // Write the size of the chunk.
     chunk_[0] = have_ >> 8;
     chunk_[1] = have_ & 0xFF;
-
-    // Write the data to the stream.
-    auto ret = output_stream_.Write(chunk_.data(), kChunkHeaderSize + have_, have_more);
+    const size_t size = kChunkHeaderSize + have_;
 
     // Cleanup.
     Clear();
 
+    // Nothing is waiting to be sent, so avoid copying the chunk if it has to
+    // be sent right away.
+    if (pending_.empty() && (!have_more || size >= kChunkCoalesceSize)) {
+      return output_stream_.Write(chunk_.data(), size, have_more);
+    }
+
+    pending_.insert(pending_.end(), chunk_.begin(), chunk_.begin() + size);
+    if (have_more && pending_.size() < kChunkCoalesceSize) return true;
+
+    // Write the coalesced chunks to the stream.
+    auto ret = output_stream_.Write(pending_.data(), pending_.size(), have_more);
+    pending_.clear();
+
     return ret;
   }
 
-  /** Clears the internal buffers. */
+  /**
+   * Clears the data in the current chunk. Finished chunks that are waiting to
+   * be coalesced are kept and sent with the next flush.
+   */
   void Clear() { have_ = 0; }
 
   /**
@@ -122,5 +140,8 @@ class ChunkedEncoderBuffer {
 
   // Amount of data in chunk array.
   size_t have_{0};
+
+  // Finished chunks waiting to be written to the output stream.
+  std::vector<uint8_t> pending_;
 };
 }  // namespace memgraph::communication::bolt
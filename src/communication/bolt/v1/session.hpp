@@ -116,6 +116,18 @@ class Session {
    */
   virtual map_t Discard(std::optional<int> n, std::optional<int> qid) = 0;
 
+  /**
+   * Prepare the next results of a partially pulled query while the client is
+   * busy with the results it has already received. Called after the summary
+   * is sent, so it must not throw; errors are reported by the next `Pull`.
+   *
+   * @param n If set, defines amount of rows the client pulls at once,
+   * otherwise there is nothing to prefetch.
+   * @param q If set, defines from which query to prefetch the results,
+   * otherwise the last query is used.
+   */
+  virtual void Prefetch(std::optional<int> n, std::optional<int> qid) noexcept {}
+
   virtual void BeginTransaction(const map_t &params) = 0;
   virtual void CommitTransaction() = 0;
   virtual void RollbackTransaction() = 0;
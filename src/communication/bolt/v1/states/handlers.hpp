@@ -110,6 +110,12 @@ State HandlePullDiscard(TSession &session, std::optional<int> n, std::optional<i
     }
 
     if (summary.contains("has_more") && summary.at("has_more").ValueBool()) {
+      if constexpr (is_pull) {
+        // The summary is already sent, so use the time until the client asks
+        // for more results to prepare them. Prefetch doesn't throw, its
+        // errors are reported by the next PULL.
+        session.Prefetch(n, qid);
+      }
       return State::Result;
     }
 
@@ -19,12 +19,16 @@
 #include "storage/v2/durability/snapshot.hpp"
 #include "storage/v2/durability/version.hpp"
 #include "storage/v2/indices/label_index_stats.hpp"
+#include "storage/v2/inmemory/replication/streamed_snapshot_load.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "storage/v2/inmemory/unique_constraints.hpp"
 #include "storage/v2/schema_info.hpp"
+#include "utils/file.hpp"
 
 #include <spdlog/spdlog.h>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 #include <optional>
 
 using memgraph::replication_coordination_glue::ReplicationRole;
@@ -54,6 +58,42 @@ std::pair<uint64_t, WalDeltaData> ReadDelta(storage::durability::BaseDecoder *de
   }
 };
 
+std::filesystem::path StagingDirectory(const storage::InMemoryStorage *storage) {
+  return storage->config_.durability.storage_directory / storage::durability::kReplicationStagingDirectory;
+}
+
+// Files are staged separately for each main. Another main can send different
+// files under the same names, so it can't resume what the previous one staged.
+std::filesystem::path StagingDirectory(const storage::InMemoryStorage *storage, const utils::UUID &main_uuid) {
+  return StagingDirectory(storage) / std::string{main_uuid};
+}
+
+// Appends the staged end of a snapshot to its staged beginning
+bool AppendStagedTail(const std::filesystem::path &path, const std::filesystem::path &tail_path,
+                      uint64_t tail_offset) {
+  utils::InputFile tail;
+  if (!tail.Open(tail_path)) return false;
+  utils::OutputFile file;
+  file.Open(path, utils::OutputFile::Mode::APPEND_TO_EXISTING);
+  uint8_t buffer[utils::kFileBufferSize];
+  auto remaining = tail.GetSize();
+  while (remaining > 0) {
+    const auto size = std::min(remaining, utils::kFileBufferSize);
+    if (!tail.Read(buffer, size)) {
+      file.Close();
+      std::error_code error_code;  // For exception suppression.
+      std::filesystem::resize_file(path, tail_offset, error_code);
+      if (error_code) utils::DeleteFile(path);
+      return false;
+    }
+    file.Write(buffer, size);
+    remaining -= size;
+  }
+  file.Sync();
+  file.Close();
+  return true;
+}
+
 std::optional<DatabaseAccess> GetDatabaseAccessor(dbms::DbmsHandler *dbms_handler, const utils::UUID &uuid) {
   try {
 #ifdef MG_ENTERPRISE
@@ -130,6 +170,11 @@ void InMemoryReplicationHandlers::Register(dbms::DbmsHandler *dbms_handler, repl
         spdlog::debug("Received ForceResetStorageRpc");
         InMemoryReplicationHandlers::ForceResetStorageHandler(dbms_handler, data.uuid_, req_reader, res_builder);
       });
+  server.rpc_server_.Register<storage::replication::FileChunkRpc>(
+      [&data, dbms_handler](auto *req_reader, auto *res_builder) {
+        spdlog::debug("Received FileChunkRpc");
+        InMemoryReplicationHandlers::FileChunkHandler(dbms_handler, data.uuid_, req_reader, res_builder);
+      });
 }
 
 void InMemoryReplicationHandlers::SwapMainUUIDHandler(dbms::DbmsHandler *dbms_handler,
@@ -265,50 +310,41 @@ void InMemoryReplicationHandlers::SnapshotHandler(dbms::DbmsHandler *dbms_handle
     return;
   }
 
-  storage::replication::Decoder decoder(req_reader);
-
   auto *storage = static_cast<storage::InMemoryStorage *>(db_acc->get()->storage());
+  storage::replication::Decoder decoder(req_reader, StagingDirectory(storage, req.main_uuid));
   utils::EnsureDirOrDie(storage->recovery_.snapshot_directory_);
 
+  // The snapshot might already be loaded from when it was being received
+  auto streamed_load = TakeStreamedSnapshotLoad(storage);
+  auto staged = streamed_load ? streamed_load->Finish() : nullptr;
+
   const auto maybe_snapshot_path = decoder.ReadFile(storage->recovery_.snapshot_directory_);
-  MG_ASSERT(maybe_snapshot_path, "Failed to load snapshot!");
+  if (!maybe_snapshot_path) {
+    // Main stages the missing parts again when it retries the recovery
+    spdlog::error("Failed to receive the snapshot, the recovery will be retried");
+    const storage::replication::SnapshotRes res{false, storage->repl_storage_state_.last_durable_timestamp_.load()};
+    slk::Save(res, res_builder);
+    return;
+  }
   spdlog::info("Received snapshot saved to {}", *maybe_snapshot_path);
-
-  auto storage_guard = std::unique_lock{storage->main_lock_};
-  spdlog::trace("Clearing database since recovering from snapshot.");
-
-  // Clear the database
-  storage->Clear();
+  // The staged end of the snapshot isn't read by anything anymore
+  utils::DeleteFile(storage::replication::StagedFilePath(
+      StagingDirectory(storage, req.main_uuid),
+      maybe_snapshot_path->filename().generic_string() + std::string{storage::replication::kStagedTailSuffix}));
 
   try {
-    spdlog::debug("Loading snapshot");
-    auto recovered_snapshot = storage::durability::LoadSnapshot(
-        *maybe_snapshot_path, &storage->vertices_, &storage->edges_, &storage->edges_metadata_,
-        &storage->repl_storage_state_.history, storage->name_id_mapper_.get(), &storage->edge_count_, storage->config_,
-        &storage->enum_store_,
-        storage->config_.salient.items.enable_schema_info ? &storage->schema_info_.Get() : nullptr);
-    spdlog::debug("Snapshot loaded successfully");
-    // If this step is present it should always be the first step of
-    // the recovery so we use the UUID we read from snasphost
-    storage->uuid().set(recovered_snapshot.snapshot_info.uuid);
-    storage->repl_storage_state_.epoch_.SetEpoch(std::move(recovered_snapshot.snapshot_info.epoch_id));
-    const auto &recovery_info = recovered_snapshot.recovery_info;
-    storage->vertex_id_ = recovery_info.next_vertex_id;
-    storage->edge_id_ = recovery_info.next_edge_id;
-    storage->timestamp_ = std::max(storage->timestamp_, recovery_info.next_timestamp);
-    storage->repl_storage_state_.last_durable_timestamp_ = recovery_info.next_timestamp - 1;
-
-    spdlog::trace("Recovering indices and constraints from snapshot.");
-    memgraph::storage::durability::RecoverIndicesAndStats(
-        recovered_snapshot.indices_constraints.indices, &storage->indices_, &storage->vertices_,
-        storage->name_id_mapper_.get(), storage->config_.salient.items.properties_on_edges);
-    memgraph::storage::durability::RecoverConstraints(recovered_snapshot.indices_constraints.constraints,
-                                                      &storage->constraints_, &storage->vertices_,
-                                                      storage->name_id_mapper_.get());
+    auto storage_guard = std::unique_lock{storage->main_lock_};
+    if (staged && streamed_load->Filename() == maybe_snapshot_path->filename().generic_string()) {
+      spdlog::debug("Snapshot was loaded while it was being received");
+      InstallSnapshot(storage, std::move(staged));
+    } else {
+      // Nothing is staged next to the storage, so its contents aren't held twice
+      staged.reset();
+      LoadSnapshot(storage, *maybe_snapshot_path);
+    }
   } catch (const storage::durability::RecoveryFailure &e) {
     LOG_FATAL("Couldn't load the snapshot because of: {}", e.what());
   }
-  storage_guard.unlock();
 
   const storage::replication::SnapshotRes res{true, storage->repl_storage_state_.last_durable_timestamp_.load()};
   slk::Save(res, res_builder);
@@ -335,6 +371,9 @@ void InMemoryReplicationHandlers::SnapshotHandler(dbms::DbmsHandler *dbms_handle
 
     storage->wal_file_.reset();
   }
+
+  // Partial transfers from before the snapshot won't be resumed anymore
+  utils::DeleteDir(StagingDirectory(storage));
   spdlog::debug("Replication recovery from snapshot finished!");
 }
 
@@ -360,6 +399,11 @@ void InMemoryReplicationHandlers::ForceResetStorageHandler(dbms::DbmsHandler *db
 
   auto *storage = static_cast<storage::InMemoryStorage *>(db_acc->get()->storage());
 
+  // A snapshot that's still being loaded would fill the storage again, and
+  // the partial transfers won't be resumed anymore
+  TakeStreamedSnapshotLoad(storage).reset();
+  utils::DeleteDir(StagingDirectory(storage));
+
   auto storage_guard = std::unique_lock{storage->main_lock_};
 
   // Clear the database
@@ -412,13 +456,21 @@ void InMemoryReplicationHandlers::WalFilesHandler(dbms::DbmsHandler *dbms_handle
   const auto wal_file_number = req.file_number;
   spdlog::debug("Received {} WAL files.", wal_file_number);
 
-  storage::replication::Decoder decoder(req_reader);
-
   auto *storage = static_cast<storage::InMemoryStorage *>(db_acc->get()->storage());
+  storage::replication::Decoder decoder(req_reader, StagingDirectory(storage, req.main_uuid));
   utils::EnsureDirOrDie(storage->recovery_.wal_directory_);
 
   for (auto i = 0; i < wal_file_number; ++i) {
-    LoadWal(storage, &decoder);
+    if (!LoadWal(storage, &decoder)) {
+      // The following WAL files can't be applied without the missing one
+      for (++i; i < wal_file_number; ++i) {
+        decoder.SkipFile();
+      }
+      const storage::replication::WalFilesRes res{false,
+                                                  storage->repl_storage_state_.last_durable_timestamp_.load()};
+      slk::Save(res, res_builder);
+      return;
+    }
   }
 
   const storage::replication::WalFilesRes res{true, storage->repl_storage_state_.last_durable_timestamp_.load()};
@@ -426,6 +478,87 @@ void InMemoryReplicationHandlers::WalFilesHandler(dbms::DbmsHandler *dbms_handle
   spdlog::debug("Replication recovery from WAL files ended successfully, replica is now up to date!");
 }
 
+void InMemoryReplicationHandlers::FileChunkHandler(dbms::DbmsHandler *dbms_handler,
+                                                   const std::optional<utils::UUID> &current_main_uuid,
+                                                   slk::Reader *req_reader, slk::Builder *res_builder) {
+  storage::replication::FileChunkReq req;
+  slk::Load(&req, req_reader);
+  auto db_acc = GetDatabaseAccessor(dbms_handler, req.uuid);
+  if (!db_acc) {
+    const storage::replication::FileChunkRes res{false, 0};
+    slk::Save(res, res_builder);
+    return;
+  }
+  if (!current_main_uuid.has_value() || req.main_uuid != current_main_uuid) [[unlikely]] {
+    LogWrongMain(current_main_uuid, req.main_uuid, storage::replication::FileChunkReq::kType.name);
+    const storage::replication::FileChunkRes res{false, 0};
+    slk::Save(res, res_builder);
+    return;
+  }
+
+  auto *storage = static_cast<storage::InMemoryStorage *>(db_acc->get()->storage());
+  const auto staging_directory = StagingDirectory(storage, req.main_uuid);
+  if (!utils::DirExists(staging_directory)) {
+    // Whatever another main staged won't be resumed anymore
+    utils::DeleteDir(StagingDirectory(storage));
+  }
+  utils::EnsureDirOrDie(staging_directory);
+  const auto path = storage::replication::StagedFilePath(staging_directory, req.filename);
+
+  // A staged file larger than the one being sent can't be a part of it
+  std::error_code error_code;  // For exception suppression.
+  if (std::filesystem::file_size(path, error_code) > req.file_size && !error_code) {
+    spdlog::trace("Discarding stale staged file {}", path);
+    utils::DeleteFile(path);
+  }
+
+  storage::replication::Decoder decoder(req_reader);
+  auto offset = decoder.ReadFileChunk(path, req.offset, req.size);
+  spdlog::trace("Staged {} of {} bytes of {}", offset, req.file_size, req.filename);
+
+  // The end of a snapshot is staged first, the rest of it is loaded while it's
+  // being received and completed with the end once it's all there
+  const auto tail_path = storage::replication::StagedFilePath(
+      staging_directory, req.filename + std::string{storage::replication::kStagedTailSuffix});
+  const auto tail_size = std::filesystem::file_size(tail_path, error_code);
+  if (!error_code && !req.filename.ends_with(storage::replication::kStagedTailSuffix) && tail_size < req.file_size) {
+    const auto tail_offset = req.file_size - tail_size;
+    if (offset == tail_offset && AppendStagedTail(path, tail_path, tail_offset)) offset = req.file_size;
+
+    // The beginning of the snapshot with the section offsets has to be there
+    // before the load starts
+    if (offset > 0 && storage->config_.durability.streamed_snapshot_load) {
+      const auto available = std::min(offset, tail_offset);
+      // Destroyed outside of the lock, destroying a load waits for its thread
+      std::unique_ptr<storage::StreamedSnapshotLoad> replaced;
+      storage->streamed_snapshot_load_.WithLock([&](auto &load) {
+        if (load && load->Filename() == req.filename && !load->Failed()) {
+          load->Advance(available);
+          return;
+        }
+        replaced = std::move(load);
+        // The load doesn't hold on to the database, the storage stops it before
+        // it's destroyed
+        load = std::make_unique<storage::StreamedSnapshotLoad>(
+            req.filename, tail_path, tail_offset, req.file_size, available,
+            [storage, path](const storage::durability::SnapshotStream &stream)
+                -> std::unique_ptr<storage::StagedSnapshot> {
+              try {
+                return InMemoryReplicationHandlers::StageSnapshot(storage, path, &stream);
+              } catch (const storage::durability::RecoveryFailure &e) {
+                spdlog::warn("Couldn't load the snapshot while it was being received because of: {}", e.what());
+                return nullptr;
+              }
+            },
+            storage->config_.durability.streamed_snapshot_load_timeout);
+      });
+    }
+  }
+
+  const storage::replication::FileChunkRes res{true, offset};
+  slk::Save(res, res_builder);
+}
+
 void InMemoryReplicationHandlers::CurrentWalHandler(dbms::DbmsHandler *dbms_handler,
                                                     const std::optional<utils::UUID> &current_main_uuid,
                                                     slk::Reader *req_reader, slk::Builder *res_builder) {
@@ -450,19 +583,118 @@ void InMemoryReplicationHandlers::CurrentWalHandler(dbms::DbmsHandler *dbms_hand
   auto *storage = static_cast<storage::InMemoryStorage *>(db_acc->get()->storage());
   utils::EnsureDirOrDie(storage->recovery_.wal_directory_);
 
-  LoadWal(storage, &decoder);
+  if (!LoadWal(storage, &decoder)) {
+    const storage::replication::CurrentWalRes res{false, storage->repl_storage_state_.last_durable_timestamp_.load()};
+    slk::Save(res, res_builder);
+    return;
+  }
 
   const storage::replication::CurrentWalRes res{true, storage->repl_storage_state_.last_durable_timestamp_.load()};
   slk::Save(res, res_builder);
   spdlog::debug("Replication recovery from current WAL ended successfully, replica is now up to date!");
 }
 
-void InMemoryReplicationHandlers::LoadWal(storage::InMemoryStorage *storage, storage::replication::Decoder *decoder) {
+std::unique_ptr<storage::StreamedSnapshotLoad> InMemoryReplicationHandlers::TakeStreamedSnapshotLoad(
+    storage::InMemoryStorage *storage) {
+  return storage->streamed_snapshot_load_.WithLock([](auto &load) { return std::move(load); });
+}
+
+void InMemoryReplicationHandlers::LoadSnapshot(storage::InMemoryStorage *storage, const std::filesystem::path &path) {
+  spdlog::trace("Clearing database since recovering from snapshot.");
+  storage->Clear();
+
+  spdlog::debug("Loading snapshot");
+  auto recovered_snapshot = storage::durability::LoadSnapshot(
+      path, &storage->vertices_, &storage->edges_, &storage->edges_metadata_, &storage->repl_storage_state_.history,
+      storage->name_id_mapper_.get(), &storage->edge_count_, storage->config_, &storage->enum_store_,
+      storage->config_.salient.items.enable_schema_info ? &storage->schema_info_.Get() : nullptr);
+  // Loaded vertices have no deltas, so the GC would never get to sort them
+  auto vertices = storage->vertices_.access();
+  for (auto &vertex : vertices) {
+    storage::SortAdjacency(vertex);
+  }
+  spdlog::debug("Snapshot loaded successfully");
+  FinishSnapshotRecovery(storage, &recovered_snapshot);
+}
+
+std::unique_ptr<storage::StagedSnapshot> InMemoryReplicationHandlers::StageSnapshot(
+    const storage::InMemoryStorage *storage, const std::filesystem::path &path,
+    const storage::durability::SnapshotStream *stream) {
+  spdlog::debug("Loading snapshot");
+  auto staged = std::make_unique<storage::StagedSnapshot>();
+  // Schema info is recovered once the snapshot is installed
+  staged->recovered = storage::durability::LoadSnapshot(
+      path, &staged->vertices, &staged->edges, &staged->edges_metadata, &staged->epoch_history,
+      staged->name_id_mapper.get(), &staged->edge_count, storage->config_, &staged->enum_store, nullptr, stream);
+  // Loaded vertices have no deltas, so the GC would never get to sort them
+  auto vertices = staged->vertices.access();
+  for (auto &vertex : vertices) {
+    storage::SortAdjacency(vertex);
+  }
+  spdlog::debug("Snapshot loaded successfully");
+  return staged;
+}
+
+void InMemoryReplicationHandlers::InstallSnapshot(storage::InMemoryStorage *storage,
+                                                  std::unique_ptr<storage::StagedSnapshot> staged) {
+  spdlog::trace("Clearing database since recovering from snapshot.");
+  storage->Clear();
+  storage->vertices_ = std::move(staged->vertices);
+  storage->edges_ = std::move(staged->edges);
+  storage->edges_metadata_ = std::move(staged->edges_metadata);
+  storage->edge_count_ = staged->edge_count.load();
+  storage->name_id_mapper_ = std::move(staged->name_id_mapper);
+  storage->enum_store_ = std::move(staged->enum_store);
+  storage->repl_storage_state_.history = std::move(staged->epoch_history);
+
+  if (storage->config_.salient.items.enable_schema_info) {
+    spdlog::trace("Recovering schema info from snapshot.");
+    auto &schema_info = storage->schema_info_.Get();
+    auto vertices = storage->vertices_.access();
+    for (auto &vertex : vertices) {
+      schema_info.RecoverVertex(&vertex);
+    }
+    for (auto &vertex : vertices) {
+      for (const auto &[edge_type, to_vertex, edge_ref] : vertex.out_edges) {
+        schema_info.RecoverEdge(edge_type, edge_ref, &vertex, to_vertex,
+                                storage->config_.salient.items.properties_on_edges);
+      }
+    }
+  }
+
+  FinishSnapshotRecovery(storage, &*staged->recovered);
+}
+
+void InMemoryReplicationHandlers::FinishSnapshotRecovery(storage::InMemoryStorage *storage,
+                                                         storage::durability::RecoveredSnapshot *recovered_snapshot) {
+  // If this step is present it should always be the first step of
+  // the recovery so we use the UUID we read from snasphost
+  storage->uuid().set(recovered_snapshot->snapshot_info.uuid);
+  storage->repl_storage_state_.epoch_.SetEpoch(std::move(recovered_snapshot->snapshot_info.epoch_id));
+  const auto &recovery_info = recovered_snapshot->recovery_info;
+  storage->vertex_id_ = recovery_info.next_vertex_id;
+  storage->edge_id_ = recovery_info.next_edge_id;
+  storage->timestamp_ = std::max(storage->timestamp_, recovery_info.next_timestamp);
+  storage->repl_storage_state_.last_durable_timestamp_ = recovery_info.next_timestamp - 1;
+
+  spdlog::trace("Recovering indices and constraints from snapshot.");
+  memgraph::storage::durability::RecoverIndicesAndStats(
+      recovered_snapshot->indices_constraints.indices, &storage->indices_, &storage->vertices_,
+      storage->name_id_mapper_.get(), storage->config_.salient.items.properties_on_edges);
+  memgraph::storage::durability::RecoverConstraints(recovered_snapshot->indices_constraints.constraints,
+                                                    &storage->constraints_, &storage->vertices_,
+                                                    storage->name_id_mapper_.get());
+}
+
+bool InMemoryReplicationHandlers::LoadWal(storage::InMemoryStorage *storage, storage::replication::Decoder *decoder) {
   const auto temp_wal_directory =
       std::filesystem::temp_directory_path() / "memgraph" / storage::durability::kWalDirectory;
   utils::EnsureDir(temp_wal_directory);
   auto maybe_wal_path = decoder->ReadFile(temp_wal_directory);
-  MG_ASSERT(maybe_wal_path, "Failed to load WAL!");
+  if (!maybe_wal_path) {
+    spdlog::error("Failed to receive the WAL file, the recovery will be retried");
+    return false;
+  }
   spdlog::trace("Received WAL saved to {}", *maybe_wal_path);
   try {
     auto wal_info = storage::durability::ReadWalInfo(*maybe_wal_path);
@@ -507,6 +739,7 @@ void InMemoryReplicationHandlers::LoadWal(storage::InMemoryStorage *storage, sto
   } catch (const storage::durability::RecoveryFailure &e) {
     LOG_FATAL("Couldn't recover WAL deltas from {} because of: {}", *maybe_wal_path, e.what());
   }
+  return true;
 }
 
 void InMemoryReplicationHandlers::TimestampHandler(dbms::DbmsHandler *dbms_handler,
@@ -821,6 +1054,17 @@ uint64_t InMemoryReplicationHandlers::ReadAndApplyDeltas(storage::InMemoryStorag
           throw utils::BasicException("Invalid transaction! Please raise an issue, {}:{}", __FILE__, __LINE__);
         break;
       }
+      case WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_CREATE: {
+        spdlog::trace("       Create label+property hash index on :{} ({})", delta.operation_label_property.label,
+                      delta.operation_label_property.property);
+        auto *transaction = get_transaction_accessor(delta_timestamp, kUniqueAccess);
+        if (transaction
+                ->CreateHashIndex(storage->NameToLabel(delta.operation_label_property.label),
+                                  storage->NameToProperty(delta.operation_label_property.property))
+                .HasError())
+          throw utils::BasicException("Invalid transaction! Please raise an issue, {}:{}", __FILE__, __LINE__);
+        break;
+      }
       case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP: {
         spdlog::trace("       Drop label+property index on :{} ({})", delta.operation_label_property.label,
                       delta.operation_label_property.property);
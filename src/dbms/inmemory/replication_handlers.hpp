@@ -17,7 +17,13 @@
 
 namespace memgraph::storage {
 class InMemoryStorage;
-}
+struct StagedSnapshot;
+class StreamedSnapshotLoad;
+namespace durability {
+struct RecoveredSnapshot;
+struct SnapshotStream;
+}  // namespace durability
+}  // namespace memgraph::storage
 namespace memgraph::dbms {
 
 class DbmsHandler;
@@ -43,6 +49,9 @@ class InMemoryReplicationHandlers {
   static void CurrentWalHandler(dbms::DbmsHandler *dbms_handler, const std::optional<utils::UUID> &current_main_uuid,
                                 slk::Reader *req_reader, slk::Builder *res_builder);
 
+  static void FileChunkHandler(dbms::DbmsHandler *dbms_handler, const std::optional<utils::UUID> &current_main_uuid,
+                               slk::Reader *req_reader, slk::Builder *res_builder);
+
   static void TimestampHandler(dbms::DbmsHandler *dbms_handler, const std::optional<utils::UUID> &current_main_uuid,
                                slk::Reader *req_reader, slk::Builder *res_builder);
 
@@ -52,7 +61,32 @@ class InMemoryReplicationHandlers {
                                        const std::optional<utils::UUID> &current_main_uuid, slk::Reader *req_reader,
                                        slk::Builder *res_builder);
 
-  static void LoadWal(storage::InMemoryStorage *storage, storage::replication::Decoder *decoder);
+  /// Replaces the contents of the storage with the snapshot, which is loaded
+  /// directly into the storage. The caller has to hold the storage's main lock.
+  /// @throw storage::durability::RecoveryFailure
+  static void LoadSnapshot(storage::InMemoryStorage *storage, const std::filesystem::path &path);
+
+  /// Loads the snapshot next to the storage, which is left as it is.
+  /// @throw storage::durability::RecoveryFailure
+  static std::unique_ptr<storage::StagedSnapshot> StageSnapshot(const storage::InMemoryStorage *storage,
+                                                                const std::filesystem::path &path,
+                                                                const storage::durability::SnapshotStream *stream);
+
+  /// Replaces the contents of the storage with the staged snapshot, the caller
+  /// has to hold the storage's main lock.
+  /// @throw storage::durability::RecoveryFailure
+  static void InstallSnapshot(storage::InMemoryStorage *storage, std::unique_ptr<storage::StagedSnapshot> staged);
+
+  /// Restores the storage's identity, ids, indices and constraints once the
+  /// snapshot's vertices and edges are in it.
+  static void FinishSnapshotRecovery(storage::InMemoryStorage *storage,
+                                     storage::durability::RecoveredSnapshot *recovered_snapshot);
+
+  static std::unique_ptr<storage::StreamedSnapshotLoad> TakeStreamedSnapshotLoad(storage::InMemoryStorage *storage);
+
+  /// @return false if the WAL file couldn't be received, e.g. because its
+  /// staged data is missing
+  static bool LoadWal(storage::InMemoryStorage *storage, storage::replication::Decoder *decoder);
 
   static uint64_t ReadAndApplyDeltas(storage::InMemoryStorage *storage, storage::durability::BaseDecoder *decoder,
                                      uint64_t version);
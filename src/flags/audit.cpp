@@ -10,6 +10,8 @@
 // licenses/APL.txt.
 #include "flags/audit.hpp"
 
+#include <iostream>
+
 #include "utils/flag_validation.hpp"
 
 const uint64_t kBufferSizeDefault = 100'000;
@@ -20,10 +22,20 @@ const uint64_t kBufferFlushIntervalMillisDefault = 200;
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(audit_enabled, false, "Set to true to enable audit logging.");
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-DEFINE_VALIDATED_int32(audit_buffer_size, kBufferSizeDefault, "Maximum number of items in the audit log buffer.",
+DEFINE_VALIDATED_int32(audit_buffer_size, kBufferSizeDefault,
+                       "Maximum number of items in the audit log buffers, split between the recording threads.",
                        FLAG_IN_RANGE(1, INT32_MAX));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_int32(audit_buffer_flush_interval_ms, kBufferFlushIntervalMillisDefault,
                        "Interval (in milliseconds) used for flushing the audit log buffer.",
                        FLAG_IN_RANGE(10, INT32_MAX));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_string(audit_log_format, "text",
+                        "Format of the audit log. Options [text, binary]. Binary logs are more compact and cheaper to "
+                        "write; convert them to the text format with mg_audit_convert.",
+                        {
+                          if (value == "text" || value == "binary") return true;
+                          std::cout << "Expected --" << flagname << " to be either text or binary." << std::endl;
+                          return false;
+                        });
 #endif
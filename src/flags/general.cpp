@@ -69,6 +69,15 @@ DEFINE_VALIDATED_uint64(storage_gc_cycle_sec, 30, "Storage garbage collector int
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_python_gc_cycle_sec, 180,
                         "Storage python full garbage collection interval (in seconds).", FLAG_IN_RANGE(1, 24UL * 3600));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_background_workers, 0,
+              "Number of threads shared by the background tasks (GC, snapshots, TTL) of all databases, one more "
+              "thread only runs garbage collection. When 0, each task of each database runs on its own thread.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_background_io_limit, 1,
+                        "Maximum number of I/O-heavy background tasks (snapshots) running at the same time when "
+                        "storage_background_workers is set.",
+                        FLAG_IN_RANGE(1, 1024));
 // NOTE: The `storage_properties_on_edges` flag must be the same here and in
 // `mg_import_csv`. If you change it, make sure to change it there as well.
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -10,5 +10,20 @@
 // licenses/APL.txt.
 #include "flags/query.hpp"
 
+#include "utils/flag_validation.hpp"
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 // DEFINE_bool(cartesian_product_enabled, true, "Enable cartesian product expansion.");  Moved to run_time_configurable
+
+// Slow query log flags.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(slow_query_log_threshold_ms, 0,
+              "Queries which take longer than this (in milliseconds) are written to the slow query log together "
+              "with their plan and resource usage. Value of 0 disables the slow query log.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(slow_query_log_file_size_kib, 10240,
+                        "Maximum size (in kibibytes) of a slow query log file before it is rotated.",
+                        FLAG_IN_RANGE(1, 1024 * 1024));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(slow_query_log_file_count, 5, "Number of rotated slow query log files which are kept.",
+                        FLAG_IN_RANGE(1, 1000));
@@ -12,6 +12,7 @@
 #include "replication.hpp"
 
 #include "gflags/gflags.h"
+#include "utils/flag_validation.hpp"
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint64(replication_replica_check_frequency_sec, 1,
@@ -19,3 +20,12 @@ DEFINE_uint64(replication_replica_check_frequency_sec, 1,
               "The MAIN instance allocates a new thread for each REPLICA.");
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(replication_restore_state_on_startup, true, "Restore replication state on startup, e.g. recover replica");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(replication_streamed_snapshot_load, false,
+            "Load large snapshots on replicas while they are being received. The replica keeps its old data until "
+            "the snapshot is loaded, so it needs memory for both. Has to be set on MAIN and on the REPLICAs.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(replication_streamed_snapshot_load_timeout_sec, 60,
+                        "Time (in seconds) a streamed snapshot load waits for more of the snapshot before it gives up. "
+                        "The snapshot is then loaded once it's received.",
+                        FLAG_IN_RANGE(1, 24UL * 3600));
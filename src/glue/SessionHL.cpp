@@ -245,6 +245,11 @@ bolt_map_t SessionHL::Pull(SessionHL::TEncoder *encoder, std::optional<int> n, s
   }
 }
 
+void SessionHL::Prefetch(std::optional<int> n, std::optional<int> qid) noexcept {
+  if (!n) return;
+  interpreter_.Prefetch(*n, qid);
+}
+
 std::pair<std::vector<std::string>, std::optional<int>> SessionHL::Interpret(const std::string &query,
                                                                              const bolt_map_t &params,
                                                                              const bolt_map_t &extra) {
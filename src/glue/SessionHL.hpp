@@ -66,6 +66,8 @@ class SessionHL final : public memgraph::communication::bolt::Session<memgraph::
 
   bolt_map_t Discard(std::optional<int> n, std::optional<int> qid) override;
 
+  void Prefetch(std::optional<int> n, std::optional<int> qid) noexcept override;
+
   void Abort() override;
 
   void TryDefaultDB();
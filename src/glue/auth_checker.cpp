@@ -29,67 +29,6 @@
 #include <algorithm>
 #include <span>
 
-#ifdef MG_ENTERPRISE
-namespace {
-bool IsAuthorizedLabels(const memgraph::auth::UserOrRole &user_or_role, const memgraph::query::DbAccessor *dba,
-                        std::span<memgraph::storage::LabelId const> labels,
-                        const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) {
-  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
-    return true;
-  }
-  return std::ranges::all_of(labels, [dba, &user_or_role, fine_grained_privilege](const auto &label) {
-    return std::visit(memgraph::utils::Overloaded{[&](auto &user_or_role) {
-                        return user_or_role.GetFineGrainedAccessLabelPermissions().Has(
-                                   dba->LabelToName(label), memgraph::glue::FineGrainedPrivilegeToFineGrainedPermission(
-                                                                fine_grained_privilege)) ==
-                               memgraph::auth::PermissionLevel::GRANT;
-                      }},
-                      user_or_role);
-  });
-}
-
-bool IsAuthorizedGloballyLabels(const memgraph::auth::UserOrRole &user_or_role,
-                                const memgraph::auth::FineGrainedPermission fine_grained_permission) {
-  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
-    return true;
-  }
-  return std::visit(memgraph::utils::Overloaded{[&](auto &user_or_role) {
-                      return user_or_role.GetFineGrainedAccessLabelPermissions().Has(memgraph::query::kAsterisk,
-                                                                                     fine_grained_permission) ==
-                             memgraph::auth::PermissionLevel::GRANT;
-                    }},
-                    user_or_role);
-}
-
-bool IsAuthorizedGloballyEdges(const memgraph::auth::UserOrRole &user_or_role,
-                               const memgraph::auth::FineGrainedPermission fine_grained_permission) {
-  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
-    return true;
-  }
-  return std::visit(memgraph::utils::Overloaded{[&](auto &user_or_role) {
-                      return user_or_role.GetFineGrainedAccessEdgeTypePermissions().Has(memgraph::query::kAsterisk,
-                                                                                        fine_grained_permission) ==
-                             memgraph::auth::PermissionLevel::GRANT;
-                    }},
-                    user_or_role);
-}
-
-bool IsAuthorizedEdgeType(const memgraph::auth::UserOrRole &user_or_role, const memgraph::query::DbAccessor *dba,
-                          const memgraph::storage::EdgeTypeId &edgeType,
-                          const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) {
-  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
-    return true;
-  }
-  return std::visit(memgraph::utils::Overloaded{[&](auto &user_or_role) {
-                      return user_or_role.GetFineGrainedAccessEdgeTypePermissions().Has(
-                                 dba->EdgeTypeToName(edgeType),
-                                 memgraph::glue::FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege)) ==
-                             memgraph::auth::PermissionLevel::GRANT;
-                    }},
-                    user_or_role);
-}
-}  // namespace
-#endif
 namespace memgraph::glue {
 
 AuthChecker::AuthChecker(memgraph::auth::SynchedAuth *auth) : auth_(auth) {}
@@ -186,8 +125,68 @@ bool AuthChecker::IsUserOrRoleAuthorized(const memgraph::auth::UserOrRole &user_
 }
 
 #ifdef MG_ENTERPRISE
+CompiledFineGrainedPermissions::CompiledFineGrainedPermissions(auth::FineGrainedAccessPermissions permissions)
+    : permissions_{std::move(permissions)} {}
+
+bool CompiledFineGrainedPermissions::HasGlobal(const auth::FineGrainedPermission fine_grained_permission) const {
+  return permissions_.Has(query::kAsterisk, fine_grained_permission) == auth::PermissionLevel::GRANT;
+}
+
+uint64_t CompiledFineGrainedPermissions::Compile(const uint64_t id, const std::string &name) const {
+  // Same resolution as FineGrainedAccessPermissions::Has
+  const auto &permissions = permissions_.GetPermissions();
+  const auto it = permissions.find(name);
+  const uint64_t granted = it != permissions.end() ? it->second : permissions_.GetGlobalPermission().value_or(0);
+  auto compiled = compiled_.Lock();
+  if (id >= compiled->size()) compiled->resize(id + 1, 0);
+  (*compiled)[id] = granted | kCompiled;
+  return granted;
+}
+
+namespace {
+auto LabelPermissions(const auth::UserOrRole &user_or_role) -> auth::FineGrainedAccessPermissions {
+  // Users merge their own and their role's permissions, do that only once
+  return std::visit(utils::Overloaded{[](auto &user_or_role) -> auth::FineGrainedAccessPermissions {
+                      return user_or_role.GetFineGrainedAccessLabelPermissions();
+                    }},
+                    user_or_role);
+}
+
+auto EdgeTypePermissions(const auth::UserOrRole &user_or_role) -> auth::FineGrainedAccessPermissions {
+  return std::visit(utils::Overloaded{[](auto &user_or_role) -> auth::FineGrainedAccessPermissions {
+                      return user_or_role.GetFineGrainedAccessEdgeTypePermissions();
+                    }},
+                    user_or_role);
+}
+}  // namespace
+
 FineGrainedAuthChecker::FineGrainedAuthChecker(auth::UserOrRole user_or_role, const memgraph::query::DbAccessor *dba)
-    : user_or_role_{std::move(user_or_role)}, dba_(dba){};
+    : dba_(dba),
+      label_permissions_{LabelPermissions(user_or_role)},
+      edge_type_permissions_{EdgeTypePermissions(user_or_role)} {}
+
+bool FineGrainedAuthChecker::IsAuthorizedLabels(
+    std::span<memgraph::storage::LabelId const> labels,
+    const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const {
+  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
+    return true;
+  }
+  const auto permission = static_cast<uint64_t>(FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
+  return std::ranges::all_of(labels, [&](const auto &label) {
+    return (label_permissions_.Get(label.AsUint(), [&] { return dba_->LabelToName(label); }) & permission) != 0;
+  });
+}
+
+bool FineGrainedAuthChecker::IsAuthorizedEdgeType(
+    const memgraph::storage::EdgeTypeId edge_type,
+    const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const {
+  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
+    return true;
+  }
+  const auto permission = static_cast<uint64_t>(FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
+  return (edge_type_permissions_.Get(edge_type.AsUint(), [&] { return dba_->EdgeTypeToName(edge_type); }) &
+          permission) != 0;
+}
 
 bool FineGrainedAuthChecker::Has(const memgraph::query::VertexAccessor &vertex, const memgraph::storage::View view,
                                  const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const {
@@ -205,22 +204,22 @@ bool FineGrainedAuthChecker::Has(const memgraph::query::VertexAccessor &vertex,
     }
   }
 
-  return IsAuthorizedLabels(user_or_role_, dba_, *maybe_labels, fine_grained_privilege);
+  return IsAuthorizedLabels(*maybe_labels, fine_grained_privilege);
 }
 
 bool FineGrainedAuthChecker::Has(const memgraph::query::EdgeAccessor &edge,
                                  const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const {
-  return IsAuthorizedEdgeType(user_or_role_, dba_, edge.EdgeType(), fine_grained_privilege);
+  return IsAuthorizedEdgeType(edge.EdgeType(), fine_grained_privilege);
 }
 
 bool FineGrainedAuthChecker::Has(const std::vector<memgraph::storage::LabelId> &labels,
                                  const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const {
-  return IsAuthorizedLabels(user_or_role_, dba_, labels, fine_grained_privilege);
+  return IsAuthorizedLabels(labels, fine_grained_privilege);
 }
 
 bool FineGrainedAuthChecker::Has(const memgraph::storage::EdgeTypeId &edge_type,
                                  const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const {
-  return IsAuthorizedEdgeType(user_or_role_, dba_, edge_type, fine_grained_privilege);
+  return IsAuthorizedEdgeType(edge_type, fine_grained_privilege);
 }
 
 bool FineGrainedAuthChecker::HasGlobalPrivilegeOnVertices(
@@ -228,7 +227,7 @@ bool FineGrainedAuthChecker::HasGlobalPrivilegeOnVertices(
   if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
     return true;
   }
-  return IsAuthorizedGloballyLabels(user_or_role_, FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
+  return label_permissions_.HasGlobal(FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
 }
 
 bool FineGrainedAuthChecker::HasGlobalPrivilegeOnEdges(
@@ -236,7 +235,7 @@ bool FineGrainedAuthChecker::HasGlobalPrivilegeOnEdges(
   if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
     return true;
   }
-  return IsAuthorizedGloballyEdges(user_or_role_, FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
+  return edge_type_permissions_.HasGlobal(FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
 };
 #endif
 }  // namespace memgraph::glue
@@ -11,11 +11,16 @@
 
 #pragma once
 
+#include <span>
+#include <vector>
+
 #include "auth/auth.hpp"
 #include "glue/auth.hpp"
 #include "query/auth_checker.hpp"
 #include "query/frontend/ast/ast.hpp"
+#include "utils/rw_spin_lock.hpp"
 #include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
 
 namespace memgraph::glue {
 
@@ -51,6 +56,40 @@ class AuthChecker : public query::AuthChecker {
   mutable utils::Synchronized<auth::UserOrRole, utils::SpinLock> user_or_role_;  // cached user
 };
 #ifdef MG_ENTERPRISE
+/**
+ * Fine grained permissions on labels or edge types, compiled into a table
+ * indexed by the storage id so that checking them doesn't need to look up the
+ * name of the label or edge type. Ids are compiled on first use, which also
+ * covers labels and edge types created after construction.
+ *
+ * Thread-safe, so parallel operators of a query can share it.
+ */
+class CompiledFineGrainedPermissions {
+ public:
+  explicit CompiledFineGrainedPermissions(auth::FineGrainedAccessPermissions permissions);
+
+  /// Returns the granted permission bits for the id, calling `to_name` only
+  /// the first time the id is seen.
+  template <typename TToName>
+  uint64_t Get(uint64_t id, TToName &&to_name) const {
+    {
+      auto compiled = compiled_.ReadLock();
+      if (id < compiled->size() && ((*compiled)[id] & kCompiled)) return (*compiled)[id] & ~kCompiled;
+    }
+    return Compile(id, std::forward<TToName>(to_name)());
+  }
+
+  bool HasGlobal(auth::FineGrainedPermission fine_grained_permission) const;
+
+ private:
+  static constexpr uint64_t kCompiled = 1ULL << 63U;
+
+  uint64_t Compile(uint64_t id, const std::string &name) const;
+
+  auth::FineGrainedAccessPermissions permissions_;
+  mutable utils::Synchronized<std::vector<uint64_t>, utils::RWSpinLock> compiled_;
+};
+
 class FineGrainedAuthChecker : public query::FineGrainedAuthChecker {
  public:
   explicit FineGrainedAuthChecker(auth::UserOrRole user, const query::DbAccessor *dba);
@@ -72,8 +111,15 @@ class FineGrainedAuthChecker : public query::FineGrainedAuthChecker {
   bool HasGlobalPrivilegeOnEdges(query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const override;
 
  private:
-  auth::UserOrRole user_or_role_;
+  bool IsAuthorizedLabels(std::span<storage::LabelId const> labels,
+                          query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const;
+
+  bool IsAuthorizedEdgeType(storage::EdgeTypeId edge_type,
+                            query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const;
+
   const query::DbAccessor *dba_;
+  CompiledFineGrainedPermissions label_permissions_;
+  CompiledFineGrainedPermissions edge_type_permissions_;
 };
 #endif
 }  // namespace memgraph::glue
@@ -12,9 +12,12 @@
 #pragma once
 
 #include <atomic>
+#include <string>
+#include <string_view>
 #include <tuple>
 #include <vector>
 
+#include <fmt/format.h>
 #include <spdlog/spdlog.h>
 #include <boost/beast/http.hpp>
 #include <boost/beast/version.hpp>
@@ -25,6 +28,7 @@
 #include "license/license_sender.hpp"
 #include "storage/v2/storage.hpp"
 #include "utils/event_histogram.hpp"
+#include "utils/labeled_histogram.hpp"
 
 namespace memgraph::http {
 
@@ -58,9 +62,108 @@ class MetricsService {
     return AsJson(response);
   }
 
+  // Metrics in the Prometheus text exposition format (version 0.0.4). Unlike the
+  // JSON response, histograms are exposed with their cumulative buckets so they
+  // can be aggregated and turned into quantiles on the Prometheus side.
+  std::string GetMetricsPrometheus() {
+    auto info = db_->GetBaseInfo();
+    std::string out;
+
+    AppendPrometheusMetric(&out, "vertex_count", "gauge", "Number of vertices.", info.vertex_count);
+    AppendPrometheusMetric(&out, "edge_count", "gauge", "Number of edges.", info.edge_count);
+    AppendPrometheusMetric(&out, "average_degree", "gauge", "Average vertex degree.", info.average_degree);
+    AppendPrometheusMetric(&out, "memory_usage", "gauge", "Resident memory in bytes.", info.memory_res);
+    AppendPrometheusMetric(&out, "peak_memory_usage", "gauge", "Peak resident memory in bytes.", info.peak_memory_res);
+    AppendPrometheusMetric(&out, "unreleased_delta_objects", "gauge",
+                           "Number of deltas not yet released by the garbage collector.",
+                           info.unreleased_delta_objects);
+    AppendPrometheusMetric(&out, "disk_usage", "gauge", "Disk usage in bytes.", info.disk_usage);
+
+    // Some event counters (e.g. active sessions) also go down, so they can't be exposed as Prometheus counters.
+    for (auto i = 0; i < memgraph::metrics::CounterEnd(); i++) {
+      AppendPrometheusMetric(&out, memgraph::metrics::GetCounterName(i), "untyped",
+                             memgraph::metrics::GetCounterDocumentation(i),
+                             memgraph::metrics::global_counters[i].load(std::memory_order_acquire));
+    }
+
+    for (auto i = 0; i < memgraph::metrics::GaugeEnd(); i++) {
+      AppendPrometheusMetric(&out, memgraph::metrics::GetGaugeName(i), "gauge",
+                             memgraph::metrics::GetGaugeDocumentation(i),
+                             memgraph::metrics::global_gauges[i].load(std::memory_order_acquire));
+    }
+
+    // All histograms in the system measure microseconds, they are exposed in
+    // seconds as Prometheus expects.
+    const auto &latency_bounds = memgraph::metrics::LatencyBucketBounds();
+    for (auto i = 0; i < memgraph::metrics::HistogramEnd(); i++) {
+      auto histogram_name = std::string_view{memgraph::metrics::GetHistogramName(i)};
+      if (histogram_name.ends_with("_us")) histogram_name.remove_suffix(3);
+      const auto name = fmt::format("memgraph_{}_seconds", histogram_name);
+      const auto &histogram = memgraph::metrics::global_histograms[i];
+      AppendPrometheusHeader(&out, name, "histogram", memgraph::metrics::GetHistogramDocumentation(i));
+      const auto counts = histogram.CumulativeCounts(latency_bounds);
+      for (size_t bound = 0; bound < latency_bounds.size(); ++bound) {
+        fmt::format_to(std::back_inserter(out), "{}_bucket{{le=\"{}\"}} {}\n", name,
+                       MicrosecondsToSeconds(latency_bounds[bound]), counts[bound]);
+      }
+      fmt::format_to(std::back_inserter(out), "{0}_bucket{{le=\"+Inf\"}} {1}\n{0}_sum {2}\n{0}_count {1}\n", name,
+                     histogram.Count(), MicrosecondsToSeconds(histogram.Sum()));
+    }
+
+    const auto &global_query_latency = memgraph::metrics::global_query_latency_histogram;
+    constexpr std::string_view kQueryLatencyName = "memgraph_query_latency_seconds";
+    AppendPrometheusHeader(&out, kQueryLatencyName, "histogram", "Latency of finished queries by database and type.");
+    for (const auto &series : global_query_latency.Collect()) {
+      const auto labels = fmt::format("db=\"{}\",type=\"{}\"", EscapeLabelValue(series.first_label),
+                                      EscapeLabelValue(series.second_label));
+      for (size_t bound = 0; bound < latency_bounds.size(); ++bound) {
+        fmt::format_to(std::back_inserter(out), "{}_bucket{{{},le=\"{}\"}} {}\n", kQueryLatencyName, labels,
+                       MicrosecondsToSeconds(latency_bounds[bound]), series.cumulative_counts[bound]);
+      }
+      fmt::format_to(std::back_inserter(out), "{0}_bucket{{{1},le=\"+Inf\"}} {2}\n{0}_sum{{{1}}} {3}\n",
+                     kQueryLatencyName, labels, series.cumulative_counts.back(),
+                     MicrosecondsToSeconds(series.sum));
+      fmt::format_to(std::back_inserter(out), "{}_count{{{}}} {}\n", kQueryLatencyName, labels,
+                     series.cumulative_counts.back());
+    }
+
+    return out;
+  }
+
  private:
   storage::Storage *const db_;
 
+  static double MicrosecondsToSeconds(uint64_t microseconds) { return static_cast<double>(microseconds) / 1e6; }
+
+  static std::string EscapeLabelValue(std::string_view value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (const auto c : value) {
+      if (c == '\\' || c == '"') {
+        escaped.push_back('\\');
+        escaped.push_back(c);
+      } else if (c == '\n') {
+        escaped.append("\\n");
+      } else {
+        escaped.push_back(c);
+      }
+    }
+    return escaped;
+  }
+
+  static void AppendPrometheusHeader(std::string *out, std::string_view name, std::string_view type,
+                                     std::string_view help) {
+    fmt::format_to(std::back_inserter(*out), "# HELP {0} {1}\n# TYPE {0} {2}\n", name, help, type);
+  }
+
+  template <typename TValue>
+  static void AppendPrometheusMetric(std::string *out, std::string_view name, std::string_view type,
+                                     std::string_view help, TValue value) {
+    const auto full_name = fmt::format("memgraph_{}", name);
+    AppendPrometheusHeader(out, full_name, type, help);
+    fmt::format_to(std::back_inserter(*out), "{} {}\n", full_name, value);
+  }
+
   MetricsResponse GetMetrics() {
     auto info = db_->GetBaseInfo();
 
@@ -201,8 +304,14 @@ class MetricsRequestHandler final {
     // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
     boost::beast::http::string_body::value_type body;
 
-    auto service_response = service_.GetMetricsJSON();
-    body.append(service_response.dump());
+    // Prometheus scrapes /metrics by default, everything else keeps getting the JSON response.
+    const bool prometheus = req.target() == kPrometheusTarget;
+    if (prometheus) {
+      body.append(service_.GetMetricsPrometheus());
+    } else {
+      auto service_response = service_.GetMetricsJSON();
+      body.append(service_response.dump());
+    }
 
     // Cache the size since we need it after the move
     const auto size = body.size();
@@ -213,13 +322,16 @@ class MetricsRequestHandler final {
         std::piecewise_construct, std::make_tuple(std::move(body)),
         std::make_tuple(boost::beast::http::status::ok, req.version())};
     res.set(boost::beast::http::field::server, BOOST_BEAST_VERSION_STRING);
-    res.set(boost::beast::http::field::content_type, "application/json");
+    res.set(boost::beast::http::field::content_type,
+            prometheus ? "text/plain; version=0.0.4; charset=utf-8" : "application/json");
     res.content_length(size);
     res.keep_alive(req.keep_alive());
     return send(std::move(res));
   }
 
  private:
+  static constexpr const char *kPrometheusTarget = "/metrics";
+
   MetricsService service_;
 };
 }  // namespace memgraph::http
@@ -50,6 +50,7 @@
 #include "query/procedure/callable_alias_mapper.hpp"
 #include "query/procedure/module.hpp"
 #include "query/procedure/py_module.hpp"
+#include "query/slow_query_log.hpp"
 #include "replication/state.hpp"
 #include "replication_handler/replication_handler.hpp"
 #include "replication_handler/system_replication.hpp"
@@ -59,6 +60,7 @@
 #include "storage/v2/storage_mode.hpp"
 #include "system/system.hpp"
 #include "telemetry/telemetry.hpp"
+#include "utils/background_executor.hpp"
 #include "utils/event_gauge.hpp"
 #include "utils/file.hpp"
 #include "utils/logging.hpp"
@@ -337,8 +339,9 @@ int main(int argc, char **argv) {
 
 #ifdef MG_ENTERPRISE
   // Audit log
-  memgraph::audit::Log audit_log{data_directory / "audit", FLAGS_audit_buffer_size,
-                                 FLAGS_audit_buffer_flush_interval_ms};
+  memgraph::audit::Log audit_log{
+      data_directory / "audit", FLAGS_audit_buffer_size, FLAGS_audit_buffer_flush_interval_ms,
+      FLAGS_audit_log_format == "binary" ? memgraph::audit::Log::Format::BINARY : memgraph::audit::Log::Format::TEXT};
   // Start the log if enabled.
   if (FLAGS_audit_enabled) {
     audit_log.Start();
@@ -352,6 +355,23 @@ int main(int argc, char **argv) {
   // End enterprise features initialization
 #endif
 
+  // Slow query log
+  std::optional<memgraph::query::SlowQueryLog> slow_query_log;
+  if (FLAGS_slow_query_log_threshold_ms > 0) {
+    const auto slow_query_log_directory = data_directory / "slow_query_log";
+    memgraph::utils::EnsureDirOrDie(slow_query_log_directory);
+    slow_query_log.emplace(slow_query_log_directory / "slow_queries.log",
+                           std::chrono::milliseconds(FLAGS_slow_query_log_threshold_ms),
+                           FLAGS_slow_query_log_file_size_kib * 1024, FLAGS_slow_query_log_file_count);
+  }
+
+  // Background tasks of all databases share a fixed pool of workers, if enabled.
+  // It's stopped at exit, after all the databases unregistered their tasks.
+  if (FLAGS_storage_background_workers > 0) {
+    memgraph::utils::global_background_executor.Start(FLAGS_storage_background_workers,
+                                                      FLAGS_storage_background_io_limit);
+  }
+
   // Main storage and execution engines initialization
   memgraph::storage::Config db_config{
       .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
@@ -364,6 +384,9 @@ int main(int argc, char **argv) {
                      .wal_file_flush_every_n_tx = FLAGS_storage_wal_file_flush_every_n_tx,
                      .snapshot_on_exit = FLAGS_storage_snapshot_on_exit,
                      .restore_replication_state_on_startup = FLAGS_replication_restore_state_on_startup,
+                     .streamed_snapshot_load = FLAGS_replication_streamed_snapshot_load,
+                     .streamed_snapshot_load_timeout =
+                         std::chrono::seconds(FLAGS_replication_streamed_snapshot_load_timeout_sec),
                      .items_per_batch = FLAGS_storage_items_per_batch,
                      .recovery_thread_count = FLAGS_storage_recovery_thread_count,
                      .allow_parallel_schema_creation = FLAGS_storage_parallel_schema_recovery},
@@ -591,6 +614,9 @@ int main(int argc, char **argv) {
       auth_handler.get(), auth_checker.get(), &replication_handler);
 
   auto &interpreter_context_ = memgraph::query::InterpreterContextHolder::GetInstance();
+  if (slow_query_log) {
+    interpreter_context_.slow_query_log = &*slow_query_log;
+  }
   MG_ASSERT(db_acc, "Failed to access the main database");
 
   memgraph::query::procedure::gModuleRegistry.SetModulesDirectory(memgraph::flags::ParseQueryModulesDirectory(),
@@ -113,6 +113,15 @@ bool QueriesMemoryControl::EraseTransactionIdTracker(uint64_t transaction_id) {
   return removed;
 }
 
+std::optional<int64_t> QueriesMemoryControl::GetTransactionIdTrackerPeak(uint64_t transaction_id) {
+  auto transaction_id_to_tracker_accessor = transaction_id_to_tracker.access();
+  auto query_tracker = transaction_id_to_tracker_accessor.find(transaction_id);
+  if (query_tracker == transaction_id_to_tracker_accessor.end()) {
+    return std::nullopt;
+  }
+  return query_tracker->tracker.Peak();
+}
+
 bool QueriesMemoryControl::CheckTransactionIdTrackerExists(uint64_t transaction_id) {
   auto transaction_id_to_tracker_accessor = transaction_id_to_tracker.access();
   return transaction_id_to_tracker_accessor.contains(transaction_id);
@@ -205,6 +214,14 @@ bool IsTransactionTracked(uint64_t transaction_id) {
 bool IsTransactionTracked(uint64_t /*transaction_id*/) { return false; }
 #endif
 
+#if USE_JEMALLOC
+std::optional<int64_t> GetTransactionPeakMemory(uint64_t transaction_id) {
+  return GetQueriesMemoryControl().GetTransactionIdTrackerPeak(transaction_id);
+}
+#else
+std::optional<int64_t> GetTransactionPeakMemory(uint64_t /*transaction_id*/) { return std::nullopt; }
+#endif
+
 void CreateOrContinueProcedureTracking(uint64_t transaction_id, int64_t procedure_id, size_t limit) {
 #if USE_JEMALLOC
   if (!GetQueriesMemoryControl().CheckTransactionIdTrackerExists(transaction_id)) {
@@ -12,6 +12,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <thread>
 #include <unordered_map>
 
@@ -46,6 +47,9 @@ class QueriesMemoryControl {
   // Remove current tracker for transaction_id
   bool EraseTransactionIdTracker(uint64_t);
 
+  // Peak memory of the tracker for transaction_id if it exists
+  std::optional<int64_t> GetTransactionIdTrackerPeak(uint64_t);
+
   /*
   Thread handlings
   */
@@ -144,6 +148,10 @@ void TryStopTrackingOnTransaction(uint64_t transaction_id);
 // Is transaction with given id tracked in memory tracker
 bool IsTransactionTracked(uint64_t transaction_id);
 
+// Peak memory of the current query in the transaction with given id.
+// Returns std::nullopt if jemalloc is not enabled or the transaction isn't tracked
+std::optional<int64_t> GetTransactionPeakMemory(uint64_t transaction_id);
+
 // Creates tracker on procedure if doesn't exist. Sets query tracker
 // to track procedure with id.
 void CreateOrContinueProcedureTracking(uint64_t transaction_id, int64_t procedure_id, size_t limit);
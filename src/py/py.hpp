@@ -48,6 +48,23 @@ class EnsureGIL final {
   EnsureGIL &operator=(EnsureGIL &&) = delete;
 };
 
+/// Release the GIL held by the current thread for the lifetime of the object.
+///
+/// Use it around long-running native code that doesn't touch any Python
+/// objects, so that other threads may run Python code in the meantime. The
+/// current thread must hold the GIL when the object is constructed.
+class ReleaseGIL final {
+  PyThreadState *thread_state_;
+
+ public:
+  ReleaseGIL() noexcept : thread_state_(PyEval_SaveThread()) {}
+  ~ReleaseGIL() noexcept { PyEval_RestoreThread(thread_state_); }
+  ReleaseGIL(const ReleaseGIL &) = delete;
+  ReleaseGIL(ReleaseGIL &&) = delete;
+  ReleaseGIL &operator=(const ReleaseGIL &) = delete;
+  ReleaseGIL &operator=(ReleaseGIL &&) = delete;
+};
+
 /// Owns a `PyObject *` and supports a more C++ idiomatic API to objects.
 class [[nodiscard]] Object final {
   PyObject *ptr_{nullptr};
@@ -13,6 +13,7 @@
 
 #include <memory>
 #include <type_traits>
+#include <unordered_map>
 
 #include "query/common.hpp"
 #include "query/frontend/semantic/symbol_table.hpp"
@@ -21,6 +22,7 @@
 #include "query/plan/profile.hpp"
 #include "query/trigger.hpp"
 #include "utils/async_timer.hpp"
+#include "utils/bloom_filter.hpp"
 
 #include "query/frame_change.hpp"
 #include "query/hops_limit.hpp"
@@ -81,6 +83,9 @@ struct ExecutionContext {
   int64_t number_of_hops{0};
   HopsLimit hops_limit;
   std::optional<uint64_t> periodic_commit_frequency;
+  // Join keys of the left branches of hash joins, published for the JoinKeyFilter in their right branch. Mapped by
+  // the key expression both operators share.
+  std::unordered_map<const Expression *, const utils::BloomFilter *> join_key_filters;
 #ifdef MG_ENTERPRISE
   std::unique_ptr<FineGrainedAuthChecker> auth_checker{nullptr};
 #endif
@@ -16,6 +16,7 @@
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/frontend/stripped.hpp"
 #include "query/parameters.hpp"
+#include "query/plan/profile.hpp"
 #include "storage/v2/property_value.hpp"
 #include "utils/lru_cache.hpp"
 #include "utils/synchronized.hpp"
@@ -26,6 +27,8 @@
 DECLARE_bool(query_cost_planner);
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DECLARE_int32(query_plan_cache_max_size);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_int32(query_stats_sample_rate);
 
 namespace memgraph::query {
 
@@ -69,8 +72,11 @@ class PlanWrapper {
   const auto &symbol_table() const { return plan_->GetSymbolTable(); }
   const auto &ast_storage() const { return plan_->GetAstStorage(); }
 
+  plan::PlanRuntimeStats &runtime_stats() { return runtime_stats_; }
+
  private:
   std::unique_ptr<LogicalPlan> plan_;
+  plan::PlanRuntimeStats runtime_stats_;
 };
 
 struct CachedQuery {
@@ -499,6 +499,10 @@ class DbAccessor final {
     return accessor_->LabelPropertyIndexExists(label, prop);
   }
 
+  bool LabelPropertyHashIndexExists(storage::LabelId label, storage::PropertyId prop) const {
+    return accessor_->LabelPropertyHashIndexExists(label, prop);
+  }
+
   bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) const { return accessor_->EdgeTypeIndexExists(edge_type); }
 
   bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) const {
@@ -641,6 +645,11 @@ class DbAccessor final {
     return accessor_->DropIndex(edge_type, property);
   }
 
+  utils::BasicResult<storage::StorageIndexDefinitionError, void> CreateHashIndex(storage::LabelId label,
+                                                                                 storage::PropertyId property) {
+    return accessor_->CreateHashIndex(label, property);
+  }
+
   utils::BasicResult<storage::StorageIndexDefinitionError, void> CreatePointIndex(storage::LabelId label,
                                                                                   storage::PropertyId property) {
     return accessor_->CreatePointIndex(label, property);
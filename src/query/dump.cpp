@@ -301,9 +301,9 @@ void DumpEdgeTypePropertyIndex(std::ostream *os, query::DbAccessor *dba, const s
 }
 
 void DumpLabelPropertyIndex(std::ostream *os, query::DbAccessor *dba, storage::LabelId label,
-                            storage::PropertyId property) {
+                            storage::PropertyId property, bool using_hash) {
   *os << "CREATE INDEX ON :" << EscapeName(dba->LabelToName(label)) << "(" << EscapeName(dba->PropertyToName(property))
-      << ");";
+      << ")" << (using_hash ? " USING HASH" : "") << ";";
 }
 
 void DumpTextIndex(std::ostream *os, query::DbAccessor *dba, const std::string &index_name, storage::LabelId label) {
@@ -527,12 +527,15 @@ PullPlanDump::PullChunk PullPlanDump::CreateLabelPropertyIndicesPullChunk() {
       indices_info_.emplace(dba_->ListAllIndices());
     }
     const auto &label_property = indices_info_->label_property;
+    const auto &label_property_hash = indices_info_->label_property_hash;
 
     size_t local_counter = 0;
     while (global_index < label_property.size() && (!n || local_counter < *n)) {
       std::ostringstream os;
       const auto &label_property_index = label_property[global_index];
-      DumpLabelPropertyIndex(&os, dba_, label_property_index.first, label_property_index.second);
+      const auto using_hash =
+          std::ranges::find(label_property_hash, label_property_index) != label_property_hash.end();
+      DumpLabelPropertyIndex(&os, dba_, label_property_index.first, label_property_index.second, using_hash);
       stream->Result({TypedValue(os.str())});
 
       ++global_index;
@@ -2296,6 +2296,8 @@ class IndexQuery : public memgraph::query::Query {
   memgraph::query::IndexQuery::Action action_;
   memgraph::query::LabelIx label_;
   std::vector<memgraph::query::PropertyIx> properties_;
+  /// Set by `CREATE INDEX ... USING HASH`.
+  bool using_hash_{false};
 
   IndexQuery *Clone(AstStorage *storage) const override {
     IndexQuery *object = storage->Create<IndexQuery>();
@@ -2305,6 +2307,7 @@ class IndexQuery : public memgraph::query::Query {
     for (auto i = 0; i < object->properties_.size(); ++i) {
       object->properties_[i] = storage->GetPropertyIx(properties_[i].name);
     }
+    object->using_hash_ = using_hash_;
     return object;
   }
 
@@ -3146,7 +3149,7 @@ class DatabaseInfoQuery : public memgraph::query::Query {
   static const utils::TypeInfo kType;
   const utils::TypeInfo &GetTypeInfo() const override { return kType; }
 
-  enum class InfoType { INDEX, CONSTRAINT, EDGE_TYPES, NODE_LABELS, METRICS };
+  enum class InfoType { INDEX, CONSTRAINT, EDGE_TYPES, NODE_LABELS, METRICS, QUERY_STATS };
 
   DEFVISITABLE(QueryVisitor<void>);
 
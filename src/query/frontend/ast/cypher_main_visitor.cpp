@@ -130,6 +130,10 @@ antlrcpp::Any CypherMainVisitor::visitDatabaseInfoQuery(MemgraphCypher::Database
     info_query->info_type_ = DatabaseInfoQuery::InfoType::METRICS;
     return info_query;
   }
+  if (ctx->queryStatsInfo()) {
+    info_query->info_type_ = DatabaseInfoQuery::InfoType::QUERY_STATS;
+    return info_query;
+  }
   // Should never get here
   throw utils::NotYetImplemented("Database info query: '{}'", ctx->getText());
 }
@@ -357,6 +361,7 @@ antlrcpp::Any CypherMainVisitor::visitCreateIndex(MemgraphCypher::CreateIndexCon
     auto name_key = std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this));
     index_query->properties_ = {name_key};
   }
+  index_query->using_hash_ = ctx->HASH() != nullptr;
   return index_query;
 }
 
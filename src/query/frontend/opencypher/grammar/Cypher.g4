@@ -56,9 +56,11 @@ nodelabelInfo : NODE_LABELS INFO ;
 
 metricsInfo : METRICS INFO ;
 
+queryStatsInfo : QUERY STATS ;
+
 buildInfo : BUILD INFO ;
 
-databaseInfoQuery : SHOW ( indexInfo | constraintInfo | edgetypeInfo | nodelabelInfo | metricsInfo ) ;
+databaseInfoQuery : SHOW ( indexInfo | constraintInfo | edgetypeInfo | nodelabelInfo | metricsInfo | queryStatsInfo ) ;
 
 systemInfoQuery : SHOW ( storageInfo | buildInfo | activeUsersInfo ) ;
 
@@ -84,6 +84,7 @@ memgraphCypherKeyword : cypherKeyword
                       | GRANT
                       | GRANTS
                       | GRAPH
+                      | HASH
                       | HEADER
                       | IDENTIFIED
                       | IF
@@ -639,6 +640,8 @@ dropTextIndex : DROP TEXT INDEX indexName ;
 
 textIndexQuery : createTextIndex | dropTextIndex;
 
+createIndex : CREATE INDEX ON ':' labelName ( '(' propertyKeyName ')' ( USING HASH )? )? ;
+
 createPointIndex : CREATE POINT INDEX ON ':' labelName '(' propertyKeyName ')';
 
 dropPointIndex : DROP POINT INDEX ON ':' labelName '(' propertyKeyName ')' ;
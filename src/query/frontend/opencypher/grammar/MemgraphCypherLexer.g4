@@ -86,6 +86,7 @@ GLOBAL                  : G L O B A L ;
 GRANT                   : G R A N T ;
 GRANTS                  : G R A N T S ;
 GRAPH                   : G R A P H ;
+HASH                    : H A S H ;
 HEADER                  : H E A D E R ;
 HOPS                    : H O P S ;
 IDENTIFIED              : I D E N T I F I E D ;
@@ -58,6 +58,7 @@ class PrivilegeExtractor : public QueryVisitor<void>, public HierarchicalTreeVis
         AddPrivilege(AuthQuery::Privilege::CONSTRAINT);
         break;
       case DatabaseInfoQuery::InfoType::METRICS:
+      case DatabaseInfoQuery::InfoType::QUERY_STATS:
         AddPrivilege(AuthQuery::Privilege::STATS);
         break;
     }
@@ -179,6 +179,7 @@ const trie::Trie kKeywords = {"active",
                               "grant",
                               "grants",
                               "graph",
+                              "hash",
                               "header",
                               "identifed",
                               "if",
@@ -19,6 +19,8 @@
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <exception>
 #include <functional>
 #include <iterator>
 #include <limits>
@@ -77,6 +79,7 @@
 #include "query/procedure/module.hpp"
 #include "query/query_user.hpp"
 #include "query/replication_query_handler.hpp"
+#include "query/slow_query_log.hpp"
 #include "query/stream.hpp"
 #include "query/stream/common.hpp"
 #include "query/stream/sources.hpp"
@@ -1984,13 +1987,23 @@ struct PullPlan {
                     std::optional<QueryLogger> &query_logger,
                     TriggerContextCollector *trigger_context_collector = nullptr,
                     std::optional<size_t> memory_limit = {}, FrameChangeCollector *frame_change_collector_ = nullptr,
-                    std::optional<int64_t> hops_limit = {});
+                    std::optional<int64_t> hops_limit = {}, bool sample_runtime_stats = false);
 
   std::optional<plan::ProfilingStatsWithTotalTime> Pull(AnyStream *stream, std::optional<int> n,
                                                         const std::vector<Symbol> &output_symbols,
                                                         std::map<std::string, TypedValue> *summary);
 
+  void Prefetch(int n, const std::vector<Symbol> &output_symbols) noexcept;
+
  private:
+  // Upper bound on the number of results held by a single prefetch.
+  static constexpr int kMaxPrefetchedResults = 10000;
+
+  utils::OnScopeExit<std::function<void()>> TrackMemory(uint64_t transaction_id);
+
+  // Returns true if a result was pulled.
+  bool PullResult();
+
   std::shared_ptr<PlanWrapper> plan_ = nullptr;
   plan::UniqueCursorPtr cursor_ = nullptr;
   Frame frame_;
@@ -1999,6 +2012,10 @@ struct PullPlan {
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
   std::optional<QueryLogger> &query_logger_;
 
+  // The profiling statistics of a sampled execution are added to the
+  // runtime statistics of its plan.
+  bool sample_runtime_stats_ = false;
+
   // As it's possible to query execution using multiple pulls
   // we need the keep track of the total execution time across
   // those pulls by accumulating the execution time.
@@ -2011,6 +2028,17 @@ struct PullPlan {
   // we have to keep track of any unsent results from previous `PullPlan::Pull`
   // manually by using this flag.
   bool has_unsent_results_ = false;
+
+  // The cursor may not be pulled again once it runs out of results.
+  bool cursor_exhausted_ = false;
+
+  // Results pulled ahead of time by `Prefetch`. They are streamed before the
+  // unsent results from the frame.
+  std::deque<std::vector<TypedValue>> prefetched_results_;
+
+  // Error which occurred during `Prefetch`, rethrown after all of the
+  // prefetched results are streamed.
+  std::exception_ptr prefetch_error_;
 };
 
 PullPlan::PullPlan(const std::shared_ptr<PlanWrapper> plan, const Parameters &parameters, const bool is_profile_query,
@@ -2019,12 +2047,13 @@ PullPlan::PullPlan(const std::shared_ptr<PlanWrapper> plan, const Parameters &pa
                    std::shared_ptr<utils::AsyncTimer> tx_timer, DatabaseAccessProtector db_acc,
                    std::optional<QueryLogger> &query_logger, TriggerContextCollector *trigger_context_collector,
                    const std::optional<size_t> memory_limit, FrameChangeCollector *frame_change_collector,
-                   const std::optional<int64_t> hops_limit)
+                   const std::optional<int64_t> hops_limit, const bool sample_runtime_stats)
     : plan_(plan),
       cursor_(plan->plan().MakeCursor(execution_memory)),
       frame_(plan->symbol_table().max_position(), execution_memory),
       memory_limit_(memory_limit),
-      query_logger_(query_logger) {
+      query_logger_(query_logger),
+      sample_runtime_stats_(sample_runtime_stats) {
   ctx_.hops_limit = query::HopsLimit{hops_limit};
   ctx_.db_accessor = dba;
   ctx_.symbol_table = plan->symbol_table();
@@ -2062,23 +2091,9 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
   std::optional<uint64_t> transaction_id = ctx_.db_accessor->GetTransactionId();
   MG_ASSERT(transaction_id.has_value());
 
-  if (memory_limit_) {
-    memgraph::memory::TryStartTrackingOnTransaction(*transaction_id, *memory_limit_);
-    memgraph::memory::StartTrackingCurrentThreadTransaction(*transaction_id);
-  }
-  utils::OnScopeExit<std::function<void()>> reset_query_limit{
-      [memory_limit = memory_limit_, transaction_id = *transaction_id]() {
-        if (memory_limit) {
-          // Stopping tracking of transaction occurs in interpreter::pull
-          // Exception can occur so we need to handle that case there.
-          // We can't stop tracking here as there can be multiple pulls
-          // so we need to take care of that after everything was pulled
-          memgraph::memory::StopTrackingCurrentThreadTransaction(transaction_id);
-        }
-      }};
+  auto reset_query_limit = TrackMemory(*transaction_id);
 
-  // Returns true if a result was pulled.
-  const auto pull_result = [&]() -> bool { return cursor_->Pull(frame_, ctx_); };
+  const auto pull_result = [&]() -> bool { return PullResult(); };
 
   auto values = std::vector<TypedValue>(output_symbols.size());
   const auto stream_values = [&] {
@@ -2092,6 +2107,19 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
   utils::Timer timer;
 
   int i = 0;
+  // stream results prefetched since the previous pull
+  for (; !prefetched_results_.empty() && (!n || i < *n); ++i) {
+    stream->Result(prefetched_results_.front());
+    prefetched_results_.pop_front();
+  }
+  if (!prefetched_results_.empty() || (has_unsent_results_ && n && i == *n)) {
+    execution_time_ += timer.Elapsed();
+    return std::nullopt;
+  }
+  if (prefetch_error_) {
+    std::rethrow_exception(std::exchange(prefetch_error_, nullptr));
+  }
+
   if (has_unsent_results_ && !output_symbols.empty()) {
     // stream unsent results from previous pull
     stream_values();
@@ -2155,6 +2183,10 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
 
   auto stats_and_total_time = GetStatsWithTotalTime(ctx_);
 
+  if (sample_runtime_stats_) {
+    plan_->runtime_stats().Add(stats_and_total_time);
+  }
+
   if (query_logger_) {
     query_logger_->trace(fmt::format("Profile plan\n{}", ProfilingStatsToJson(stats_and_total_time).dump()));
   }
@@ -2162,6 +2194,70 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
   return stats_and_total_time;
 }
 
+void PullPlan::Prefetch(int n, const std::vector<Symbol> &output_symbols) noexcept {
+  // Only the results left over in the frame by the previous pull are moved
+  // into the buffer, so there is nothing to do once the cursor is exhausted.
+  if (!has_unsent_results_ || output_symbols.empty() || prefetch_error_ || !prefetched_results_.empty()) {
+    return;
+  }
+
+  const auto buffer_values = [&] {
+    auto &values = prefetched_results_.emplace_back(output_symbols.size());
+    for (auto const i : ranges::views::iota(0UL, output_symbols.size())) {
+      values[i] = frame_[output_symbols[i]];
+    }
+  };
+
+  utils::Timer timer;
+  const auto limit = static_cast<size_t>(std::min(n, kMaxPrefetchedResults));
+  // The summary of the previous pull is already sent, so nothing may escape.
+  // The error is rethrown by the next `Pull` and goes through the same error
+  // handling as any other failed pull.
+  try {
+    std::optional<uint64_t> transaction_id = ctx_.db_accessor->GetTransactionId();
+    MG_ASSERT(transaction_id.has_value());
+
+    // Prefetched results are allocated while tracking the transaction, so they
+    // count towards the query memory limit.
+    auto reset_query_limit = TrackMemory(*transaction_id);
+
+    buffer_values();
+    has_unsent_results_ = false;
+    while (prefetched_results_.size() < limit && PullResult()) {
+      buffer_values();
+    }
+    // Same as in `Pull`, leave the next result in the frame so we know whether
+    // there are more results after the prefetched ones.
+    has_unsent_results_ = prefetched_results_.size() == limit && PullResult();
+  } catch (...) {
+    has_unsent_results_ = false;
+    prefetch_error_ = std::current_exception();
+  }
+  execution_time_ += timer.Elapsed();
+}
+
+utils::OnScopeExit<std::function<void()>> PullPlan::TrackMemory(uint64_t transaction_id) {
+  if (memory_limit_) {
+    memgraph::memory::TryStartTrackingOnTransaction(transaction_id, *memory_limit_);
+    memgraph::memory::StartTrackingCurrentThreadTransaction(transaction_id);
+  }
+  return utils::OnScopeExit<std::function<void()>>{[memory_limit = memory_limit_, transaction_id]() {
+    if (memory_limit) {
+      // Stopping tracking of transaction occurs in interpreter::pull
+      // Exception can occur so we need to handle that case there.
+      // We can't stop tracking here as there can be multiple pulls
+      // so we need to take care of that after everything was pulled
+      memgraph::memory::StopTrackingCurrentThreadTransaction(transaction_id);
+    }
+  }};
+}
+
+bool PullPlan::PullResult() {
+  if (cursor_exhausted_) return false;
+  cursor_exhausted_ = !cursor_->Pull(frame_, ctx_);
+  return !cursor_exhausted_;
+}
+
 using RWType = plan::ReadWriteTypeChecker::RWType;
 
 bool IsQueryWrite(const query::plan::ReadWriteTypeChecker::RWType query_type) {
@@ -2350,6 +2446,14 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
   if (interpreter.IsQueryLoggingActive()) {
     is_profile_query = true;
   }
+  // Sampled executions collect the same statistics as PROFILE, which are then
+  // aggregated per plan and shown by SHOW QUERY STATS.
+  const bool sample_runtime_stats =
+      parsed_query.is_cacheable &&
+      plan->runtime_stats().SampleNextExecution(static_cast<uint64_t>(FLAGS_query_stats_sample_rate));
+  if (sample_runtime_stats) {
+    plan->runtime_stats().SetQuery(parsed_query.stripped_query.query());
+  }
 
   auto rw_type_checker = plan::ReadWriteTypeChecker();
   rw_type_checker.InferRWType(const_cast<plan::LogicalOperator &>(plan->plan()));
@@ -2370,19 +2474,35 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
   auto *trigger_context_collector =
       current_db.trigger_context_collector_ ? &*current_db.trigger_context_collector_ : nullptr;
   auto pull_plan = std::make_shared<PullPlan>(
-      plan, parsed_query.parameters, is_profile_query, dba, interpreter_context, execution_memory,
-      std::move(user_or_role), transaction_status, std::move(tx_timer), current_db.db_acc_, interpreter.query_logger_,
-      trigger_context_collector, memory_limit,
-      frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr, hops_limit);
-  return PreparedQuery{std::move(header), std::move(parsed_query.required_privileges),
-                       [pull_plan = std::move(pull_plan), output_symbols = std::move(output_symbols), summary](
-                           AnyStream *stream, std::optional<int> n) -> std::optional<QueryHandlerResult> {
-                         if (pull_plan->Pull(stream, n, output_symbols, summary)) {
-                           return QueryHandlerResult::COMMIT;
-                         }
-                         return std::nullopt;
-                       },
-                       rw_type_checker.type};
+      plan, parsed_query.parameters, is_profile_query || sample_runtime_stats, dba, interpreter_context,
+      execution_memory, std::move(user_or_role), transaction_status, std::move(tx_timer), current_db.db_acc_,
+      interpreter.query_logger_, trigger_context_collector, memory_limit,
+      frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr, hops_limit, sample_runtime_stats);
+  auto prepared_query = PreparedQuery{std::move(header), std::move(parsed_query.required_privileges),
+                                      [pull_plan, output_symbols, summary](
+                                          AnyStream *stream, std::optional<int> n) -> std::optional<QueryHandlerResult> {
+                                        if (pull_plan->Pull(stream, n, output_symbols, summary)) {
+                                          return QueryHandlerResult::COMMIT;
+                                        }
+                                        return std::nullopt;
+                                      },
+                                      rw_type_checker.type};
+  // Pulling ahead of the client would apply the side effects of write
+  // queries before the client asked for them, so only reads are prefetched.
+  if (rw_type_checker.type == RWType::R) {
+    prepared_query.prefetch_handler = [pull_plan = std::move(pull_plan),
+                                       output_symbols = std::move(output_symbols)](int n) {
+      pull_plan->Prefetch(n, output_symbols);
+    };
+  }
+  if (interpreter_context->slow_query_log) {
+    prepared_query.describe_plan = [plan, dba] {
+      std::stringstream printed_plan;
+      plan::PrettyPrint(*dba, &plan->plan(), &printed_plan);
+      return printed_plan.str();
+    };
+  }
+  return prepared_query;
 }
 
 PreparedQuery PrepareExplainQuery(ParsedQuery parsed_query, std::map<std::string, TypedValue> *summary,
@@ -2912,9 +3032,12 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
       // TODO: not just storage + invalidate_plan_cache. Need a DB transaction (for replication)
       handler = [dba, label, properties_stringified = std::move(properties_stringified),
                  label_name = index_query->label_.name, properties = std::move(properties),
+                 using_hash = index_query->using_hash_,
                  invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
         MG_ASSERT(properties.size() <= 1U);
-        auto maybe_index_error = properties.empty() ? dba->CreateIndex(label) : dba->CreateIndex(label, properties[0]);
+        auto maybe_index_error = properties.empty() ? dba->CreateIndex(label)
+                                 : using_hash       ? dba->CreateHashIndex(label, properties[0])
+                                                    : dba->CreateIndex(label, properties[0]);
         utils::OnScopeExit invalidator(invalidate_plan_cache);
 
         if (maybe_index_error.HasError()) {
@@ -4199,6 +4322,7 @@ PreparedQuery PrepareDatabaseInfoQuery(ParsedQuery parsed_query, bool in_explici
         auto *storage = database->storage();
         const std::string_view label_index_mark{"label"};
         const std::string_view label_property_index_mark{"label+property"};
+        const std::string_view label_property_hash_index_mark{"label+property (hash)"};
         const std::string_view edge_type_index_mark{"edge-type"};
         const std::string_view edge_type_property_index_mark{"edge-type+property"};
         const std::string_view text_index_mark{"text"};
@@ -4212,8 +4336,10 @@ PreparedQuery PrepareDatabaseInfoQuery(ParsedQuery parsed_query, bool in_explici
                              TypedValue(static_cast<int>(storage_acc->ApproximateVertexCount(item)))});
         }
         for (const auto &item : info.label_property) {
+          const auto is_hash = std::ranges::find(info.label_property_hash, item) != info.label_property_hash.end();
           results.push_back(
-              {TypedValue(label_property_index_mark), TypedValue(storage->LabelToName(item.first)),
+              {TypedValue(is_hash ? label_property_hash_index_mark : label_property_index_mark),
+               TypedValue(storage->LabelToName(item.first)),
                TypedValue(storage->PropertyToName(item.second)),
                TypedValue(static_cast<int>(storage_acc->ApproximateVertexCount(item.first, item.second)))});
         }
@@ -4363,6 +4489,30 @@ PreparedQuery PrepareDatabaseInfoQuery(ParsedQuery parsed_query, bool in_explici
 
       break;
     }
+    case DatabaseInfoQuery::InfoType::QUERY_STATS: {
+      header = {"query",       "executions",    "sampled executions", "operator",
+                "actual hits", "relative time", "absolute time"};
+      handler = [plan_cache = current_db.db_acc_->get()->plan_cache()] {
+        std::vector<std::shared_ptr<PlanWrapper>> plans;
+        plan_cache->WithLock([&plans](auto &cache) {
+          cache.for_each([&plans](const auto & /*hash*/, const auto &plan) { plans.push_back(plan); });
+        });
+        std::vector<std::vector<TypedValue>> results;
+        for (const auto &plan : plans) {
+          auto summary = plan->runtime_stats().GetSummary();
+          if (!summary) continue;
+          for (auto &operator_row : plan::ProfilingStatsToTable(summary->average)) {
+            std::vector<TypedValue> row{TypedValue(summary->query),
+                                        TypedValue(static_cast<int64_t>(summary->executions)),
+                                        TypedValue(static_cast<int64_t>(summary->sampled_executions))};
+            std::move(operator_row.begin(), operator_row.end(), std::back_inserter(row));
+            results.push_back(std::move(row));
+          }
+        }
+        return std::pair{results, QueryHandlerResult::COMMIT};
+      };
+      break;
+    }
   }
 
   return PreparedQuery{std::move(header), std::move(parsed_query.required_privileges),
@@ -5281,6 +5431,17 @@ PreparedQuery PrepareShowSchemaInfoQuery(const ParsedQuery &parsed_query, Curren
 
 std::optional<uint64_t> Interpreter::GetTransactionId() const { return current_transaction_; }
 
+void Interpreter::Prefetch(int n, std::optional<int> qid) noexcept {
+  const int qid_value = qid ? *qid : static_cast<int>(query_executions_.size() - 1);
+  if (qid_value < 0 || qid_value >= query_executions_.size() || n <= 0) return;
+
+  auto &query_execution = query_executions_[qid_value];
+  if (!query_execution || !query_execution->prepared_query || !query_execution->prepared_query->prefetch_handler) {
+    return;
+  }
+  query_execution->prepared_query->prefetch_handler(n);
+}
+
 void Interpreter::BeginTransaction(QueryExtras const &extras) {
   ResetInterpreter();
   const auto prepared_query = PrepareTransactionQuery("BEGIN", extras);
@@ -5402,6 +5563,9 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
         in_explicit_transaction_ ? static_cast<int>(query_executions_.size() - 1) : std::optional<int>{};
 
     query_execution->summary["parsing_time"] = parsing_time;
+    if (interpreter_context_->slow_query_log) {
+      query_execution->query_string = query_string;
+    }
     LogQueryMessage(fmt::format("Query parsing time: {}", parsing_time));
 
     // Set a default cost estimate of 0. Individual queries can overwrite this
@@ -5685,6 +5849,7 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
             query_execution->prepared_query->db};
   } catch (const utils::BasicException &e) {
     LogQueryMessage(fmt::format("Failed query: {}", e.what()));
+    if (query_execution_ptr && *query_execution_ptr) LogIfSlow(**query_execution_ptr, e.what());
     // Trigger first failed query
     metrics::FirstFailedQuery();
     memgraph::metrics::IncrementCounter(memgraph::metrics::FailedQuery);
@@ -5694,6 +5859,49 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
   }
 }
 
+void Interpreter::LogIfSlow(QueryExecution &query_execution, std::optional<std::string_view> error) {
+  auto *slow_query_log = interpreter_context_->slow_query_log;
+  if (!slow_query_log) return;
+
+  const auto summary_value = [&summary = query_execution.summary](const std::string &key) -> std::optional<double> {
+    auto it = summary.find(key);
+    if (it == summary.end() || !it->second.IsNumeric()) return std::nullopt;
+    return it->second.IsDouble() ? it->second.ValueDouble() : static_cast<double>(it->second.ValueInt());
+  };
+  // The timer is started after the query is parsed.
+  const auto parsing_time = summary_value("parsing_time");
+  const auto total_time = query_execution.timer.Elapsed().count() + parsing_time.value_or(0);
+  if (!slow_query_log->IsSlow(std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::duration<double>(total_time)))) {
+    return;
+  }
+
+  const auto db_name = current_db_.name();
+  SlowQueryLogEntry entry{.query = query_execution.query_string,
+                          .db = db_name,
+                          .transaction_id = current_transaction_,
+                          .parsing_time = parsing_time,
+                          .planning_time = summary_value("planning_time"),
+                          .execution_time = summary_value("plan_execution_time"),
+                          .total_time = total_time,
+                          .results = query_execution.num_results,
+                          .error = error};
+  if (user_or_role_ && *user_or_role_) {
+    entry.username = user_or_role_->username();
+  }
+  if (auto hops = query_execution.summary.find("number_of_hops");
+      hops != query_execution.summary.end() && hops->second.IsInt()) {
+    entry.number_of_hops = hops->second.ValueInt();
+  }
+  if (current_transaction_) {
+    entry.peak_memory = memory::GetTransactionPeakMemory(*current_transaction_);
+  }
+  if (query_execution.prepared_query && query_execution.prepared_query->describe_plan) {
+    entry.plan = query_execution.prepared_query->describe_plan();
+  }
+  slow_query_log->Record(entry);
+}
+
 void Interpreter::SetupDatabaseTransaction(bool couldCommit, bool unique) {
   current_db_.SetupDatabaseTransaction(GetIsolationLevelOverride(), couldCommit, unique);
 }
@@ -43,6 +43,7 @@
 #include "storage/v2/storage.hpp"
 #include "utils/event_counter.hpp"
 #include "utils/event_trigger.hpp"
+#include "utils/labeled_histogram.hpp"
 #include "utils/logging.hpp"
 #include "utils/memory.hpp"
 #include "utils/settings.hpp"
@@ -198,6 +199,11 @@ struct PreparedQuery {
   std::function<std::optional<QueryHandlerResult>(AnyStream *stream, std::optional<int> n)> query_handler;
   plan::ReadWriteTypeChecker::RWType rw_type;
   std::optional<std::string> db{};
+  // Pulls up to `n` of the next results ahead of time, so they are ready when
+  // the client asks for them. Not set for queries which can't be prefetched.
+  std::function<void(int n)> prefetch_handler{};
+  // Prints the plan used by the query. Not set for queries without a plan.
+  std::function<std::string()> describe_plan{};
 };
 
 /**
@@ -354,6 +360,18 @@ class Interpreter final {
   std::map<std::string, TypedValue> Pull(TStream *result_stream, std::optional<int> n = {},
                                          std::optional<int> qid = {});
 
+  /**
+   * Prepare up to `n` of the next results of a partially pulled query, so the
+   * following `Pull` can stream them right away. Does nothing once the query
+   * has no more results. Errors that occur while prefetching are rethrown by
+   * that `Pull` and handled like its own errors.
+   *
+   * @param n Number of results the client is expected to pull next.
+   * @param qid If set, defines from which query to prefetch the results,
+   * otherwise the last query is used.
+   */
+  void Prefetch(int n, std::optional<int> qid = {}) noexcept;
+
   void BeginTransaction(QueryExtras const &extras = {});
 
   std::optional<uint64_t> GetTransactionId() const;
@@ -404,6 +422,9 @@ class Interpreter final {
     std::optional<PreparedQuery> prepared_query;
     std::map<std::string, TypedValue> summary;
     std::vector<Notification> notifications;
+    utils::Timer timer;  // Started when the query is prepared, used for latency metrics
+    uint64_t num_results{0};
+    std::string query_string;  // Kept only when the slow query log is enabled
 
     static auto Create() -> std::unique_ptr<QueryExecution> { return std::make_unique<QueryExecution>(); }
 
@@ -461,6 +482,10 @@ class Interpreter final {
   std::optional<std::function<void(std::string_view)>> on_change_{};
   void SetupInterpreterTransaction(const QueryExtras &extras);
   void SetupDatabaseTransaction(bool couldCommit, bool unique = false);
+
+  // Records the finished query in the slow query log if it took too long,
+  // `error` is set for queries that failed.
+  void LogIfSlow(QueryExecution &query_execution, std::optional<std::string_view> error = std::nullopt);
 };
 
 template <typename TStream>
@@ -485,11 +510,14 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
   // it after it finishes executing because it gets destroyed alongside
   // the prepared query and its execution memory.
   std::optional<std::map<std::string, TypedValue>> maybe_summary;
+  // Failed queries are logged as well, unless they failed after being logged
+  bool logged_if_slow = false;
   try {
     // Wrap the (statically polymorphic) stream type into a common type which
     // the handler knows.
     AnyStream stream{result_stream, query_execution->execution_memory.resource()};
     const auto maybe_res = query_execution->prepared_query->query_handler(&stream, n);
+    query_execution->num_results += stream.NumResults();
     // Stream is using execution memory of the query_execution which
     // can be deleted after its execution so the stream should be cleared
     // first.
@@ -498,9 +526,16 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
     // If the query finished executing, we have received a value which tells
     // us what to do after.
     if (maybe_res) {
+      LogIfSlow(*query_execution);
+      logged_if_slow = true;
       if (current_transaction_) {
         memgraph::memory::TryStopTrackingOnTransaction(*current_transaction_);
       }
+      if (auto type = query_execution->summary.find("type");
+          type != query_execution->summary.end() && type->second.IsString()) {
+        memgraph::metrics::MeasureQueryLatency(current_db_.name(), type->second.ValueString(),
+                                               query_execution->timer.Elapsed<std::chrono::microseconds>().count());
+      }
       // Save its summary
       maybe_summary.emplace(std::move(query_execution->summary));
       if (!query_execution->notifications.empty()) {
@@ -539,6 +574,7 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
     }
   } catch (const ExplicitTransactionUsageException &e) {
     LogQueryMessage(e.what());
+    if (query_execution && !logged_if_slow) LogIfSlow(*query_execution, e.what());
     if (current_transaction_) {
       memgraph::memory::TryStopTrackingOnTransaction(*current_transaction_);
     }
@@ -546,6 +582,7 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
     throw;
   } catch (const utils::BasicException &e) {
     LogQueryMessage(e.what());
+    if (query_execution && !logged_if_slow) LogIfSlow(*query_execution, e.what());
     if (current_transaction_) {
       memgraph::memory::TryStopTrackingOnTransaction(*current_transaction_);
     }
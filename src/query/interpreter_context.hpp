@@ -49,6 +49,7 @@ constexpr uint64_t kInterpreterTransactionInitialId = 1ULL << 63U;
 class AuthQueryHandler;
 class AuthChecker;
 class Interpreter;
+class SlowQueryLog;
 struct QueryUserOrRole;
 
 /**
@@ -75,6 +76,9 @@ struct InterpreterContext {
   ReplicationQueryHandler *replication_handler_;
   system::System *system_;
 
+  // Not set when the slow query log is disabled.
+  SlowQueryLog *slow_query_log{nullptr};
+
   // Used to check active transactions
   // TODO: Have a way to read the current database
   memgraph::utils::Synchronized<std::unordered_set<Interpreter *>, memgraph::utils::SpinLock> interpreters;
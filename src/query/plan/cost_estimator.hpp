@@ -305,6 +305,21 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PostVisit(IntersectExpand &expand) override {
+    auto card_param = CardParam::kExpand;
+    auto stats = GetStatsFor(expand.input_symbol_);
+
+    if (stats.has_value()) {
+      card_param = stats.value().degree;
+    }
+
+    // Only the neighbours adjacent to the anchor as well are produced
+    cardinality_ *= card_param * CardParam::kFilter;
+    IncrementCost(CostParam::kExpand);
+
+    return true;
+  }
+
 // For the given op first increments the cardinality and then cost.
 #define POST_VISIT_CARD_FIRST(NAME)     \
   bool PostVisit(NAME &) override {     \
@@ -57,6 +57,10 @@ class PlanHintsProvider final : public HierarchicalLogicalOperatorVisitor {
 
   bool PostVisit(Expand & /*expand*/) override { return true; }
 
+  bool PreVisit(IntersectExpand & /*unused*/) override { return true; }
+
+  bool PostVisit(IntersectExpand & /*unused*/) override { return true; }
+
   bool PreVisit(ExpandVariable & /*unused*/) override { return true; }
 
   bool PostVisit(ExpandVariable & /*unused*/) override { return true; }
@@ -219,6 +223,9 @@ class PlanHintsProvider final : public HierarchicalLogicalOperatorVisitor {
   }
   bool PostVisit(HashJoin & /*unused*/) override { return true; }
 
+  bool PreVisit(JoinKeyFilter & /*unused*/) override { return true; }
+  bool PostVisit(JoinKeyFilter & /*unused*/) override { return true; }
+
   bool PreVisit(IndexedJoin &op) override {
     op.main_branch_->Accept(*this);
     op.sub_branch_->Accept(*this);
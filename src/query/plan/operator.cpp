@@ -54,6 +54,7 @@
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/view.hpp"
 #include "utils/algorithm.hpp"
+#include "utils/bloom_filter.hpp"
 #include "utils/event_counter.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/fnv.hpp"
@@ -206,6 +207,45 @@ std::vector<storage::LabelId> EvaluateLabels(const std::vector<StorageLabelType>
   return result;
 }
 
+// Values of a fixed set of symbols for the rows an operator buffers, stored
+// row after row in a single buffer. Only the symbols that are restored later
+// are kept, instead of copying the whole frame with every row.
+class FrameRows {
+ public:
+  FrameRows(const std::vector<Symbol> &symbols, utils::MemoryResource *memory) : symbols_(&symbols), values_(memory) {}
+
+  void Push(const Frame &frame) {
+    for (const auto &symbol : *symbols_) values_.emplace_back(frame[symbol]);
+    ++size_;
+  }
+
+  // Places the values of the given row back on the frame.
+  void Restore(size_t row, Frame &frame, const ExecutionContext &context) const {
+    DMG_ASSERT(row < size_, "Restoring a row that wasn't buffered.");
+    auto value_it = values_.begin() + static_cast<std::ptrdiff_t>(row * symbols_->size());
+    for (const auto &symbol : *symbols_) {
+      frame[symbol] = *value_it++;
+      if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
+        context.frame_change_collector->ResetTrackingValue(symbol.name());
+      }
+    }
+  }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  void clear() {
+    values_.clear();
+    size_ = 0;
+  }
+
+ private:
+  const std::vector<Symbol> *symbols_;
+  utils::pmr::vector<TypedValue> values_;
+  // Kept separately since there might be no symbols to store
+  size_t size_{0};
+};
+
 }  // namespace
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
@@ -1340,6 +1380,181 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
   }
 }
 
+IntersectExpand::IntersectExpand(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol,
+                                 ExpandCommon common, Symbol anchor_symbol, ExpandCommon closing, storage::View view)
+    : input_(input ? input : std::make_shared<Once>()),
+      input_symbol_(std::move(input_symbol)),
+      common_(std::move(common)),
+      anchor_symbol_(std::move(anchor_symbol)),
+      closing_(std::move(closing)),
+      view_(view) {
+  DMG_ASSERT(!common_.existing_node && closing_.node_symbol == common_.node_symbol,
+             "IntersectExpand must bind the node it closes the cycle with");
+}
+
+ACCEPT_WITH_INPUT(IntersectExpand)
+
+std::vector<Symbol> IntersectExpand::ModifiedSymbols(const SymbolTable &table) const {
+  auto symbols = input_->ModifiedSymbols(table);
+  symbols.emplace_back(common_.node_symbol);
+  symbols.emplace_back(common_.edge_symbol);
+  symbols.emplace_back(closing_.edge_symbol);
+  return symbols;
+}
+
+std::string IntersectExpand::ToString() const {
+  auto edge_types_string = [this](const auto &edge_types) {
+    return utils::IterableToString(edge_types, "|",
+                                   [this](const auto &edge_type) { return ":" + dba_->EdgeTypeToName(edge_type); });
+  };
+  // The closing edge is printed from the new node towards the anchor
+  return fmt::format("IntersectExpand ({}){}[{}{}]{}({}){}[{}{}]{}({})", input_symbol_.name(),
+                     common_.direction == query::EdgeAtom::Direction::IN ? "<-" : "-", common_.edge_symbol.name(),
+                     edge_types_string(common_.edge_types),
+                     common_.direction == query::EdgeAtom::Direction::OUT ? "->" : "-", common_.node_symbol.name(),
+                     closing_.direction == query::EdgeAtom::Direction::OUT ? "<-" : "-", closing_.edge_symbol.name(),
+                     edge_types_string(closing_.edge_types),
+                     closing_.direction == query::EdgeAtom::Direction::IN ? "->" : "-", anchor_symbol_.name());
+}
+
+namespace {
+
+// Calls `f(edge, other_node)` for each edge of `vertex` in the given direction.
+// Like in Expand, a loop is visited only once when expanding in both
+// directions.
+template <class TFunc>
+void ForEachExpansion(const VertexAccessor &vertex, EdgeAtom::Direction direction,
+                      const std::vector<storage::EdgeTypeId> &edge_types, storage::View view,
+                      ExecutionContext &context, const TFunc &f) {
+  if (direction == EdgeAtom::Direction::IN || direction == EdgeAtom::Direction::BOTH) {
+    auto edges_result = UnwrapEdgesResult(vertex.InEdges(view, edge_types, &context.hops_limit));
+    context.number_of_hops += edges_result.expanded_count;
+    for (const auto &edge : edges_result.edges) f(edge, edge.From());
+  }
+  if (direction == EdgeAtom::Direction::OUT || direction == EdgeAtom::Direction::BOTH) {
+    auto edges_result = UnwrapEdgesResult(vertex.OutEdges(view, edge_types, &context.hops_limit));
+    context.number_of_hops += edges_result.expanded_count;
+    for (const auto &edge : edges_result.edges) {
+      if (direction == EdgeAtom::Direction::BOTH && edge.IsCycle()) continue;
+      f(edge, edge.To());
+    }
+  }
+}
+
+class IntersectExpandCursor : public Cursor {
+ public:
+  IntersectExpandCursor(const IntersectExpand &self, utils::MemoryResource *mem)
+      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), edges_(mem), anchor_edges_(mem) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    while (true) {
+      AbortCheck(context);
+      if (closing_edges_ && closing_edges_pos_ < closing_edges_->size()) {
+        const auto &[edge, node] = edges_[edges_pos_ - 1];
+        frame[self_.common_.edge_symbol] = edge;
+        frame[self_.common_.node_symbol] = node;
+        frame[self_.closing_.edge_symbol] = (*closing_edges_)[closing_edges_pos_++];
+        return true;
+      }
+
+      if (edges_pos_ < edges_.size()) {
+        // Only the neighbours of the input node which are adjacent to the anchor as well are produced
+        auto found = anchor_edges_.find(edges_[edges_pos_++].second);
+        closing_edges_ = found != anchor_edges_.end() ? &found->second : nullptr;
+        closing_edges_pos_ = 0;
+        continue;
+      }
+
+      if (!PullInput(frame, context)) return false;
+    }
+  }
+
+  void Shutdown() override { input_cursor_->Shutdown(); }
+
+  void Reset() override {
+    input_cursor_->Reset();
+    edges_.clear();
+    edges_pos_ = 0;
+    closing_edges_ = nullptr;
+    anchor_.reset();
+    anchor_edges_.clear();
+  }
+
+ private:
+#ifdef MG_ENTERPRISE
+  bool CanRead(const EdgeAccessor &edge, const VertexAccessor &node, ExecutionContext &context) const {
+    return !license::global_license_checker.IsEnterpriseValidFast() || !context.auth_checker ||
+           (context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+            context.auth_checker->Has(node, self_.view_, memgraph::query::AuthQuery::FineGrainedPrivilege::READ));
+  }
+#endif
+
+  bool PullInput(Frame &frame, ExecutionContext &context) {
+    edges_.clear();
+    edges_pos_ = 0;
+    closing_edges_ = nullptr;
+    while (true) {
+      if (!input_cursor_->Pull(frame, context)) return false;
+
+      if (context.hops_limit.IsLimitReached()) return false;
+
+      const auto &vertex_value = frame[self_.input_symbol_];
+      const auto &anchor_value = frame[self_.anchor_symbol_];
+      // Nodes could be null if they are created by a failed optional match
+      if (vertex_value.IsNull() || anchor_value.IsNull()) continue;
+      ExpectType(self_.input_symbol_, vertex_value, TypedValue::Type::Vertex);
+      ExpectType(self_.anchor_symbol_, anchor_value, TypedValue::Type::Vertex);
+
+      const auto &anchor = anchor_value.ValueVertex();
+      if (anchor_ != anchor) {
+        anchor_edges_.clear();
+        ForEachExpansion(anchor, self_.closing_.direction, self_.closing_.edge_types, self_.view_, context,
+                         [&](const EdgeAccessor &edge, const VertexAccessor &node) {
+#ifdef MG_ENTERPRISE
+                           if (!CanRead(edge, node, context)) return;
+#endif
+                           anchor_edges_[node].push_back(edge);
+                         });
+        anchor_ = anchor;
+      }
+      // No neighbour of the input node can close the cycle
+      if (anchor_edges_.empty()) continue;
+
+      ForEachExpansion(vertex_value.ValueVertex(), self_.common_.direction, self_.common_.edge_types, self_.view_,
+                       context, [&](const EdgeAccessor &edge, const VertexAccessor &node) {
+#ifdef MG_ENTERPRISE
+                         if (!CanRead(edge, node, context)) return;
+#endif
+                         edges_.emplace_back(edge, node);
+                       });
+      return true;
+    }
+  }
+
+  const IntersectExpand &self_;
+  const UniqueCursorPtr input_cursor_;
+  // Edges of the input node, with the nodes they lead to
+  utils::pmr::vector<std::pair<EdgeAccessor, VertexAccessor>> edges_;
+  size_t edges_pos_{0};
+  // Edges of the anchor, grouped by the nodes they lead to. Kept while the anchor stays the same.
+  std::optional<VertexAccessor> anchor_;
+  utils::pmr::unordered_map<VertexAccessor, utils::pmr::vector<EdgeAccessor>> anchor_edges_;
+  // Edges closing the cycle through the last visited neighbour of the input node
+  const utils::pmr::vector<EdgeAccessor> *closing_edges_{nullptr};
+  size_t closing_edges_pos_{0};
+};
+
+}  // namespace
+
+UniqueCursorPtr IntersectExpand::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ExpandOperator);
+
+  return MakeUniqueCursorPtr<IntersectExpandCursor>(mem, *this, mem);
+}
+
 ExpandVariable::ExpandVariable(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol, Symbol node_symbol,
                                Symbol edge_symbol, EdgeAtom::Type type, EdgeAtom::Direction direction,
                                const std::vector<storage::EdgeTypeId> &edge_types, bool is_reverse,
@@ -1418,12 +1633,62 @@ auto ExpandFromVertex(const VertexAccessor &vertex, EdgeAtom::Direction directio
   return iter::chain.from_iterable(std::move(chain_elements));
 }
 
+/**
+ * Edges of the path being expanded in depth-first order, with constant time
+ * push and pop. Edge-uniqueness is checked by scanning the path while it's
+ * short and through a set of the edge ids once it gets longer.
+ */
+class ExpansionPath {
+ public:
+  explicit ExpansionPath(utils::MemoryResource *memory) : edges_(memory), visited_(memory) {}
+
+  size_t size() const { return edges_.size(); }
+  const utils::pmr::vector<EdgeAccessor> &edges() const { return edges_; }
+
+  bool Contains(const EdgeAccessor &edge) const {
+    if (edges_.size() <= kLinearScanLimit) return std::find(edges_.begin(), edges_.end(), edge) != edges_.end();
+    return visited_.contains(edge.Gid());
+  }
+
+  void Push(const EdgeAccessor &edge) {
+    edges_.push_back(edge);
+    if (edges_.size() == kLinearScanLimit + 1) {
+      for (const auto &path_edge : edges_) visited_.insert(path_edge.Gid());
+    } else if (edges_.size() > kLinearScanLimit) {
+      visited_.insert(edge.Gid());
+    }
+  }
+
+  void Truncate(size_t size) {
+    while (edges_.size() > size) {
+      if (edges_.size() == kLinearScanLimit + 1) {
+        visited_.clear();
+      } else if (edges_.size() > kLinearScanLimit) {
+        visited_.erase(edges_.back().Gid());
+      }
+      edges_.pop_back();
+    }
+  }
+
+  void Clear() {
+    edges_.clear();
+    visited_.clear();
+  }
+
+ private:
+  static constexpr size_t kLinearScanLimit = 16;
+
+  utils::pmr::vector<EdgeAccessor> edges_;
+  // Ids of all the edges in the path once it's longer than the scan limit
+  utils::pmr::unordered_set<storage::Gid> visited_;
+};
+
 }  // namespace
 
 class ExpandVariableCursor : public Cursor {
  public:
   ExpandVariableCursor(const ExpandVariable &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self.input_->MakeCursor(mem)), edges_(mem), edges_it_(mem) {}
+      : self_(self), input_cursor_(self.input_->MakeCursor(mem)), edges_(mem), edges_it_(mem), path_(mem) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     OOMExceptionEnabler oom_exception;
@@ -1461,6 +1726,7 @@ class ExpandVariableCursor : public Cursor {
     input_cursor_->Reset();
     edges_.clear();
     edges_it_.clear();
+    path_.Clear();
   }
 
  private:
@@ -1482,6 +1748,9 @@ class ExpandVariableCursor : public Cursor {
   utils::pmr::vector<ExpandEdges> edges_;
   // an iterator indicating the position in the corresponding edges_ element
   utils::pmr::vector<decltype(edges_.begin()->begin())> edges_it_;
+  // edges placed on each level of the expansion, they are only copied to the
+  // frame when the expansion is yielded
+  ExpansionPath path_;
 
   /**
    * Helper function that Pulls from the input vertex and
@@ -1518,6 +1787,7 @@ class ExpandVariableCursor : public Cursor {
 
       lower_bound_ = self_.lower_bound_ ? calc_bound(self_.lower_bound_) : 1;
       upper_bound_ = self_.upper_bound_ ? calc_bound(self_.upper_bound_) : std::numeric_limits<int64_t>::max();
+      path_.Clear();
 
       if (upper_bound_ > 0) {
         auto *memory = edges_.get_allocator().GetMemoryResource();
@@ -1544,20 +1814,24 @@ class ExpandVariableCursor : public Cursor {
     }
   }
 
-  // Helper function for appending an edge to the list on the frame.
-  void AppendEdge(const EdgeAccessor &new_edge, utils::pmr::vector<TypedValue> *edges_on_frame) {
-    // We are placing an edge on the frame. It is possible that there already
-    // exists an edge on the frame for this level. If so first remove it.
+  // Helper function for placing an edge on the current level of the path.
+  void AppendEdge(const EdgeAccessor &new_edge) {
+    // It is possible that there already exists an edge in the path for this
+    // level. If so first remove it.
     DMG_ASSERT(edges_.size() > 0, "Edges are empty");
+    path_.Truncate(edges_.size() - 1U);
+    path_.Push(new_edge);
+  }
+
+  // Replaces the edge list on the frame with the current path.
+  void WriteEdgesToFrame(Frame &frame) {
+    auto &edges_on_frame = frame[self_.common_.edge_symbol].ValueList();
+    edges_on_frame.clear();
+    edges_on_frame.reserve(path_.size());
     if (self_.is_reverse_) {
-      // TODO: This is innefficient, we should look into replacing
-      // vector with something else for TypedValue::List.
-      size_t diff = edges_on_frame->size() - std::min(edges_on_frame->size(), edges_.size() - 1U);
-      if (diff > 0U) edges_on_frame->erase(edges_on_frame->begin(), edges_on_frame->begin() + diff);
-      edges_on_frame->emplace(edges_on_frame->begin(), new_edge);
+      for (auto it = path_.edges().rbegin(); it != path_.edges().rend(); ++it) edges_on_frame.emplace_back(*it);
     } else {
-      edges_on_frame->resize(std::min(edges_on_frame->size(), edges_.size() - 1U));
-      edges_on_frame->emplace_back(new_edge);
+      for (const auto &edge : path_.edges()) edges_on_frame.emplace_back(edge);
     }
   }
 
@@ -1588,30 +1862,17 @@ class ExpandVariableCursor : public Cursor {
       // check if we exhausted everything, if so return false
       if (edges_.empty()) return false;
 
-      // we use this a lot
-      auto &edges_on_frame = frame[self_.common_.edge_symbol].ValueList();
-
-      // it is possible that edges_on_frame does not contain as many
-      // elements as edges_ due to edge-uniqueness (when a whole layer
-      // gets exhausted but no edges are valid). for that reason only
-      // pop from edges_on_frame if they contain enough elements
-      if (self_.is_reverse_) {
-        auto diff = edges_on_frame.size() - std::min(edges_on_frame.size(), edges_.size());
-        if (diff > 0) {
-          edges_on_frame.erase(edges_on_frame.begin(), edges_on_frame.begin() + diff);
-        }
-      } else {
-        edges_on_frame.resize(std::min(edges_on_frame.size(), edges_.size()));
-      }
+      // it is possible that the path does not contain as many elements as
+      // edges_ due to edge-uniqueness (when a whole layer gets exhausted but
+      // no edges are valid). for that reason only pop from the path if it
+      // contains enough elements
+      path_.Truncate(edges_.size());
 
       // if we are here, we have a valid stack,
       // get the edge, increase the relevant iterator
       auto current_edge = *edges_it_.back()++;
       // Check edge-uniqueness.
-      bool found_existing =
-          std::any_of(edges_on_frame.begin(), edges_on_frame.end(),
-                      [&current_edge](const TypedValue &edge) { return current_edge.first == edge.ValueEdge(); });
-      if (found_existing) continue;
+      if (path_.Contains(current_edge.first)) continue;
 
       VertexAccessor current_vertex =
           current_edge.second == EdgeAtom::Direction::IN ? current_edge.first.From() : current_edge.first.To();
@@ -1623,7 +1884,7 @@ class ExpandVariableCursor : public Cursor {
         continue;
       }
 #endif
-      AppendEdge(current_edge.first, &edges_on_frame);
+      AppendEdge(current_edge.first);
 
       if (!self_.common_.existing_node) {
         frame[self_.common_.node_symbol] = current_vertex;
@@ -1637,7 +1898,7 @@ class ExpandVariableCursor : public Cursor {
                   "Accumulated path must be path");
         Path &accumulated_path = frame[self_.filter_lambda_.accumulated_path_symbol.value()].ValuePath();
         // Shrink the accumulated path including current level if necessary
-        while (accumulated_path.size() >= edges_on_frame.size()) {
+        while (accumulated_path.size() >= path_.size()) {
           accumulated_path.Shrink();
         }
         accumulated_path.Expand(current_edge.first);
@@ -1657,7 +1918,8 @@ class ExpandVariableCursor : public Cursor {
       if (self_.common_.existing_node && !CheckExistingNode(current_vertex, self_.common_.node_symbol, frame)) continue;
 
       // We only yield true if we satisfy the lower bound.
-      if (static_cast<int64_t>(edges_on_frame.size()) >= lower_bound_) {
+      if (static_cast<int64_t>(path_.size()) >= lower_bound_) {
+        WriteEdgesToFrame(frame);
         return true;
       }
     }
@@ -2166,12 +2428,39 @@ void ValidateWeightTypes(const TypedValue &lhs, const TypedValue &rhs) {
       "https://memgr.ph/wsp"));
 }
 
+// Weights are almost always numeric, so they are compared and summed as plain
+// numbers. The TypedValue operators dispatch on every operand type and
+// allocate their result, which adds up over the priority queue operations.
+// Durations still go through them.
+bool WeightLess(const TypedValue &lhs, const TypedValue &rhs) {
+  if (lhs.IsInt() && rhs.IsInt()) return lhs.ValueInt() < rhs.ValueInt();
+  if (lhs.IsNumeric() && rhs.IsNumeric()) {
+    const auto lhs_value = lhs.IsInt() ? static_cast<double>(lhs.ValueInt()) : lhs.ValueDouble();
+    const auto rhs_value = rhs.IsInt() ? static_cast<double>(rhs.ValueInt()) : rhs.ValueDouble();
+    return lhs_value < rhs_value;
+  }
+  ValidateWeightTypes(lhs, rhs);
+  return (lhs < rhs).ValueBool();
+}
+
+TypedValue AddWeights(const TypedValue &lhs, const TypedValue &rhs, utils::MemoryResource *memory) {
+  if (lhs.IsInt() && rhs.IsInt()) return TypedValue(lhs.ValueInt() + rhs.ValueInt(), memory);
+  if (lhs.IsNumeric() && rhs.IsNumeric()) {
+    const auto lhs_value = lhs.IsInt() ? static_cast<double>(lhs.ValueInt()) : lhs.ValueDouble();
+    const auto rhs_value = rhs.IsInt() ? static_cast<double>(rhs.ValueInt()) : rhs.ValueDouble();
+    return TypedValue(lhs_value + rhs_value, memory);
+  }
+  return TypedValue(lhs, memory) + rhs;
+}
+
 TypedValue CalculateNextWeight(const std::optional<memgraph::query::plan::ExpansionLambda> &weight_lambda,
-                               const TypedValue &total_weight, ExpressionEvaluator evaluator) {
+                               const TypedValue &total_weight, ExpressionEvaluator &evaluator) {
   if (!weight_lambda) {
     return {};
   }
   auto *memory = evaluator.GetMemoryResource();
+  // The evaluator is shared by all expansions; lookups cached for the previous edge are stale
+  evaluator.ResetPropertyLookupCache();
   TypedValue current_weight = weight_lambda->expression->Accept(evaluator);
   CheckWeightType(current_weight, memory);
 
@@ -2181,7 +2470,7 @@ TypedValue CalculateNextWeight(const std::optional<memgraph::query::plan::Expans
 
   ValidateWeightTypes(current_weight, total_weight);
 
-  return TypedValue(current_weight, memory) + total_weight;
+  return AddWeights(current_weight, total_weight, memory);
 }
 
 }  // namespace
@@ -2239,7 +2528,7 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
       auto next_state = create_state(vertex, depth);
 
       auto found_it = total_cost_.find(next_state);
-      if (found_it != total_cost_.end() && (found_it->second.IsNull() || (found_it->second <= next_weight).ValueBool()))
+      if (found_it != total_cost_.end() && (found_it->second.IsNull() || !WeightLess(next_weight, found_it->second)))
         return;
 
       pq_.emplace(next_weight, depth + 1, vertex, edge, curr_acc_path);
@@ -2452,8 +2741,7 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
         return true;
       }
 
-      ValidateWeightTypes(lhs_weight, rhs_weight);
-      return (lhs_weight > rhs_weight).ValueBool();
+      return WeightLess(rhs_weight, lhs_weight);
     }
   };
 
@@ -2530,7 +2818,7 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
       if (found_it != visited_cost_.end()) {
         auto weight = found_it->second;
 
-        if (weight.IsNull() || (next_weight <= weight).ValueBool()) {
+        if (weight.IsNull() || !WeightLess(weight, next_weight)) {
           // Has been visited, but now found a shorter path
           visited_cost_[next_vertex] = next_weight;
         } else {
@@ -2627,7 +2915,7 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
         traversal_stack_.emplace_back(std::move(empty));
       }
 
-      if ((current_weight > visited_cost_.at(next_vertex)).ValueBool()) return false;
+      if (WeightLess(visited_cost_.at(next_vertex), current_weight)) return false;
 
       // Place destination node on the frame, handle existence flag
       if (self_.common_.existing_node) {
@@ -2652,7 +2940,7 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
 
         auto position = total_cost_.find(current_state);
         if (position != total_cost_.end()) {
-          if ((position->second < current_weight).ValueBool()) continue;
+          if (WeightLess(position->second, current_weight)) continue;
         } else {
           total_cost_.emplace(current_state, current_weight);
           if (current_depth < upper_bound_) {
@@ -2805,8 +3093,7 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
         return true;
       }
 
-      ValidateWeightTypes(lhs_weight, rhs_weight);
-      return (lhs_weight > rhs_weight).ValueBool();
+      return WeightLess(rhs_weight, lhs_weight);
     }
   };
 
@@ -3825,9 +4112,13 @@ std::vector<Symbol> EdgeUniquenessFilter::ModifiedSymbols(const SymbolTable &tab
 
 EdgeUniquenessFilter::EdgeUniquenessFilterCursor::EdgeUniquenessFilterCursor(const EdgeUniquenessFilter &self,
                                                                              utils::MemoryResource *mem)
-    : self_(self), input_cursor_(self.input_->MakeCursor(mem)) {}
+    : self_(self), input_cursor_(self.input_->MakeCursor(mem)), expand_edges_(mem) {}
 
 namespace {
+// Edge lists longer than this are checked through a set of their edge ids
+// instead of comparing them with the other values pairwise
+constexpr size_t kEdgeUniquenessLinearScanLimit = 16;
+
 /**
  * Returns true if:
  *    - a and b are either edge or edge-list values, and there
@@ -3845,6 +4136,18 @@ bool ContainsSameEdge(const TypedValue &a, const TypedValue &b) {
 
   return a.ValueEdge() == b.ValueEdge();
 }
+
+/**
+ * Returns true if value is an edge from the set, or an edge list with at
+ * least one edge from the set.
+ */
+bool ContainsEdgeFrom(const TypedValue &value, const utils::pmr::unordered_set<storage::Gid> &edges) {
+  if (value.type() == TypedValue::Type::List) {
+    return std::ranges::any_of(value.ValueList(),
+                               [&edges](const TypedValue &elem) { return ContainsEdgeFrom(elem, edges); });
+  }
+  return edges.contains(value.ValueEdge().Gid());
+}
 }  // namespace
 
 bool EdgeUniquenessFilter::EdgeUniquenessFilterCursor::Pull(Frame &frame, ExecutionContext &context) {
@@ -3853,6 +4156,14 @@ bool EdgeUniquenessFilter::EdgeUniquenessFilterCursor::Pull(Frame &frame, Execut
 
   auto expansion_ok = [&]() {
     const auto &expand_value = frame[self_.expand_symbol_];
+    if (expand_value.type() == TypedValue::Type::List &&
+        expand_value.ValueList().size() > kEdgeUniquenessLinearScanLimit) {
+      expand_edges_.clear();
+      for (const auto &edge : expand_value.ValueList()) expand_edges_.insert(edge.ValueEdge().Gid());
+      return std::ranges::none_of(self_.previous_symbols_, [&](const auto &previous_symbol) {
+        return ContainsEdgeFrom(frame[previous_symbol], expand_edges_);
+      });
+    }
     for (const auto &previous_symbol : self_.previous_symbols_) {
       const auto &previous_value = frame[previous_symbol];
       // This shouldn't raise a TypedValueException, because the planner
@@ -3931,7 +4242,7 @@ std::vector<Symbol> Accumulate::ModifiedSymbols(const SymbolTable &) const { ret
 class AccumulateCursor : public Cursor {
  public:
   AccumulateCursor(const Accumulate &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self.input_->MakeCursor(mem)), cache_(mem) {}
+      : self_(self), input_cursor_(self.input_->MakeCursor(mem)), cache_(self.symbols_, mem) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     OOMExceptionEnabler oom_exception;
@@ -3941,26 +4252,17 @@ class AccumulateCursor : public Cursor {
     // cache all the input
     if (!pulled_all_input_) {
       while (input_cursor_->Pull(frame, context)) {
-        utils::pmr::vector<TypedValue> row(cache_.get_allocator().GetMemoryResource());
-        row.reserve(self_.symbols_.size());
-        for (const Symbol &symbol : self_.symbols_) row.emplace_back(frame[symbol]);
-        cache_.emplace_back(std::move(row));
+        cache_.Push(frame);
       }
       pulled_all_input_ = true;
-      cache_it_ = cache_.begin();
+      cache_row_ = 0;
 
       if (self_.advance_command_) dba.AdvanceCommand();
     }
 
     AbortCheck(context);
-    if (cache_it_ == cache_.end()) return false;
-    auto row_it = (cache_it_++)->begin();
-    for (const Symbol &symbol : self_.symbols_) {
-      if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
-        context.frame_change_collector->ResetTrackingValue(symbol.name());
-      }
-      frame[symbol] = *row_it++;
-    }
+    if (cache_row_ == cache_.size()) return false;
+    cache_.Restore(cache_row_++, frame, context);
     return true;
   }
 
@@ -3969,15 +4271,15 @@ class AccumulateCursor : public Cursor {
   void Reset() override {
     input_cursor_->Reset();
     cache_.clear();
-    cache_it_ = cache_.begin();
+    cache_row_ = 0;
     pulled_all_input_ = false;
   }
 
  private:
   const Accumulate &self_;
   const UniqueCursorPtr input_cursor_;
-  utils::pmr::deque<utils::pmr::vector<TypedValue>> cache_;
-  decltype(cache_.begin()) cache_it_ = cache_.begin();
+  FrameRows cache_;
+  size_t cache_row_{0};
   bool pulled_all_input_{false};
 };
 
@@ -5032,8 +5334,8 @@ class CartesianCursor : public Cursor {
  public:
   CartesianCursor(const Cartesian &self, utils::MemoryResource *mem)
       : self_(self),
-        left_op_frames_(mem),
-        right_op_frame_(mem),
+        left_op_rows_(self.left_symbols_, mem),
+        right_op_row_(self.right_symbols_, mem),
         left_op_cursor_(self.left_op_->MakeCursor(mem)),
         right_op_cursor_(self_.right_op_->MakeCursor(mem)) {
     MG_ASSERT(left_op_cursor_ != nullptr, "CartesianCursor: Missing left operator cursor.");
@@ -5045,46 +5347,37 @@ class CartesianCursor : public Cursor {
     SCOPED_PROFILE_OP_BY_REF(self_);
 
     if (!cartesian_pull_initialized_) {
-      // Pull all left_op frames.
+      // Pull all left_op rows.
       while (left_op_cursor_->Pull(frame, context)) {
-        left_op_frames_.emplace_back(frame.elems().begin(), frame.elems().end());
+        left_op_rows_.Push(frame);
       }
 
-      // We're setting the iterator to 'end' here so it pulls the right
+      // We're setting the row to the end here so it pulls the right
       // cursor.
-      left_op_frames_it_ = left_op_frames_.end();
+      left_op_row_ = left_op_rows_.size();
       cartesian_pull_initialized_ = true;
     }
 
     // If left operator yielded zero results there is no cartesian product.
-    if (left_op_frames_.empty()) {
+    if (left_op_rows_.empty()) {
       return false;
     }
 
-    auto restore_frame = [&frame, &context](const auto &symbols, const auto &restore_from) {
-      for (const auto &symbol : symbols) {
-        frame[symbol] = restore_from[symbol.position()];
-        if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
-          context.frame_change_collector->ResetTrackingValue(symbol.name());
-        }
-      }
-    };
-
-    if (left_op_frames_it_ == left_op_frames_.end()) {
+    if (left_op_row_ == left_op_rows_.size()) {
       // Advance right_op_cursor_.
       if (!right_op_cursor_->Pull(frame, context)) return false;
 
-      right_op_frame_.assign(frame.elems().begin(), frame.elems().end());
-      left_op_frames_it_ = left_op_frames_.begin();
+      right_op_row_.clear();
+      right_op_row_.Push(frame);
+      left_op_row_ = 0;
     } else {
       // Make sure right_op_cursor last pulled results are on frame.
-      restore_frame(self_.right_symbols_, right_op_frame_);
+      right_op_row_.Restore(0, frame, context);
     }
 
     AbortCheck(context);
 
-    restore_frame(self_.left_symbols_, *left_op_frames_it_);
-    left_op_frames_it_++;
+    left_op_rows_.Restore(left_op_row_++, frame, context);
     return true;
   }
 
@@ -5096,19 +5389,20 @@ class CartesianCursor : public Cursor {
   void Reset() override {
     left_op_cursor_->Reset();
     right_op_cursor_->Reset();
-    right_op_frame_.clear();
-    left_op_frames_.clear();
-    left_op_frames_it_ = left_op_frames_.end();
+    right_op_row_.clear();
+    left_op_rows_.clear();
+    left_op_row_ = 0;
     cartesian_pull_initialized_ = false;
   }
 
  private:
   const Cartesian &self_;
-  utils::pmr::vector<utils::pmr::vector<TypedValue>> left_op_frames_;
-  utils::pmr::vector<TypedValue> right_op_frame_;
+  FrameRows left_op_rows_;
+  // Holds the last row pulled from the right_op
+  FrameRows right_op_row_;
   const UniqueCursorPtr left_op_cursor_;
   const UniqueCursorPtr right_op_cursor_;
-  utils::pmr::vector<utils::pmr::vector<TypedValue>>::iterator left_op_frames_it_;
+  size_t left_op_row_{0};
   bool cartesian_pull_initialized_{false};
 };
 
@@ -5984,8 +6278,9 @@ class HashJoinCursor : public Cursor {
       : self_(self),
         left_op_cursor_(self.left_op_->MakeCursor(mem)),
         right_op_cursor_(self_.right_op_->MakeCursor(mem)),
+        left_op_rows_(self.left_symbols_, mem),
         hashtable_(mem),
-        right_op_frame_(mem) {
+        right_op_row_(self.right_symbols_, mem) {
     MG_ASSERT(left_op_cursor_ != nullptr, "HashJoinCursor: Missing left operator cursor.");
     MG_ASSERT(right_op_cursor_ != nullptr, "HashJoinCursor: Missing right operator cursor.");
   }
@@ -6003,15 +6298,6 @@ class HashJoinCursor : public Cursor {
       return false;
     }
 
-    auto restore_frame = [&frame, &context](const auto &symbols, const auto &restore_from) {
-      for (const auto &symbol : symbols) {
-        frame[symbol] = restore_from[symbol.position()];
-        if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
-          context.frame_change_collector->ResetTrackingValue(symbol.name());
-        }
-      }
-    };
-
     if (!common_value_found_) {
       // Pull from the right_op until there’s a mergeable frame
       while (true) {
@@ -6022,26 +6308,27 @@ class HashJoinCursor : public Cursor {
         ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                       storage::View::OLD);
         auto right_value = self_.hash_join_condition_->expression2_->Accept(evaluator);
-        if (hashtable_.contains(right_value)) {
+        if (auto found = hashtable_.find(right_value); found != hashtable_.end()) {
           // If so, finish pulling for now and proceed to joining the pulled frame
-          right_op_frame_.assign(frame.elems().begin(), frame.elems().end());
+          right_op_row_.clear();
+          right_op_row_.Push(frame);
           common_value_found_ = true;
-          common_value = right_value;
-          left_op_frame_it_ = hashtable_[common_value].begin();
+          common_rows_ = &found->second;
+          left_op_row_it_ = common_rows_->begin();
           break;
         }
       }
     } else {
       // Restore the right frame ahead of restoring the left frame
-      restore_frame(self_.right_symbols_, right_op_frame_);
+      right_op_row_.Restore(0, frame, context);
     }
 
-    restore_frame(self_.left_symbols_, *left_op_frame_it_);
+    left_op_rows_.Restore(*left_op_row_it_, frame, context);
 
-    left_op_frame_it_++;
+    left_op_row_it_++;
     // When all left frames with the common value have been joined, move on to pulling and joining the next right
     // frame
-    if (common_value_found_ && left_op_frame_it_ == hashtable_[common_value].end()) {
+    if (common_value_found_ && left_op_row_it_ == common_rows_->end()) {
       common_value_found_ = false;
     }
 
@@ -6056,9 +6343,11 @@ class HashJoinCursor : public Cursor {
   void Reset() override {
     left_op_cursor_->Reset();
     right_op_cursor_->Reset();
+    left_op_rows_.clear();
     hashtable_.clear();
-    right_op_frame_.clear();
-    left_op_frame_it_ = {};
+    right_op_row_.clear();
+    common_rows_ = nullptr;
+    left_op_row_it_ = {};
     hash_join_initialized_ = false;
     common_value_found_ = false;
   }
@@ -6071,22 +6360,32 @@ class HashJoinCursor : public Cursor {
                                     storage::View::OLD);
       auto left_value = self_.hash_join_condition_->expression1_->Accept(evaluator);
       if (left_value.type() != TypedValue::Type::Null) {
-        hashtable_[left_value].emplace_back(frame.elems().begin(), frame.elems().end());
+        hashtable_[left_value].emplace_back(left_op_rows_.size());
+        left_op_rows_.Push(frame);
       }
     }
+
+    // Publish the join keys for the JoinKeyFilter in the right branch
+    key_filter_ = utils::BloomFilter(hashtable_.size());
+    for (const auto &[key, _] : hashtable_) {
+      key_filter_.Insert(TypedValue::Hash{}(key));
+    }
+    context.join_key_filters[self_.hash_join_condition_->expression2_] = &key_filter_;
   }
 
   const HashJoin &self_;
   const UniqueCursorPtr left_op_cursor_;
   const UniqueCursorPtr right_op_cursor_;
-  utils::pmr::unordered_map<TypedValue, utils::pmr::vector<utils::pmr::vector<TypedValue>>, TypedValue::Hash,
-                            TypedValue::BoolEqual>
-      hashtable_;
-  utils::pmr::vector<TypedValue> right_op_frame_;
-  utils::pmr::vector<utils::pmr::vector<TypedValue>>::iterator left_op_frame_it_;
+  FrameRows left_op_rows_;
+  // Maps the join values to the left_op rows holding them
+  utils::pmr::unordered_map<TypedValue, utils::pmr::vector<size_t>, TypedValue::Hash, TypedValue::BoolEqual> hashtable_;
+  // Holds the last row pulled from the right_op
+  FrameRows right_op_row_;
+  const utils::pmr::vector<size_t> *common_rows_{nullptr};
+  utils::pmr::vector<size_t>::const_iterator left_op_row_it_;
+  utils::BloomFilter key_filter_;
   bool hash_join_initialized_{false};
   bool common_value_found_{false};
-  TypedValue common_value;
 };
 }  // namespace
 
@@ -6095,6 +6394,51 @@ UniqueCursorPtr HashJoin::MakeCursor(utils::MemoryResource *mem) const {
   return MakeUniqueCursorPtr<HashJoinCursor>(mem, *this, mem);
 }
 
+ACCEPT_WITH_INPUT(JoinKeyFilter)
+
+std::vector<Symbol> JoinKeyFilter::ModifiedSymbols(const SymbolTable &table) const {
+  return input_->ModifiedSymbols(table);
+}
+
+namespace {
+
+class JoinKeyFilterCursor : public Cursor {
+ public:
+  JoinKeyFilterCursor(const JoinKeyFilter &self, utils::MemoryResource *mem)
+      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    SCOPED_PROFILE_OP("JoinKeyFilter");
+
+    auto found = context.join_key_filters.find(self_.key_);
+    const auto *key_filter = found != context.join_key_filters.end() ? found->second : nullptr;
+    // Same evaluation as the one HashJoin probes with
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::OLD);
+    while (input_cursor_->Pull(frame, context)) {
+      if (!key_filter) return true;
+      auto key = self_.key_->Accept(evaluator);
+      // Null keys never join
+      if (!key.IsNull() && key_filter->MayContain(TypedValue::Hash{}(key))) return true;
+    }
+    return false;
+  }
+
+  void Shutdown() override { input_cursor_->Shutdown(); }
+
+  void Reset() override { input_cursor_->Reset(); }
+
+ private:
+  const JoinKeyFilter &self_;
+  const UniqueCursorPtr input_cursor_;
+};
+
+}  // namespace
+
+UniqueCursorPtr JoinKeyFilter::MakeCursor(utils::MemoryResource *mem) const {
+  return MakeUniqueCursorPtr<JoinKeyFilterCursor>(mem, *this, mem);
+}
+
 RollUpApply::RollUpApply(std::shared_ptr<LogicalOperator> &&input,
                          std::shared_ptr<LogicalOperator> &&list_collection_branch,
                          const std::vector<Symbol> &list_collection_symbols, Symbol result_symbol)
@@ -30,6 +30,7 @@
 #include "utils/fnv.hpp"
 #include "utils/logging.hpp"
 #include "utils/memory.hpp"
+#include "utils/pmr/unordered_set.hpp"
 #include "utils/synchronized.hpp"
 #include "utils/visitor.hpp"
 
@@ -103,6 +104,7 @@ class ScanAllByEdgeTypePropertyRange;
 class ScanAllByEdgeId;
 class ScanAllByPointDistance;
 class Expand;
+class IntersectExpand;
 class ExpandVariable;
 class ConstructNamedPath;
 class Filter;
@@ -133,6 +135,7 @@ class EvaluatePatternFilter;
 class Apply;
 class IndexedJoin;
 class HashJoin;
+class JoinKeyFilter;
 class RollUpApply;
 class PeriodicCommit;
 class PeriodicSubquery;
@@ -144,7 +147,7 @@ using LogicalOperatorCompositeVisitor = utils::CompositeVisitor<
     ExpandVariable, ConstructNamedPath, Filter, Produce, Delete, SetProperty, SetProperties, SetLabels, RemoveProperty,
     RemoveLabels, EdgeUniquenessFilter, Accumulate, Aggregate, Skip, Limit, OrderBy, Merge, Optional, Unwind, Distinct,
     Union, Cartesian, CallProcedure, LoadCsv, Foreach, EmptyResult, EvaluatePatternFilter, Apply, IndexedJoin, HashJoin,
-    RollUpApply, PeriodicCommit, PeriodicSubquery>;
+    JoinKeyFilter, RollUpApply, PeriodicCommit, PeriodicSubquery, IntersectExpand>;
 
 using LogicalOperatorLeafVisitor = utils::LeafVisitor<Once>;
 
@@ -1123,6 +1126,65 @@ class Expand : public memgraph::query::plan::LogicalOperator {
   }
 };
 
+/// Expansion closing a cycle of the matched pattern, e.g. the last two edges of
+/// MATCH (a)-[r]->(b)-[s]->(c)-[t]->(a).
+///
+/// It replaces an Expand of a new node followed by an Expand to an existing
+/// node. Instead of producing every neighbour of the input node and checking
+/// each one against the existing (anchor) node, it only produces the nodes
+/// adjacent to both. The neighbourhood of the anchor is hashed once and reused
+/// while the anchor stays the same, so a row costs time linear in the degree
+/// of the input node, and neighbours which don't close the cycle never become
+/// rows.
+///
+/// Since the anchor's edges are cached, it is only planned with
+/// storage::View::OLD.
+class IntersectExpand : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  /**
+   * @param input_symbol Node the new node is expanded from.
+   * @param common Expansion from the input node, binding the new node.
+   * @param anchor_symbol Bound node the new node must also be adjacent to.
+   * @param closing Expansion from the anchor to the new node. Its node symbol
+   *    is the new node and its direction is relative to the anchor.
+   */
+  IntersectExpand(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol, ExpandCommon common,
+                  Symbol anchor_symbol, ExpandCommon closing, storage::View view);
+
+  IntersectExpand() = default;
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override { return true; }
+  std::shared_ptr<LogicalOperator> input() const override { return input_; }
+  void set_input(std::shared_ptr<LogicalOperator> input) override { input_ = input; }
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
+  Symbol input_symbol_;
+  memgraph::query::plan::ExpandCommon common_;
+  Symbol anchor_symbol_;
+  memgraph::query::plan::ExpandCommon closing_;
+  storage::View view_;
+
+  std::string ToString() const override;
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<IntersectExpand>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->input_symbol_ = input_symbol_;
+    object->common_ = common_;
+    object->anchor_symbol_ = anchor_symbol_;
+    object->closing_ = closing_;
+    object->view_ = view_;
+    return object;
+  }
+};
+
 struct ExpansionLambda {
   static const utils::TypeInfo kType;
   const utils::TypeInfo &GetTypeInfo() const { return kType; }
@@ -1839,6 +1901,8 @@ class EdgeUniquenessFilter : public memgraph::query::plan::LogicalOperator {
    private:
     const EdgeUniquenessFilter &self_;
     const UniqueCursorPtr input_cursor_;
+    // Edges of the expanded value, when it's a long edge list
+    utils::pmr::unordered_set<storage::Gid> expand_edges_;
   };
 };
 
@@ -2848,6 +2912,46 @@ class HashJoin : public memgraph::query::plan::LogicalOperator {
   }
 };
 
+/// Drops the rows of a HashJoin's right branch whose join key can't match any
+/// row of the left branch.
+///
+/// The join rewriter places it right above the operators binding the key, so
+/// non-matching rows aren't expanded any further. The HashJoin publishes the
+/// keys of its left branch before it starts pulling the right one. Until then,
+/// or if the join never does, all rows are passed through.
+class JoinKeyFilter : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  JoinKeyFilter() = default;
+  /// @param key Right side of the join condition, shared with the HashJoin.
+  JoinKeyFilter(const std::shared_ptr<LogicalOperator> &input, Symbol key_symbol, Expression *key)
+      : input_(input), key_symbol_(std::move(key_symbol)), key_(key) {}
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override { return true; }
+  std::shared_ptr<LogicalOperator> input() const override { return input_; }
+  void set_input(std::shared_ptr<LogicalOperator> input) override { input_ = input; }
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
+  Symbol key_symbol_;
+  Expression *key_;
+
+  std::string ToString() const override { return fmt::format("JoinKeyFilter {{{}}}", key_symbol_.name()); }
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<JoinKeyFilter>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->key_symbol_ = key_symbol_;
+    object->key_ = key_ ? key_->Clone(storage) : nullptr;
+    return object;
+  }
+};
+
 /// RollUpApply operator is used to execute an expression which takes as input a pattern,
 /// and returns a list with content from the matched pattern
 /// It's used for a pattern expression or pattern comprehension in a query.
@@ -77,6 +77,9 @@ constexpr utils::TypeInfo query::plan::ScanByEdgeCommon::kType{utils::TypeId::SC
 constexpr utils::TypeInfo query::plan::Expand::kType{utils::TypeId::EXPAND, "Expand",
                                                      &query::plan::LogicalOperator::kType};
 
+constexpr utils::TypeInfo query::plan::IntersectExpand::kType{utils::TypeId::INTERSECT_EXPAND, "IntersectExpand",
+                                                              &query::plan::LogicalOperator::kType};
+
 constexpr utils::TypeInfo query::plan::ExpansionLambda::kType{utils::TypeId::EXPANSION_LAMBDA, "ExpansionLambda",
                                                               nullptr};
 
@@ -177,6 +180,9 @@ constexpr utils::TypeInfo query::plan::IndexedJoin::kType{utils::TypeId::INDEXED
 constexpr utils::TypeInfo query::plan::HashJoin::kType{utils::TypeId::HASH_JOIN, "HashJoin",
                                                        &query::plan::LogicalOperator::kType};
 
+constexpr utils::TypeInfo query::plan::JoinKeyFilter::kType{utils::TypeId::JOIN_KEY_FILTER, "JoinKeyFilter",
+                                                            &query::plan::LogicalOperator::kType};
+
 constexpr utils::TypeInfo query::plan::RollUpApply::kType{utils::TypeId::ROLLUP_APPLY, "RollUpApply",
                                                           &query::plan::LogicalOperator::kType};
 
@@ -131,6 +131,13 @@ bool PlanPrinter::PreVisit(query::plan::Expand &op) {
   return true;
 }
 
+bool PlanPrinter::PreVisit(query::plan::IntersectExpand &op) {
+  op.dba_ = dba_;
+  WithPrintLn([&op](auto &out) { out << "* " << op.ToString(); });
+  op.dba_ = nullptr;
+  return true;
+}
+
 bool PlanPrinter::PreVisit(query::plan::ExpandVariable &op) {
   op.dba_ = dba_;
   WithPrintLn([&op](auto &out) { out << "* " << op.ToString(); });
@@ -259,6 +266,11 @@ bool PlanPrinter::PreVisit(query::plan::EdgeUniquenessFilter &op) {
   return true;
 }
 
+bool PlanPrinter::PreVisit(query::plan::JoinKeyFilter &op) {
+  WithPrintLn([&](auto &out) { out << "* " << op.ToString(); });
+  return true;
+}
+
 bool PlanPrinter::PreVisit(query::plan::Apply &op) {
   WithPrintLn([](auto &out) { out << "* Apply"; });
   Branch(*op.subquery_);
@@ -660,6 +672,26 @@ bool PlanToJsonVisitor::PreVisit(Expand &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(IntersectExpand &op) {
+  json self;
+  self["name"] = "IntersectExpand";
+  self["input_symbol"] = ToJson(op.input_symbol_);
+  self["node_symbol"] = ToJson(op.common_.node_symbol);
+  self["edge_symbol"] = ToJson(op.common_.edge_symbol);
+  self["edge_types"] = ToJson(op.common_.edge_types, *dba_);
+  self["direction"] = ToString(op.common_.direction);
+  self["anchor_symbol"] = ToJson(op.anchor_symbol_);
+  self["closing_edge_symbol"] = ToJson(op.closing_.edge_symbol);
+  self["closing_edge_types"] = ToJson(op.closing_.edge_types, *dba_);
+  self["closing_direction"] = ToString(op.closing_.direction);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(ExpandVariable &op) {
   json self;
   self["name"] = "ExpandVariable";
@@ -1069,6 +1101,19 @@ bool PlanToJsonVisitor::PreVisit(HashJoin &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(JoinKeyFilter &op) {
+  json self;
+  self["name"] = "JoinKeyFilter";
+  self["key_symbol"] = ToJson(op.key_symbol_);
+  self["key"] = ToJson(op.key_, *dba_);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(Foreach &op) {
   json self;
   self["name"] = "Foreach";
@@ -76,6 +76,7 @@ class PlanPrinter : public virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(ScanAllByEdgeId &) override;
 
   bool PreVisit(Expand &) override;
+  bool PreVisit(IntersectExpand &) override;
   bool PreVisit(ExpandVariable &) override;
 
   bool PreVisit(ConstructNamedPath &) override;
@@ -88,6 +89,7 @@ class PlanPrinter : public virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(Optional &) override;
   bool PreVisit(Cartesian &) override;
   bool PreVisit(HashJoin &) override;
+  bool PreVisit(JoinKeyFilter &) override;
 
   bool PreVisit(EmptyResult &) override;
   bool PreVisit(Produce &) override;
@@ -192,6 +194,7 @@ class PlanToJsonVisitor : public virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(RemoveLabels &) override;
 
   bool PreVisit(Expand &) override;
+  bool PreVisit(IntersectExpand &) override;
   bool PreVisit(ExpandVariable &) override;
 
   bool PreVisit(ConstructNamedPath &) override;
@@ -205,6 +208,7 @@ class PlanToJsonVisitor : public virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(Cartesian &) override;
   bool PreVisit(Apply & /*unused*/) override;
   bool PreVisit(HashJoin &) override;
+  bool PreVisit(JoinKeyFilter &) override;
   bool PreVisit(IndexedJoin & /*unused*/) override;
 
   bool PreVisit(ScanAll &) override;
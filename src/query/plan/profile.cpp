@@ -13,6 +13,8 @@
 
 #include <algorithm>
 #include <chrono>
+#include <iterator>
+#include <numeric>
 
 #include <fmt/format.h>
 #include <json/json.hpp>
@@ -163,4 +165,76 @@ nlohmann::json ProfilingStatsToJson(const ProfilingStatsWithTotalTime &stats) {
   return helper.ToJson();
 }
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// PlanRuntimeStats
+
+namespace {
+
+void MergeStats(ProfilingStats *into, const ProfilingStats &from) {
+  into->actual_hits += from.actual_hits;
+  into->num_cycles += from.num_cycles;
+  // Cursor addresses differ between executions, so the children are matched
+  // by their name and the order in which they appear among siblings.
+  for (size_t i = 0; i < from.children.size(); ++i) {
+    const auto &child = from.children[i];
+    const auto occurrence = std::count_if(from.children.begin(), from.children.begin() + i,
+                                          [&child](const auto &other) { return other.name == child.name; });
+    auto match = into->children.begin();
+    for (auto seen = 0; match != into->children.end(); ++match) {
+      if (match->name == child.name && seen++ == occurrence) break;
+    }
+    if (match == into->children.end()) {
+      auto &added = into->children.emplace_back();
+      added.name = child.name;
+      added.key = child.key;
+      match = std::prev(into->children.end());
+    }
+    MergeStats(&*match, child);
+  }
+}
+
+void DivideStats(ProfilingStats *stats, uint64_t divisor) {
+  stats->actual_hits /= static_cast<int64_t>(divisor);
+  stats->num_cycles /= divisor;
+  for (auto &child : stats->children) {
+    DivideStats(&child, divisor);
+  }
+}
+
+}  // namespace
+
+bool PlanRuntimeStats::SampleNextExecution(uint64_t sample_rate) {
+  const auto execution = executions_.fetch_add(1, std::memory_order_relaxed);
+  return sample_rate != 0 && execution % sample_rate == 0;
+}
+
+void PlanRuntimeStats::SetQuery(std::string_view query) {
+  std::lock_guard guard{lock_};
+  if (query_.empty()) query_ = query;
+}
+
+void PlanRuntimeStats::Add(const ProfilingStatsWithTotalTime &stats) {
+  std::lock_guard guard{lock_};
+  if (sampled_executions_ == 0) {
+    total_.cumulative_stats.name = stats.cumulative_stats.name;
+    total_.cumulative_stats.key = stats.cumulative_stats.key;
+  }
+  MergeStats(&total_.cumulative_stats, stats.cumulative_stats);
+  total_.total_time += stats.total_time;
+  ++sampled_executions_;
+}
+
+std::optional<PlanRuntimeStats::Summary> PlanRuntimeStats::GetSummary() const {
+  std::lock_guard guard{lock_};
+  if (sampled_executions_ == 0) return std::nullopt;
+  Summary summary{.query = query_,
+                  .executions = executions_.load(std::memory_order_relaxed),
+                  .sampled_executions = sampled_executions_,
+                  .average = total_};
+  DivideStats(&summary.average.cumulative_stats, sampled_executions_);
+  summary.average.total_time /= static_cast<double>(sampled_executions_);
+  return summary;
+}
+
 }  // namespace memgraph::query::plan
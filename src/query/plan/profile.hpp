@@ -11,7 +11,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include <json/json.hpp>
@@ -41,4 +46,40 @@ std::vector<std::vector<TypedValue>> ProfilingStatsToTable(const ProfilingStatsW
 
 nlohmann::json ProfilingStatsToJson(const ProfilingStatsWithTotalTime &stats);
 
+/**
+ * Accumulates the profiling statistics of sampled executions of a single
+ * plan. Operators of different executions are matched by their name and
+ * position in the tree, so the statistics can be kept without turning
+ * PROFILE on for every execution.
+ */
+class PlanRuntimeStats {
+ public:
+  struct Summary {
+    std::string query;
+    uint64_t executions{0};
+    uint64_t sampled_executions{0};
+    // Statistics averaged over the sampled executions.
+    ProfilingStatsWithTotalTime average;
+  };
+
+  /// Counts an execution of the plan and returns true if it should be
+  /// sampled. A sample rate of 0 disables the sampling.
+  bool SampleNextExecution(uint64_t sample_rate);
+
+  void SetQuery(std::string_view query);
+
+  void Add(const ProfilingStatsWithTotalTime &stats);
+
+  /// Returns std::nullopt if no execution was sampled yet.
+  std::optional<Summary> GetSummary() const;
+
+ private:
+  std::atomic<uint64_t> executions_{0};
+
+  mutable std::mutex lock_;
+  std::string query_;
+  uint64_t sampled_executions_{0};
+  ProfilingStatsWithTotalTime total_;
+};
+
 }  // namespace memgraph::query::plan
@@ -46,12 +46,14 @@ PRE_VISIT(ScanAllByEdgeTypePropertyRange, RWType::R, true)
 PRE_VISIT(ScanAllByEdgeId, RWType::R, true)
 
 PRE_VISIT(Expand, RWType::R, true)
+PRE_VISIT(IntersectExpand, RWType::R, true)
 PRE_VISIT(ExpandVariable, RWType::R, true)
 
 PRE_VISIT(ConstructNamedPath, RWType::R, true)
 
 PRE_VISIT(Filter, RWType::NONE, true)
 PRE_VISIT(EdgeUniquenessFilter, RWType::NONE, true)
+PRE_VISIT(JoinKeyFilter, RWType::NONE, true)
 
 PRE_VISIT(Merge, RWType::RW, false)
 PRE_VISIT(Optional, RWType::NONE, true)
@@ -69,12 +69,14 @@ struct ReadWriteTypeChecker : public virtual HierarchicalLogicalOperatorVisitor
   bool PreVisit(ScanAllByEdgeId &) override;
 
   bool PreVisit(Expand &) override;
+  bool PreVisit(IntersectExpand &) override;
   bool PreVisit(ExpandVariable &) override;
 
   bool PreVisit(ConstructNamedPath &) override;
 
   bool PreVisit(Filter &) override;
   bool PreVisit(EdgeUniquenessFilter &) override;
+  bool PreVisit(JoinKeyFilter &) override;
 
   bool PreVisit(Merge &) override;
   bool PreVisit(Optional &) override;
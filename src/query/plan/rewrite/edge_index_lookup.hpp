@@ -454,6 +454,24 @@ class EdgeIndexRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(JoinKeyFilter &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(JoinKeyFilter &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
+  bool PreVisit(IntersectExpand &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(IntersectExpand &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(Accumulate &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -582,6 +582,24 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(JoinKeyFilter &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(JoinKeyFilter &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
+  bool PreVisit(IntersectExpand &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(IntersectExpand &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(Accumulate &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -755,6 +773,8 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     FilterInfo filter;
     int64_t vertex_count;
     std::optional<storage::LabelPropertyIndexStats> index_stats;
+    // Whether the filter is an equality answered by a hash probe
+    bool hash_lookup{false};
   };
 
   struct PointLabelPropertyIndex {
@@ -1005,6 +1025,7 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
 
       // Conditions, from more to less important:
       // the index with 10x less vertices is better.
+      // the index answering an equality filter with a hash probe is better.
       // the index with smaller average group size is better.
       // the index with equal avg group size and distribution closer to the uniform is better.
       // the index with less vertices is better.
@@ -1013,9 +1034,19 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
       int64_t vertex_count = db_->VerticesCount(GetLabel(label), GetProperty(property));
       std::optional<storage::LabelPropertyIndexStats> new_stats =
           db_->GetIndexStats(GetLabel(label), GetProperty(property));
+      const bool hash_lookup = filter.property_filter->type_ == PropertyFilter::Type::EQUAL &&
+                               db_->LabelPropertyHashIndexExists(GetLabel(label), GetProperty(property));
 
       if (!found || vertex_count * 10 < found->vertex_count) {
-        found = LabelPropertyIndex{label, filter, vertex_count, new_stats};
+        found = LabelPropertyIndex{label, filter, vertex_count, new_stats, hash_lookup};
+        continue;
+      }
+
+      if (hash_lookup != found->hash_lookup) {
+        // The cost of a hash probe doesn't depend on the size of the index
+        if (hash_lookup && found->vertex_count * 10 >= vertex_count) {
+          found = LabelPropertyIndex{label, filter, vertex_count, new_stats, hash_lookup};
+        }
         continue;
       }
 
@@ -1023,7 +1054,7 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
           cmp_res == -1 ||
           cmp_res == 0 && (found->vertex_count > vertex_count ||
                            found->vertex_count == vertex_count && is_better_type(filter.property_filter->type_))) {
-        found = LabelPropertyIndex{label, filter, vertex_count, new_stats};
+        found = LabelPropertyIndex{label, filter, vertex_count, new_stats, hash_lookup};
       }
     }
     return found;
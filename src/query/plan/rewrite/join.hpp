@@ -409,6 +409,24 @@ class JoinRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(JoinKeyFilter &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(JoinKeyFilter &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
+  bool PreVisit(IntersectExpand &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(IntersectExpand &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(Accumulate &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -644,11 +662,51 @@ class JoinRewriter final : public HierarchicalLogicalOperatorVisitor {
         std::swap(join_condition->expression1_, join_condition->expression2_);
       }
 
-      return std::make_unique<HashJoin>(left_op, left_symbols, right_op, right_symbols, join_condition);
+      auto hash_join = std::make_unique<HashJoin>(left_op, left_symbols, right_op, right_symbols, join_condition);
+      AddJoinKeyFilter(hash_join.get());
+      return hash_join;
     }
 
     return nullptr;
   }
+
+  // Places a JoinKeyFilter in the right branch just above the operators binding the join key, so the rows which
+  // can't be joined aren't expanded any further.
+  void AddJoinKeyFilter(HashJoin *hash_join) {
+    auto *key = hash_join->hash_join_condition_->expression2_;
+    if (key->GetTypeInfo() != PropertyLookup::kType) return;
+    auto *key_object = static_cast<PropertyLookup *>(key)->expression_;
+    if (key_object->GetTypeInfo() != Identifier::kType) return;
+    const auto key_symbol = symbol_table_->at(*static_cast<Identifier *>(key_object));
+
+    // Only operators working row by row can be moved above the filter
+    auto is_row_wise = [](const LogicalOperator &op) {
+      const auto &type = op.GetTypeInfo();
+      return type == Filter::kType || type == Expand::kType || type == IntersectExpand::kType ||
+             type == ExpandVariable::kType || type == EdgeUniquenessFilter::kType ||
+             type == ConstructNamedPath::kType || type == JoinKeyFilter::kType;
+    };
+    std::vector<LogicalOperator *> branch{hash_join->right_op_.get()};
+    while (is_row_wise(*branch.back())) {
+      auto input = branch.back()->input();
+      if (!utils::Contains(input->ModifiedSymbols(*symbol_table_), key_symbol)) break;
+      branch.push_back(input.get());
+    }
+
+    // The filter goes above branch[position]. Plain filters are cheaper, so they still come first.
+    auto position = branch.size() - 1;
+    while (position > 0 && branch[position - 1]->GetTypeInfo() == Filter::kType) --position;
+    // Keep a sequential scan right under its expansion, so the edge index rewriter can still merge them
+    if (position > 0 && branch[position]->GetTypeInfo() == ScanAll::kType &&
+        branch[position - 1]->GetTypeInfo() == Expand::kType) {
+      --position;
+    }
+    // Right under the join it would only repeat the join's own lookup
+    if (position == 0) return;
+
+    auto *parent = branch[position - 1];
+    parent->set_input(std::make_shared<JoinKeyFilter>(parent->input(), key_symbol, key));
+  }
 };
 
 }  // namespace impl
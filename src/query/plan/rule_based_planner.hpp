@@ -866,7 +866,9 @@ class RuleBasedPlanner {
                                                  edge->type_, expansion.direction, edge_types, expansion.is_flipped,
                                                  edge->lower_bound_, edge->upper_bound_, existing_node, filter_lambda,
                                                  weight_lambda, total_weight);
-    } else {
+    } else if (!existing_node || view != storage::View::OLD ||
+               !MergeCycleClosingExpand(last_op, node1_symbol, node_symbol, edge_symbol, expansion.direction,
+                                        edge_types)) {
       last_op = std::make_unique<Expand>(std::move(last_op), node1_symbol, node_symbol, edge_symbol,
                                          expansion.direction, edge_types, existing_node, view);
     }
@@ -887,6 +889,43 @@ class RuleBasedPlanner {
     return last_op;
   }
 
+  // Closes a cycle by merging the expansion between two bound nodes with the
+  // Expand which bound one of them into an IntersectExpand, so only the
+  // neighbours adjacent to both nodes are produced. Filters between the two
+  // expansions work row by row and end up above the merged operator. Returns
+  // false if `last_op` doesn't end with such an Expand.
+  bool MergeCycleClosingExpand(std::unique_ptr<LogicalOperator> &last_op, const Symbol &node1_symbol,
+                               const Symbol &node2_symbol, const Symbol &edge_symbol, EdgeAtom::Direction direction,
+                               const std::vector<storage::EdgeTypeId> &edge_types) {
+    LogicalOperator *parent = nullptr;
+    auto *op = last_op.get();
+    while (op->GetTypeInfo() == Filter::kType || op->GetTypeInfo() == EdgeUniquenessFilter::kType) {
+      parent = op;
+      op = op->input().get();
+    }
+    if (op->GetTypeInfo() != Expand::kType) return false;
+    auto *expand = static_cast<Expand *>(op);
+    if (expand->common_.existing_node || expand->view_ != storage::View::OLD) return false;
+
+    // The closing expansion is done from the node bound before the Expand
+    const auto &new_node = expand->common_.node_symbol;
+    if ((node1_symbol == new_node) == (node2_symbol == new_node)) return false;
+    const auto &anchor_symbol = node1_symbol == new_node ? node2_symbol : node1_symbol;
+    if (node1_symbol == new_node && direction != EdgeAtom::Direction::BOTH) {
+      direction = direction == EdgeAtom::Direction::IN ? EdgeAtom::Direction::OUT : EdgeAtom::Direction::IN;
+    }
+
+    auto intersect_expand = std::make_unique<IntersectExpand>(
+        expand->input(), expand->input_symbol_, expand->common_, anchor_symbol,
+        ExpandCommon{new_node, edge_symbol, direction, edge_types, true}, storage::View::OLD);
+    if (parent) {
+      parent->set_input(std::move(intersect_expand));
+    } else {
+      last_op = std::move(intersect_expand);
+    }
+    return true;
+  }
+
   std::unique_ptr<LogicalOperator> EnsureCyphermorphism(std::unique_ptr<LogicalOperator> last_op,
                                                         const Symbol &edge_symbol, const Matching &matching,
                                                         const std::unordered_set<Symbol> &bound_symbols) {
@@ -128,6 +128,10 @@ class VertexCountCache {
     return db_->LabelPropertyIndexExists(label, property);
   }
 
+  bool LabelPropertyHashIndexExists(storage::LabelId label, storage::PropertyId property) {
+    return db_->LabelPropertyHashIndexExists(label, property);
+  }
+
   bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) { return db_->EdgeTypeIndexExists(edge_type); }
 
   bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) {
@@ -20,8 +20,10 @@
 #include <regex>
 #include <stdexcept>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "flags/experimental.hpp"
 #include "flags/run_time_configurable.hpp"
@@ -3543,6 +3545,20 @@ void NextPermitted(mgp_vertices_iterator &it) {
 }  // namespace
 #endif
 
+namespace {
+void EmplaceCurrentVertex(mgp_vertices_iterator &it) {
+  std::visit(memgraph::utils::Overloaded{
+                 [&it](memgraph::query::DbAccessor *) {
+                   it.current_v.emplace(*it.current_it, it.graph, it.GetMemoryResource());
+                 },
+                 [&it](memgraph::query::SubgraphDbAccessor *impl) {
+                   it.current_v.emplace(memgraph::query::SubgraphVertexAccessor(*it.current_it, impl->getGraph()),
+                                        it.graph, it.GetMemoryResource());
+                 }},
+             it.graph->impl);
+}
+}  // namespace
+
 /// @throw anything VerticesIterable may throw
 mgp_vertices_iterator::mgp_vertices_iterator(mgp_graph *graph, memgraph::utils::MemoryResource *memory)
     : memory(memory),
@@ -3609,16 +3625,7 @@ mgp_error mgp_vertices_iterator_next(mgp_vertices_iterator *it, mgp_vertex **res
         }
 
         memgraph::utils::OnScopeExit clean_up([it] { it->current_v = std::nullopt; });
-        std::visit(memgraph::utils::Overloaded{[it](memgraph::query::DbAccessor *) {
-                                                 it->current_v.emplace(*it->current_it, it->graph,
-                                                                       it->GetMemoryResource());
-                                               },
-                                               [it](memgraph::query::SubgraphDbAccessor *impl) {
-                                                 it->current_v.emplace(memgraph::query::SubgraphVertexAccessor(
-                                                                           *it->current_it, impl->getGraph()),
-                                                                       it->graph, it->GetMemoryResource());
-                                               }},
-                   it->graph->impl);
+        EmplaceCurrentVertex(*it);
 
         clean_up.Disable();
         return &*it->current_v;
@@ -3626,6 +3633,246 @@ mgp_error mgp_vertices_iterator_next(mgp_vertices_iterator *it, mgp_vertex **res
       result);
 }
 
+namespace {
+template <typename TValue>
+TValue GetBatchedValue(memgraph::storage::Result<TValue> &&maybe_value) {
+  if (maybe_value.HasError()) {
+    switch (maybe_value.GetError()) {
+      case memgraph::storage::Error::DELETED_OBJECT:
+        throw DeletedObjectException{"Cannot read a deleted object in a batch!"};
+      case memgraph::storage::Error::NONEXISTENT_OBJECT:
+        LOG_FATAL("Query modules shouldn't have access to nonexistent objects when reading graph data in a batch!");
+      case memgraph::storage::Error::PROPERTIES_DISABLED:
+      case memgraph::storage::Error::VERTEX_HAS_EDGES:
+      case memgraph::storage::Error::SERIALIZATION_ERROR:
+        LOG_FATAL("Unexpected error when reading graph data in a batch.");
+    }
+  }
+  return std::move(*maybe_value);
+}
+
+std::optional<double> NumericPropertyValue(const memgraph::storage::PropertyValue &value) {
+  if (value.IsInt()) return static_cast<double>(value.ValueInt());
+  if (value.IsDouble()) return value.ValueDouble();
+  return std::nullopt;
+}
+
+void ValidateVertexBatch(const mgp_vertex_batch &batch) {
+  if (batch.capacity == 0 || batch.ids == nullptr) {
+    throw std::invalid_argument{"Vertex batch must have a non-zero capacity and an ids buffer!"};
+  }
+  if (batch.labels_count != 0 && (batch.label_names == nullptr || batch.has_labels == nullptr)) {
+    throw std::invalid_argument{"Vertex batch with labels must have label names and a has_labels buffer!"};
+  }
+  if (batch.properties_count != 0 &&
+      (batch.property_names == nullptr || batch.property_values == nullptr || batch.property_present == nullptr)) {
+    throw std::invalid_argument{"Vertex batch with properties must have property names and value buffers!"};
+  }
+}
+
+bool CanReadVertex(const mgp_graph &graph, const memgraph::query::VertexAccessor &vertex) {
+#ifdef MG_ENTERPRISE
+  if (memgraph::license::global_license_checker.IsEnterpriseValidFast() && graph.ctx && graph.ctx->auth_checker) {
+    return graph.ctx->auth_checker->Has(vertex, graph.view, memgraph::query::AuthQuery::FineGrainedPrivilege::READ);
+  }
+#endif
+  return true;
+}
+
+bool CanReadEdge(const mgp_graph &graph, const memgraph::query::EdgeAccessor &edge) {
+#ifdef MG_ENTERPRISE
+  if (memgraph::license::global_license_checker.IsEnterpriseValidFast() && graph.ctx && graph.ctx->auth_checker) {
+    return graph.ctx->auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ);
+  }
+#endif
+  return true;
+}
+}  // namespace
+
+mgp_error mgp_vertices_iterator_next_batch(mgp_vertices_iterator *it, mgp_vertex_batch *batch, size_t *result) {
+  return WrapExceptions(
+      [it, batch]() -> size_t {
+        ValidateVertexBatch(*batch);
+        // Names are resolved once per batch instead of once per vertex.
+        std::vector<memgraph::storage::LabelId> labels;
+        labels.reserve(batch->labels_count);
+        for (size_t i = 0; i < batch->labels_count; ++i) {
+          labels.push_back(std::visit([name = batch->label_names[i]](auto *impl) { return impl->NameToLabel(name); },
+                                      it->graph->impl));
+        }
+        std::vector<memgraph::storage::PropertyId> properties;
+        properties.reserve(batch->properties_count);
+        for (size_t i = 0; i < batch->properties_count; ++i) {
+          properties.push_back(
+              std::visit([name = batch->property_names[i]](auto *impl) { return impl->NameToProperty(name); },
+                         it->graph->impl));
+        }
+
+        const auto view = it->graph->view;
+        const auto capacity = batch->capacity;
+        it->current_v = std::nullopt;
+        size_t count = 0;
+        while (count < capacity && it->current_it != it->vertices.end()) {
+          const auto vertex = *it->current_it;
+          batch->ids[count] = vertex.Gid().AsInt();
+          for (size_t i = 0; i < labels.size(); ++i) {
+            batch->has_labels[(i * capacity) + count] =
+                GetBatchedValue(vertex.HasLabel(view, labels[i])) ? 1 : 0;
+          }
+          for (size_t i = 0; i < properties.size(); ++i) {
+            const auto value = NumericPropertyValue(GetBatchedValue(vertex.GetProperty(view, properties[i])));
+            batch->property_values[(i * capacity) + count] = value.value_or(0.0);
+            batch->property_present[(i * capacity) + count] = value ? 1 : 0;
+          }
+          ++count;
+
+          ++it->current_it;
+#ifdef MG_ENTERPRISE
+          if (memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
+            NextPermitted(*it);
+          }
+#endif
+        }
+
+        if (it->current_it != it->vertices.end()) {
+          EmplaceCurrentVertex(*it);
+        }
+        return count;
+      },
+      result);
+}
+
+void mgp_graph_csr_destroy(mgp_graph_csr *csr) { DeleteRawMgpObject(csr); }
+
+namespace {
+bool CanReadWholeGraph(const mgp_graph &graph) {
+#ifdef MG_ENTERPRISE
+  if (memgraph::license::global_license_checker.IsEnterpriseValidFast() && graph.ctx && graph.ctx->auth_checker) {
+    return graph.ctx->auth_checker->HasGlobalPrivilegeOnVertices(
+               memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+           graph.ctx->auth_checker->HasGlobalPrivilegeOnEdges(memgraph::query::AuthQuery::FineGrainedPrivilege::READ);
+  }
+#endif
+  return true;
+}
+
+// Builds the projection through the query layer, which filters the graph by
+// the subgraph and the fine-grained permissions of the caller.
+memgraph::storage::GraphProjection BuildFilteredGraphProjection(mgp_graph *graph,
+                                                                const memgraph::storage::GraphProjectionSpec &spec) {
+  memgraph::storage::GraphProjection projection;
+  const auto view = graph->view;
+
+  std::vector<memgraph::query::VertexAccessor> vertices;
+  std::unordered_map<memgraph::storage::Gid, size_t> dense_index;
+  for (auto vertex : std::visit([view](auto *impl) { return impl->Vertices(view); }, graph->impl)) {
+    if (!CanReadVertex(*graph, vertex)) continue;
+    if (!spec.labels.empty() && std::ranges::none_of(spec.labels, [&](auto label) {
+          return GetBatchedValue(vertex.HasLabel(view, label));
+        })) {
+      continue;
+    }
+    dense_index.emplace(vertex.Gid(), vertices.size());
+    projection.vertex_ids.push_back(vertex.Gid().AsInt());
+    vertices.push_back(vertex);
+  }
+
+  projection.offsets.reserve(vertices.size() + 1);
+  projection.offsets.push_back(0);
+  for (const auto &vertex : vertices) {
+    auto out_edges = GetBatchedValue(std::visit(
+        memgraph::utils::Overloaded{
+            [&vertex, view](memgraph::query::DbAccessor *) { return vertex.OutEdges(view); },
+            [&vertex, view](memgraph::query::SubgraphDbAccessor *impl) {
+              return memgraph::query::SubgraphVertexAccessor(vertex, impl->getGraph()).OutEdges(view);
+            }},
+        graph->impl));
+    for (const auto &edge : out_edges.edges) {
+      if (!CanReadEdge(*graph, edge)) continue;
+      if (!spec.edge_types.empty() && !memgraph::utils::Contains(spec.edge_types, edge.EdgeType())) continue;
+      // Destinations which are not visible to the caller are not exported.
+      const auto target = dense_index.find(edge.To().Gid());
+      if (target == dense_index.end()) continue;
+      projection.targets.push_back(target->second);
+      projection.edge_ids.push_back(edge.Gid().AsInt());
+      projection.edge_types.push_back(edge.EdgeType());
+      if (spec.weight_property) {
+        const auto value = NumericPropertyValue(GetBatchedValue(edge.GetProperty(view, *spec.weight_property)));
+        projection.weights.push_back(value.value_or(1.0));
+      }
+    }
+    projection.offsets.push_back(projection.targets.size());
+  }
+  return projection;
+}
+}  // namespace
+
+mgp_error mgp_graph_project_csr(mgp_graph *graph, const char *const *labels, size_t labels_count,
+                                const char *const *edge_types, size_t edge_types_count, const char *weight_property,
+                                mgp_memory *memory, mgp_graph_csr **result) {
+  return WrapExceptions(
+      [=]() -> mgp_graph_csr * {
+        if ((labels_count != 0 && labels == nullptr) || (edge_types_count != 0 && edge_types == nullptr)) {
+          throw std::invalid_argument{"Label and edge type names must be given when their count is non-zero!"};
+        }
+        auto *db_impl = graph->getImpl();
+        memgraph::storage::GraphProjectionSpec spec;
+        for (size_t i = 0; i < labels_count; ++i) {
+          spec.labels.push_back(db_impl->NameToLabel(labels[i]));
+        }
+        for (size_t i = 0; i < edge_types_count; ++i) {
+          spec.edge_types.push_back(db_impl->NameToEdgeType(edge_types[i]));
+        }
+        if (weight_property != nullptr) {
+          spec.weight_property = db_impl->NameToProperty(weight_property);
+        }
+
+        std::shared_ptr<const memgraph::storage::GraphProjection> projection;
+        if (std::holds_alternative<memgraph::query::DbAccessor *>(graph->impl) && CanReadWholeGraph(*graph)) {
+          projection = db_impl->GetStorageAccessor()->Projection(spec, graph->view);
+        } else {
+          projection = std::make_shared<const memgraph::storage::GraphProjection>(
+              BuildFilteredGraphProjection(graph, spec));
+        }
+        return NewRawMgpObject<mgp_graph_csr>(memory, std::move(projection), spec.weight_property.has_value());
+      },
+      result);
+}
+
+mgp_error mgp_graph_export_csr(mgp_graph *graph, const char *weight_property, mgp_memory *memory,
+                               mgp_graph_csr **result) {
+  return mgp_graph_project_csr(graph, nullptr, 0, nullptr, 0, weight_property, memory, result);
+}
+
+mgp_error mgp_graph_csr_vertex_count(mgp_graph_csr *csr, size_t *result) {
+  return WrapExceptions([csr] { return csr->projection->VertexCount(); }, result);
+}
+
+mgp_error mgp_graph_csr_edge_count(mgp_graph_csr *csr, size_t *result) {
+  return WrapExceptions([csr] { return csr->projection->EdgeCount(); }, result);
+}
+
+mgp_error mgp_graph_csr_vertex_ids(mgp_graph_csr *csr, const int64_t **result) {
+  return WrapExceptions([csr] { return csr->projection->vertex_ids.data(); }, result);
+}
+
+mgp_error mgp_graph_csr_offsets(mgp_graph_csr *csr, const size_t **result) {
+  return WrapExceptions([csr] { return csr->projection->offsets.data(); }, result);
+}
+
+mgp_error mgp_graph_csr_targets(mgp_graph_csr *csr, const size_t **result) {
+  return WrapExceptions([csr] { return csr->projection->targets.data(); }, result);
+}
+
+mgp_error mgp_graph_csr_edge_ids(mgp_graph_csr *csr, const int64_t **result) {
+  return WrapExceptions([csr] { return csr->projection->edge_ids.data(); }, result);
+}
+
+mgp_error mgp_graph_csr_weights(mgp_graph_csr *csr, const double **result) {
+  return WrapExceptions(
+      [csr]() -> const double * { return csr->has_weights ? csr->projection->weights.data() : nullptr; }, result);
+}
+
 /// Type System
 ///
 /// All types are allocated globally, so that we simplify the API and minimize
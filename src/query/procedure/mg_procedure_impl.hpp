@@ -28,6 +28,7 @@
 #include "query/db_accessor.hpp"
 #include "query/procedure/cypher_type_ptr.hpp"
 #include "query/typed_value.hpp"
+#include "storage/v2/graph_projection.hpp"
 #include "storage/v2/view.hpp"
 #include "utils/memory.hpp"
 #include "utils/pmr/map.hpp"
@@ -730,6 +731,28 @@ struct mgp_vertices_iterator {
   std::optional<mgp_vertex> current_v;
 };
 
+struct mgp_graph_csr {
+  using allocator_type = memgraph::utils::Allocator<mgp_graph_csr>;
+
+  mgp_graph_csr(std::shared_ptr<const memgraph::storage::GraphProjection> projection, bool has_weights,
+                memgraph::utils::MemoryResource *memory)
+      : memory(memory), projection(std::move(projection)), has_weights(has_weights) {}
+
+  mgp_graph_csr(const mgp_graph_csr &) = delete;
+  mgp_graph_csr(mgp_graph_csr &&) = delete;
+  mgp_graph_csr &operator=(const mgp_graph_csr &) = delete;
+  mgp_graph_csr &operator=(mgp_graph_csr &&) = delete;
+
+  ~mgp_graph_csr() = default;
+
+  memgraph::utils::MemoryResource *GetMemoryResource() const { return memory; }
+
+  memgraph::utils::MemoryResource *memory;
+  /// May be shared with other procedures through the storage projection cache.
+  std::shared_ptr<const memgraph::storage::GraphProjection> projection;
+  bool has_weights;
+};
+
 struct mgp_type {
   memgraph::query::procedure::CypherTypePtr impl;
 };
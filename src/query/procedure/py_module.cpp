@@ -21,6 +21,8 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <vector>
 
 #include "mg_procedure.h"
 #include "query/exceptions.hpp"
@@ -385,6 +387,203 @@ PyObject *PyGraphIterVertices(PyGraph *self, PyObject *Py_UNUSED(ignored)) {
   return reinterpret_cast<PyObject *>(py_vertices_it);
 }
 
+// clang-format off
+struct PyGraphCsr {
+  PyObject_HEAD
+  mgp_graph_csr *csr;
+  PyGraph *py_graph;
+};
+// clang-format on
+
+void PyGraphCsrDealloc(PyGraphCsr *self) {
+  MG_ASSERT(self->csr);
+  MG_ASSERT(self->py_graph);
+  // Avoid invoking `mgp_graph_csr_destroy` if we are not in valid execution
+  // context. The query execution should free all memory used during
+  // execution, so we may cause a double free issue.
+  if (self->py_graph->graph) mgp_graph_csr_destroy(self->csr);
+  Py_DECREF(self->py_graph);
+  Py_TYPE(self)->tp_free(self);
+}
+
+template <typename TElement>
+PyObject *MakePyListFromCsrArray(mgp_graph_csr *csr, mgp_error (*get_array)(mgp_graph_csr *, const TElement **),
+                                 size_t size) {
+  const TElement *array{nullptr};
+  if (RaiseExceptionFromErrorCode(get_array(csr, &array))) {
+    return nullptr;
+  }
+  if (array == nullptr) {
+    Py_INCREF(Py_None);
+    return Py_None;
+  }
+  auto *py_list = PyList_New(static_cast<Py_ssize_t>(size));
+  if (!py_list) return nullptr;
+  for (size_t i = 0; i < size; ++i) {
+    PyObject *py_element{nullptr};
+    if constexpr (std::is_floating_point_v<TElement>) {
+      py_element = PyFloat_FromDouble(array[i]);
+    } else if constexpr (std::is_signed_v<TElement>) {
+      py_element = PyLong_FromLongLong(array[i]);
+    } else {
+      py_element = PyLong_FromSize_t(array[i]);
+    }
+    if (!py_element) {
+      Py_DECREF(py_list);
+      return nullptr;
+    }
+    PyList_SET_ITEM(py_list, static_cast<Py_ssize_t>(i), py_element);
+  }
+  return py_list;
+}
+
+template <typename TElement>
+PyObject *PyGraphCsrArray(PyGraphCsr *self, mgp_error (*get_array)(mgp_graph_csr *, const TElement **),
+                          bool per_vertex) {
+  MG_ASSERT(self->csr);
+  MG_ASSERT(PyGraphIsValidImpl(*self->py_graph));
+  size_t size{0};
+  if (RaiseExceptionFromErrorCode(per_vertex ? mgp_graph_csr_vertex_count(self->csr, &size)
+                                             : mgp_graph_csr_edge_count(self->csr, &size))) {
+    return nullptr;
+  }
+  return MakePyListFromCsrArray(self->csr, get_array, size);
+}
+
+PyObject *PyGraphCsrVertexCount(PyGraphCsr *self, PyObject *Py_UNUSED(ignored)) {
+  MG_ASSERT(self->csr);
+  size_t count{0};
+  if (RaiseExceptionFromErrorCode(mgp_graph_csr_vertex_count(self->csr, &count))) {
+    return nullptr;
+  }
+  return PyLong_FromSize_t(count);
+}
+
+PyObject *PyGraphCsrEdgeCount(PyGraphCsr *self, PyObject *Py_UNUSED(ignored)) {
+  MG_ASSERT(self->csr);
+  size_t count{0};
+  if (RaiseExceptionFromErrorCode(mgp_graph_csr_edge_count(self->csr, &count))) {
+    return nullptr;
+  }
+  return PyLong_FromSize_t(count);
+}
+
+PyObject *PyGraphCsrVertexIds(PyGraphCsr *self, PyObject *Py_UNUSED(ignored)) {
+  return PyGraphCsrArray(self, mgp_graph_csr_vertex_ids, true);
+}
+
+PyObject *PyGraphCsrOffsets(PyGraphCsr *self, PyObject *Py_UNUSED(ignored)) {
+  MG_ASSERT(self->csr);
+  MG_ASSERT(PyGraphIsValidImpl(*self->py_graph));
+  size_t vertex_count{0};
+  if (RaiseExceptionFromErrorCode(mgp_graph_csr_vertex_count(self->csr, &vertex_count))) {
+    return nullptr;
+  }
+  return MakePyListFromCsrArray(self->csr, mgp_graph_csr_offsets, vertex_count + 1);
+}
+
+PyObject *PyGraphCsrTargets(PyGraphCsr *self, PyObject *Py_UNUSED(ignored)) {
+  return PyGraphCsrArray(self, mgp_graph_csr_targets, false);
+}
+
+PyObject *PyGraphCsrEdgeIds(PyGraphCsr *self, PyObject *Py_UNUSED(ignored)) {
+  return PyGraphCsrArray(self, mgp_graph_csr_edge_ids, false);
+}
+
+PyObject *PyGraphCsrWeights(PyGraphCsr *self, PyObject *Py_UNUSED(ignored)) {
+  return PyGraphCsrArray(self, mgp_graph_csr_weights, false);
+}
+
+static PyMethodDef PyGraphCsrMethods[] = {
+    {"__reduce__", reinterpret_cast<PyCFunction>(DisallowPickleAndCopy), METH_NOARGS, "__reduce__ is not supported"},
+    {"vertex_count", reinterpret_cast<PyCFunction>(PyGraphCsrVertexCount), METH_NOARGS,
+     "Return the number of projected vertices."},
+    {"edge_count", reinterpret_cast<PyCFunction>(PyGraphCsrEdgeCount), METH_NOARGS,
+     "Return the number of projected edges."},
+    {"vertex_ids", reinterpret_cast<PyCFunction>(PyGraphCsrVertexIds), METH_NOARGS,
+     "Return the list of vertex IDs, indexed by the dense vertex index."},
+    {"offsets", reinterpret_cast<PyCFunction>(PyGraphCsrOffsets), METH_NOARGS,
+     "Return the list of vertex_count() + 1 offsets into the edge lists."},
+    {"targets", reinterpret_cast<PyCFunction>(PyGraphCsrTargets), METH_NOARGS,
+     "Return the list of dense indices of edge destinations."},
+    {"edge_ids", reinterpret_cast<PyCFunction>(PyGraphCsrEdgeIds), METH_NOARGS, "Return the list of edge IDs."},
+    {"weights", reinterpret_cast<PyCFunction>(PyGraphCsrWeights), METH_NOARGS,
+     "Return the list of edge weights or None if projected without weights."},
+    {nullptr, {}, {}, {}},
+};
+
+// clang-format off
+static PyTypeObject PyGraphCsrType = {
+    PyVarObject_HEAD_INIT(nullptr, 0)
+    .tp_name = "_mgp.GraphCsr",
+    .tp_basicsize = sizeof(PyGraphCsr),
+    .tp_dealloc = reinterpret_cast<destructor>(PyGraphCsrDealloc),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = "Wraps struct mgp_graph_csr.",
+    .tp_methods = PyGraphCsrMethods,
+};
+// clang-format on
+
+std::optional<std::vector<std::string>> PySequenceToStrings(PyObject *py_sequence, const char *error_message) {
+  auto *py_fast = PySequence_Fast(py_sequence, error_message);
+  if (!py_fast) return std::nullopt;
+  std::vector<std::string> strings;
+  const auto size = PySequence_Fast_GET_SIZE(py_fast);
+  strings.reserve(size);
+  for (Py_ssize_t i = 0; i < size; ++i) {
+    const auto *str = PyUnicode_AsUTF8(PySequence_Fast_GET_ITEM(py_fast, i));
+    if (!str) {
+      Py_DECREF(py_fast);
+      return std::nullopt;
+    }
+    strings.emplace_back(str);
+  }
+  Py_DECREF(py_fast);
+  return strings;
+}
+
+PyObject *PyGraphProjectCsr(PyGraph *self, PyObject *args) {
+  MG_ASSERT(PyGraphIsValidImpl(*self));
+  MG_ASSERT(self->memory);
+  PyObject *py_labels{nullptr};
+  PyObject *py_edge_types{nullptr};
+  const char *weight_property{nullptr};
+  if (!PyArg_ParseTuple(args, "OOz", &py_labels, &py_edge_types, &weight_property)) return nullptr;
+  auto labels = PySequenceToStrings(py_labels, "Expected a sequence of label names.");
+  if (!labels) return nullptr;
+  auto edge_types = PySequenceToStrings(py_edge_types, "Expected a sequence of edge type names.");
+  if (!edge_types) return nullptr;
+
+  std::vector<const char *> label_names;
+  label_names.reserve(labels->size());
+  for (const auto &label : *labels) label_names.push_back(label.c_str());
+  std::vector<const char *> edge_type_names;
+  edge_type_names.reserve(edge_types->size());
+  for (const auto &edge_type : *edge_types) edge_type_names.push_back(edge_type.c_str());
+
+  mgp_graph_csr *csr{nullptr};
+  mgp_error error{mgp_error::MGP_ERROR_NO_ERROR};
+  {
+    // Building the projection scans the whole graph and doesn't touch any
+    // Python objects, so let other Python procedures run in the meantime.
+    py::ReleaseGIL no_gil;
+    error = mgp_graph_project_csr(self->graph, label_names.data(), label_names.size(), edge_type_names.data(),
+                                  edge_type_names.size(), weight_property, self->memory, &csr);
+  }
+  if (RaiseExceptionFromErrorCode(error)) {
+    return nullptr;
+  }
+  auto *py_csr = PyObject_New(PyGraphCsr, &PyGraphCsrType);
+  if (!py_csr) {
+    mgp_graph_csr_destroy(csr);
+    return nullptr;
+  }
+  py_csr->csr = csr;
+  Py_INCREF(self);
+  py_csr->py_graph = self;
+  return reinterpret_cast<PyObject *>(py_csr);
+}
+
 PyObject *PyGraphMustAbort(PyGraph *self, PyObject *Py_UNUSED(ignored)) {
   MG_ASSERT(PyGraphIsValidImpl(*self));
   return PyBool_FromLong(mgp_must_abort(self->graph));
@@ -407,6 +606,8 @@ static PyMethodDef PyGraphMethods[] = {
      "Delete a vertex and all of its edges."},
     {"delete_edge", reinterpret_cast<PyCFunction>(PyGraphDeleteEdge), METH_VARARGS, "Delete an edge."},
     {"iter_vertices", reinterpret_cast<PyCFunction>(PyGraphIterVertices), METH_NOARGS, "Return _mgp.VerticesIterator."},
+    {"project_csr", reinterpret_cast<PyCFunction>(PyGraphProjectCsr), METH_VARARGS,
+     "Return _mgp.GraphCsr with the adjacency of the projected part of the graph."},
     {"must_abort", reinterpret_cast<PyCFunction>(PyGraphMustAbort), METH_NOARGS,
      "Check whether the running procedure should abort"},
     {nullptr, {}, {}, {}},
@@ -2518,6 +2719,7 @@ PyObject *PyInitMgpModule() {
   if (!register_type(&PyVerticesIteratorType, "VerticesIterator")) return nullptr;
   if (!register_type(&PyEdgesIteratorType, "EdgesIterator")) return nullptr;
   if (!register_type(&PyGraphType, "Graph")) return nullptr;
+  if (!register_type(&PyGraphCsrType, "GraphCsr")) return nullptr;
   if (!register_type(&PyEdgeType, "Edge")) return nullptr;
   if (!register_type(&PyQueryProcType, "Proc")) return nullptr;
   if (!register_type(&PyMagicFuncType, "Func")) return nullptr;
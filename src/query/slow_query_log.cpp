@@ -0,0 +1,70 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/slow_query_log.hpp"
+
+#include <json/json.hpp>
+#include <spdlog/details/thread_pool.h>
+#include <spdlog/sinks/rotating_file_sink.h>
+
+#include "utils/timestamp.hpp"
+
+namespace memgraph::query {
+
+namespace {
+// Maximum number of entries waiting to be written. When the queue is full the
+// oldest entries are dropped instead of blocking the queries.
+constexpr size_t kQueueSize = 8192;
+
+template <typename T>
+nlohmann::json OptionalToJson(const std::optional<T> &value) {
+  if (!value) return nullptr;
+  return *value;
+}
+}  // namespace
+
+SlowQueryLog::SlowQueryLog(const std::filesystem::path &log_file, std::chrono::microseconds threshold,
+                           size_t max_file_size, size_t max_files)
+    : threshold_(threshold), thread_pool_(std::make_shared<spdlog::details::thread_pool>(kQueueSize, 1)) {
+  auto sink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(log_file.string(), max_file_size, max_files);
+  logger_ = std::make_shared<spdlog::async_logger>("SlowQueryLog", std::move(sink), thread_pool_,
+                                                   spdlog::async_overflow_policy::overrun_oldest);
+  logger_->set_pattern("%v");
+  logger_->set_level(spdlog::level::info);
+  logger_->flush_on(spdlog::level::info);
+}
+
+SlowQueryLog::~SlowQueryLog() {
+  logger_->flush();
+  logger_.reset();
+}
+
+void SlowQueryLog::Record(const SlowQueryLogEntry &entry) {
+  const nlohmann::json json{{"timestamp", utils::Timestamp::Now().ToIso8601()},
+                            {"query", entry.query},
+                            {"db", entry.db},
+                            {"username", OptionalToJson(entry.username)},
+                            {"transaction_id", OptionalToJson(entry.transaction_id)},
+                            {"parsing_time", OptionalToJson(entry.parsing_time)},
+                            {"planning_time", OptionalToJson(entry.planning_time)},
+                            {"execution_time", OptionalToJson(entry.execution_time)},
+                            {"total_time", entry.total_time},
+                            {"results", entry.results},
+                            {"number_of_hops", OptionalToJson(entry.number_of_hops)},
+                            {"peak_memory", OptionalToJson(entry.peak_memory)},
+                            {"plan", OptionalToJson(entry.plan)},
+                            {"error", OptionalToJson(entry.error)}};
+  logger_->info(json.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace));
+}
+
+void SlowQueryLog::Flush() { logger_->flush(); }
+
+}  // namespace memgraph::query
@@ -0,0 +1,79 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <spdlog/async_logger.h>
+
+namespace memgraph::query {
+
+/**
+ * Everything recorded about a single slow query. Times are in seconds, the
+ * same unit used in the query summary.
+ */
+struct SlowQueryLogEntry {
+  std::string_view query;
+  std::string_view db;
+  std::optional<std::string> username;
+  std::optional<uint64_t> transaction_id;
+  std::optional<double> parsing_time;
+  std::optional<double> planning_time;
+  std::optional<double> execution_time;
+  double total_time{0};
+  uint64_t results{0};
+  std::optional<int64_t> number_of_hops;
+  // Only known for queries executed with a memory limit.
+  std::optional<int64_t> peak_memory;
+  std::optional<std::string> plan;
+  // Set for queries that failed.
+  std::optional<std::string_view> error;
+};
+
+/**
+ * Writes queries which exceed the threshold into a rotating log file. Each
+ * entry is a single JSON object per line. Entries are formatted on the calling
+ * thread and written by a background thread, so recording a slow query never
+ * waits on the disk.
+ */
+class SlowQueryLog {
+ public:
+  SlowQueryLog(const std::filesystem::path &log_file, std::chrono::microseconds threshold, size_t max_file_size,
+               size_t max_files);
+
+  SlowQueryLog(const SlowQueryLog &) = delete;
+  SlowQueryLog &operator=(const SlowQueryLog &) = delete;
+  SlowQueryLog(SlowQueryLog &&) = delete;
+  SlowQueryLog &operator=(SlowQueryLog &&) = delete;
+
+  ~SlowQueryLog();
+
+  bool IsSlow(std::chrono::microseconds duration) const { return duration >= threshold_; }
+
+  void Record(const SlowQueryLogEntry &entry);
+
+  void Flush();
+
+ private:
+  std::chrono::microseconds threshold_;
+  // The logger only holds a weak reference to its thread pool.
+  std::shared_ptr<spdlog::details::thread_pool> thread_pool_;
+  std::shared_ptr<spdlog::async_logger> logger_;
+};
+
+}  // namespace memgraph::query
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -41,7 +42,12 @@ class AnyStream final {
                   .template delete_object<GenericWrapper<TStream>>(static_cast<GenericWrapper<TStream> *>(ptr));
             }} {}
 
-  void Result(const std::vector<TypedValue> &values) { content_->Result(values); }
+  void Result(const std::vector<TypedValue> &values) {
+    content_->Result(values);
+    ++num_results_;
+  }
+
+  uint64_t NumResults() const { return num_results_; }
 
  private:
   struct Wrapper {
@@ -59,6 +65,7 @@ class AnyStream final {
   };
 
   std::unique_ptr<Wrapper, std::function<void(Wrapper *)>> content_;
+  uint64_t num_results_{0};
 };
 
 }  // namespace memgraph::query
@@ -244,10 +244,10 @@ class TTL final {
   template <typename TDbAccess>
   void Setup_(TDbAccess db, InterpreterContext *interpreter_context);
 
-  utils::Scheduler ttl_;      //!< background thread
-  TtlInfo info_{};            //!< configuration
-  bool enabled_{false};       //!< feature enabler
-  kvstore::KVStore storage_;  //!< durability
+  utils::Scheduler ttl_{utils::TaskPriority::LOW};  //!< background task
+  TtlInfo info_{};                                  //!< configuration
+  bool enabled_{false};                             //!< feature enabler
+  kvstore::KVStore storage_;                        //!< durability
 };
 
 }  // namespace ttl
@@ -36,6 +36,10 @@ constexpr auto v3 = Version{2024'02'02'0'2'14};
 // this is due to auto index creation
 constexpr auto v4 = Version{2024'07'02'0'2'18};
 
-constexpr auto current_version = v4;
+// Large snapshot and WAL files are staged on the replica in chunks and
+// files sent inline carry a staging flag
+constexpr auto v5 = Version{2024'09'16'0'2'19};
+
+constexpr auto current_version = v5;
 
 }  // namespace memgraph::rpc
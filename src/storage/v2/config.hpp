@@ -121,6 +121,10 @@ struct Config {
     bool snapshot_on_exit{false};                      // PER DATABASE
     bool restore_replication_state_on_startup{false};  // PER INSTANCE
 
+    // Replicas load snapshots while they're being received, next to their old data
+    bool streamed_snapshot_load{false};                                                 // PER INSTANCE
+    std::chrono::milliseconds streamed_snapshot_load_timeout{std::chrono::minutes(1)};  // PER INSTANCE
+
     uint64_t items_per_batch{1'000'000};  // PER DATABASE
     uint64_t recovery_thread_count{8};    // PER INSTANCE SYSTEM FLAG
 
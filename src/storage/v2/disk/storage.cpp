@@ -1771,6 +1771,8 @@ utils::BasicResult<StorageManipulationError, void> DiskStorage::DiskAccessor::Co
         case MetadataDelta::Action::POINT_INDEX_CREATE:
         case MetadataDelta::Action::POINT_INDEX_DROP:
           throw utils::NotYetImplemented("Point index is not implemented for DiskStorage.");
+        case MetadataDelta::Action::LABEL_PROPERTY_HASH_INDEX_CREATE:
+          throw utils::NotYetImplemented("Hash index is not implemented for DiskStorage.");
       }
     }
   } else if (transaction_.deltas.empty() ||
@@ -2082,6 +2084,11 @@ utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DiskAccessor:
       "Edge-type index related operations are not yet supported using on-disk storage mode.");
 }
 
+utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DiskAccessor::CreateHashIndex(
+    LabelId /*label*/, PropertyId /*property*/) {
+  throw utils::NotYetImplemented("Hash index related operations are not yet supported using on-disk storage mode.");
+}
+
 utils::BasicResult<storage::StorageIndexDefinitionError, void> DiskStorage::DiskAccessor::CreatePointIndex(
     storage::LabelId /*label*/, storage::PropertyId /*property*/) {
   throw utils::NotYetImplemented("Point index related operations are not yet supported using on-disk storage mode.");
@@ -2242,8 +2249,9 @@ IndicesInfo DiskStorage::DiskAccessor::ListAllIndices() const {
       static_cast<DiskLabelPropertyIndex *>(on_disk->indices_.label_property_index_.get());
   auto &text_index = storage_->indices_.text_index_;
   return {disk_label_index->ListIndices(), disk_label_property_index->ListIndices(),
-          {/* edge type indices */},       {/* edge_type_property */},
-          text_index.ListIndices(),        {/*  */}};
+          {/* label_property_hash */},     {/* edge type indices */},
+          {/* edge_type_property */},      text_index.ListIndices(),
+          {/*  */}};
 }
 ConstraintsInfo DiskStorage::DiskAccessor::ListAllConstraints() const {
   auto *disk_storage = static_cast<DiskStorage *>(storage_);
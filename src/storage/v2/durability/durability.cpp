@@ -205,6 +205,16 @@ void RecoverIndicesAndStats(const RecoveredIndicesAndConstraints::IndicesMetadat
   }
   spdlog::info("Label+property indices are recreated.");
 
+  // Recover hash lookups of label+property indices.
+  spdlog::info("Recreating {} label+property hash lookups from metadata.", indices_metadata.label_property_hash.size());
+  for (const auto &item : indices_metadata.label_property_hash) {
+    if (!mem_label_property_index->CreateHashLookup(item.first, item.second))
+      throw RecoveryFailure("The label+property hash lookup must be created here!");
+    spdlog::info("Hash lookup on :{}({}) is recreated from metadata", name_id_mapper->IdToName(item.first.AsUint()),
+                 name_id_mapper->IdToName(item.second.AsUint()));
+  }
+  spdlog::info("Label+property hash lookups are recreated.");
+
   // Recover label+property indices statistics.
   spdlog::info("Recreating {} label+property indices statistics from metadata.",
                indices_metadata.label_property_stats.size());
@@ -81,6 +81,7 @@ enum class Marker : uint8_t {
   DELTA_POINT_INDEX_DROP = 0x6f,
   DELTA_TYPE_CONSTRAINT_CREATE = 0x70,
   DELTA_TYPE_CONSTRAINT_DROP = 0x71,
+  DELTA_LABEL_PROPERTY_HASH_INDEX_CREATE = 0x72,
 
   VALUE_FALSE = 0x00,
   VALUE_TRUE = 0xff,
@@ -130,6 +131,7 @@ static const Marker kMarkersAll[] = {
     Marker::DELTA_LABEL_PROPERTY_INDEX_STATS_CLEAR,
     Marker::DELTA_LABEL_PROPERTY_INDEX_CREATE,
     Marker::DELTA_LABEL_PROPERTY_INDEX_DROP,
+    Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_CREATE,
     Marker::DELTA_EDGE_INDEX_CREATE,
     Marker::DELTA_EDGE_INDEX_DROP,
     Marker::DELTA_EDGE_PROPERTY_INDEX_CREATE,
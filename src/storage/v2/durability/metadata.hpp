@@ -42,6 +42,8 @@ struct RecoveredIndicesAndConstraints {
   struct IndicesMetadata {
     std::vector<LabelId> label;
     std::vector<std::pair<LabelId, PropertyId>> label_property;
+    // Subset of `label_property` that also keeps a hash lookup
+    std::vector<std::pair<LabelId, PropertyId>> label_property_hash;
     std::vector<std::pair<LabelId, PropertyId>> point_label_property;
     std::vector<std::pair<LabelId, LabelIndexStats>> label_stats;
     std::vector<std::pair<LabelId, std::pair<PropertyId, LabelPropertyIndexStats>>> label_property_stats;
@@ -239,6 +239,13 @@ std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, c
   return utils::LittleEndianToHost(version_encoded);
 }
 
+bool Decoder::InitializePart(const std::filesystem::path &path, uint64_t offset) {
+  file_.Close();
+  if (!file_.Open(path)) return false;
+  base_offset_ = offset;
+  return true;
+}
+
 bool Decoder::Read(uint8_t *data, size_t size) { return file_.Read(data, size); }
 
 bool Decoder::Peek(uint8_t *data, size_t size) { return file_.Peek(data, size); }
@@ -518,6 +525,7 @@ std::optional<PropertyValue> Decoder::ReadPropertyValue() {
     case Marker::DELTA_LABEL_PROPERTY_INDEX_STATS_CLEAR:
     case Marker::DELTA_LABEL_PROPERTY_INDEX_CREATE:
     case Marker::DELTA_LABEL_PROPERTY_INDEX_DROP:
+    case Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_CREATE:
     case Marker::DELTA_EDGE_INDEX_CREATE:
     case Marker::DELTA_EDGE_INDEX_DROP:
     case Marker::DELTA_EDGE_PROPERTY_INDEX_CREATE:
@@ -648,6 +656,7 @@ bool Decoder::SkipPropertyValue() {
     case Marker::DELTA_LABEL_PROPERTY_INDEX_STATS_CLEAR:
     case Marker::DELTA_LABEL_PROPERTY_INDEX_CREATE:
     case Marker::DELTA_LABEL_PROPERTY_INDEX_DROP:
+    case Marker::DELTA_LABEL_PROPERTY_HASH_INDEX_CREATE:
     case Marker::DELTA_EDGE_INDEX_CREATE:
     case Marker::DELTA_EDGE_INDEX_DROP:
     case Marker::DELTA_EDGE_PROPERTY_INDEX_CREATE:
@@ -671,10 +680,13 @@ bool Decoder::SkipPropertyValue() {
   }
 }
 
-std::optional<uint64_t> Decoder::GetSize() { return file_.GetSize(); }
+std::optional<uint64_t> Decoder::GetSize() { return file_.GetSize() + base_offset_; }
 
-std::optional<uint64_t> Decoder::GetPosition() { return file_.GetPosition(); }
+std::optional<uint64_t> Decoder::GetPosition() { return file_.GetPosition() + base_offset_; }
 
-bool Decoder::SetPosition(uint64_t position) { return !!file_.SetPosition(utils::InputFile::Position::SET, position); }
+bool Decoder::SetPosition(uint64_t position) {
+  if (position < base_offset_) return false;
+  return !!file_.SetPosition(utils::InputFile::Position::SET, static_cast<ssize_t>(position - base_offset_));
+}
 
 }  // namespace memgraph::storage::durability
@@ -112,6 +112,10 @@ class Decoder final : public BaseDecoder {
  public:
   std::optional<uint64_t> Initialize(const std::filesystem::path &path, const std::string &magic);
 
+  /// Switches to a file holding only the part of a snapshot/WAL that starts at
+  /// `offset`. Positions are still the ones in the whole snapshot/WAL.
+  bool InitializePart(const std::filesystem::path &path, uint64_t offset);
+
   // Main read functions, the only one that are allowed to read from the `file_`
   // directly.
   bool Read(uint8_t *data, size_t size);
@@ -138,6 +142,7 @@ class Decoder final : public BaseDecoder {
 
  private:
   utils::InputFile file_;
+  uint64_t base_offset_{0};
 };
 
 }  // namespace memgraph::storage::durability
@@ -127,7 +127,7 @@ struct BatchInfo {
 };
 
 // Function used to read information about the snapshot file.
-SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path) {
+SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path, const SnapshotStream *stream) {
   // Check magic and version.
   Decoder snapshot;
   auto version = snapshot.Initialize(path, kSnapshotMagic);
@@ -143,7 +143,7 @@ SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path) {
     if (!marker || *marker != Marker::SECTION_OFFSETS)
       throw RecoveryFailure("Couldn't read marker for section offsets!");
 
-    auto snapshot_size = snapshot.GetSize();
+    auto snapshot_size = stream ? std::optional{stream->size} : snapshot.GetSize();
     if (!snapshot_size) throw RecoveryFailure("Couldn't read snapshot size!");
 
     auto read_offset = [&snapshot, snapshot_size] {
@@ -182,6 +182,9 @@ SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path) {
 
   // Read metadata.
   {
+    if (stream && !snapshot.InitializePart(stream->tail_path, stream->tail_offset)) {
+      throw RecoveryFailure("Couldn't open the end of the snapshot!");
+    }
     if (!snapshot.SetPosition(info.offset_metadata)) throw RecoveryFailure("Couldn't read metadata offset!");
 
     auto marker = snapshot.ReadMarker();
@@ -235,6 +238,11 @@ std::vector<BatchInfo> ReadBatchInfos(Decoder &snapshot) {
   return infos;
 }
 
+// Batches are stored one after another, the last one ends where its section ends
+uint64_t BatchEnd(const std::vector<BatchInfo> &batches, size_t batch_index, uint64_t section_end) {
+  return batch_index + 1 < batches.size() ? batches[batch_index + 1].offset : section_end;
+}
+
 template <typename TFunc>
 void LoadPartialEdges(const std::filesystem::path &path, utils::SkipList<Edge> &edges, const uint64_t from_offset,
                       const uint64_t edges_count, const SalientConfig::Items items, TFunc get_property_from_id) {
@@ -2601,7 +2609,8 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
                                utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata,
                                std::deque<std::pair<std::string, uint64_t>> *epoch_history,
                                NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count, const Config &config,
-                               memgraph::storage::EnumStore *enum_store, SharedSchemaTracking *schema_info) {
+                               memgraph::storage::EnumStore *enum_store, SharedSchemaTracking *schema_info,
+                               const SnapshotStream *stream) {
   RecoveryInfo recovery_info;
   RecoveredIndicesAndConstraints indices_constraints;
 
@@ -2610,6 +2619,9 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
   if (!version) throw RecoveryFailure("Couldn't read snapshot magic and/or version!");
 
   if (!IsVersionSupported(*version)) throw RecoveryFailure(fmt::format("Invalid snapshot version {}", *version));
+  if (stream && *version != kVersion) {
+    throw RecoveryFailure(fmt::format("Snapshot version {} can't be loaded while it's being received", *version));
+  }
   if (*version == 14U) {
     return LoadSnapshotVersion14(path, vertices, edges, edges_metadata, epoch_history, name_id_mapper, edge_count,
                                  schema_info, config.salient.items);
@@ -2644,11 +2656,17 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
   });
 
   // Read snapshot info.
-  const auto info = ReadSnapshotInfo(path);
+  const auto info = ReadSnapshotInfo(path, stream);
   spdlog::info("Recovering {} vertices and {} edges.", info.vertices_count, info.edges_count);
   // Check for edges.
   bool snapshot_has_edges = info.offset_edges != 0;
 
+  // Every section read through `snapshot` from here on is in the end of the
+  // snapshot, which is received first when streaming
+  if (stream && !snapshot.InitializePart(stream->tail_path, stream->tail_offset)) {
+    throw RecoveryFailure("Couldn't open the end of the snapshot!");
+  }
+
   // Recover mapper.
   std::unordered_map<uint64_t, uint64_t> snapshot_id_map;
   {
@@ -2744,8 +2762,9 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
 
       RecoverOnMultipleThreads(
           config.durability.recovery_thread_count,
-          [path, edges, items = config.salient.items, &get_property_from_id](const size_t /*batch_index*/,
-                                                                             const BatchInfo &batch) {
+          [path, edges, items = config.salient.items, &get_property_from_id, stream, &edge_batches,
+           section_end = info.offset_vertices](const size_t batch_index, const BatchInfo &batch) {
+            if (stream) stream->wait_for(BatchEnd(edge_batches, batch_index, section_end));
             LoadPartialEdges(path, *edges, batch.offset, batch.count, items, get_property_from_id);
           },
           edge_batches);
@@ -2763,8 +2782,9 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
     const auto vertex_batches = ReadBatchInfos(snapshot);
     RecoverOnMultipleThreads(
         config.durability.recovery_thread_count,
-        [path, vertices, schema_info, &vertex_batches, &get_label_from_id, &get_property_from_id, &last_vertex_gid](
-            const size_t batch_index, const BatchInfo &batch) {
+        [path, vertices, schema_info, &vertex_batches, &get_label_from_id, &get_property_from_id, &last_vertex_gid,
+         stream, section_end = info.offset_indices](const size_t batch_index, const BatchInfo &batch) {
+          if (stream) stream->wait_for(BatchEnd(vertex_batches, batch_index, section_end));
           const auto last_vertex_gid_in_batch = LoadPartialVertices(
               path, *vertices, schema_info, batch.offset, batch.count, get_label_from_id, get_property_from_id);
           if (batch_index == vertex_batches.size() - 1) {
@@ -2966,6 +2986,26 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
       spdlog::info("Metadata of point indices are recovered.");
     }
 
+    // Recover label+property hash indices.
+    if (*version >= kLabelPropertyHashIndex) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Couldn't recover the number of label+property hash indices!");
+      spdlog::info("Recovering metadata of {} label+property hash indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Couldn't read label for label+property hash index!");
+        auto property = snapshot.ReadUint();
+        if (!property) throw RecoveryFailure("Couldn't read property for label+property hash index!");
+        AddRecoveredIndexConstraint(&indices_constraints.indices.label_property_hash,
+                                    {get_label_from_id(*label), get_property_from_id(*property)},
+                                    "The label+property hash index already exists!");
+        SPDLOG_TRACE("Recovered metadata of label+property hash index for :{}({})",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*label)),
+                     name_id_mapper->IdToName(snapshot_id_map.at(*property)));
+      }
+      spdlog::info("Metadata of label+property hash indices are recovered.");
+    }
+
     // Recover text indices.
     // NOTE: while this is experimental and hence optional
     //       it must be last in the SECTION_INDICES
@@ -3536,6 +3576,18 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
       }
     }
 
+    // Write label+property indices that keep a hash lookup.
+    {
+      // NOTE: On-disk does not support snapshots
+      auto *inmem_index = static_cast<InMemoryLabelPropertyIndex *>(storage->indices_.label_property_index_.get());
+      auto hash_lookups = inmem_index->ListHashLookups();
+      snapshot.WriteUint(hash_lookups.size());
+      for (const auto &[label, property] : hash_lookups) {
+        write_mapping(label);
+        write_mapping(property);
+      }
+    }
+
     // Write text indices.
     if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
       auto text_indices = storage->indices_.text_index_.ListIndices();
@@ -13,6 +13,7 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <string>
 
 #include "replication/epoch.hpp"
@@ -60,18 +61,34 @@ struct RecoveredSnapshot {
   RecoveredIndicesAndConstraints indices_constraints;
 };
 
+/// Snapshot that is loaded while it's still being received. Everything after
+/// the vertices (starting at `tail_offset`) is received first and kept in a
+/// separate file. The rest arrives in order and is loaded batch by batch as
+/// soon as it's available.
+struct SnapshotStream {
+  std::filesystem::path tail_path;
+  uint64_t tail_offset;
+  uint64_t size;
+  // Blocks until the snapshot is available up to the offset. Throws
+  // RecoveryFailure if the transfer was abandoned.
+  std::function<void(uint64_t)> wait_for;
+};
+
 /// Function used to read information about the snapshot file.
 /// @throw RecoveryFailure
-SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path);
+SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path, const SnapshotStream *stream = nullptr);
 
-/// Function used to load the snapshot data into the storage.
+/// Function used to load the snapshot data into the storage. With a `stream`
+/// only snapshots of the current version can be loaded, and the beginning of
+/// the snapshot with the section offsets has to be available already.
 /// @throw RecoveryFailure
 RecoveredSnapshot LoadSnapshot(std::filesystem::path const &path, utils::SkipList<Vertex> *vertices,
                                utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata,
                                std::deque<std::pair<std::string, uint64_t>> *epoch_history,
                                NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count, Config const &config,
                                memgraph::storage::EnumStore *enum_store,
-                               memgraph::storage::SharedSchemaTracking *schema_info);
+                               memgraph::storage::SharedSchemaTracking *schema_info,
+                               const SnapshotStream *stream = nullptr);
 
 void CreateSnapshot(Storage *storage, Transaction *transaction, const std::filesystem::path &snapshot_directory,
                     const std::filesystem::path &wal_directory, utils::SkipList<Vertex> *vertices,
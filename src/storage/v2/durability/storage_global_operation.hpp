@@ -21,6 +21,7 @@ enum class StorageMetadataOperation {
   LABEL_INDEX_STATS_CLEAR,
   LABEL_PROPERTY_INDEX_CREATE,
   LABEL_PROPERTY_INDEX_DROP,
+  LABEL_PROPERTY_HASH_INDEX_CREATE,
   LABEL_PROPERTY_INDEX_STATS_SET,
   LABEL_PROPERTY_INDEX_STATS_CLEAR,
   EDGE_INDEX_CREATE,
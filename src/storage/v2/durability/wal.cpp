@@ -24,9 +24,14 @@
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/schema_info.hpp"
 #include "storage/v2/vertex.hpp"
+#include "utils/event_counter.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
 
+namespace memgraph::metrics {
+extern const Event WalBytesWritten;
+}  // namespace memgraph::metrics
+
 namespace memgraph::storage::durability {
 
 // WAL format:
@@ -70,6 +75,7 @@ namespace memgraph::storage::durability {
 //         * label index create, label index drop
 //              * label name
 //         * label property index create, label property index drop,
+//           label property hash index create,
 //           existence constraint create, existence constraint drop
 //              * label name
 //              * property name
@@ -103,6 +109,7 @@ constexpr Marker OperationToMarker(StorageMetadataOperation operation) {
     add_case(LABEL_INDEX_STATS_SET);
     add_case(LABEL_PROPERTY_INDEX_CREATE);
     add_case(LABEL_PROPERTY_INDEX_DROP);
+    add_case(LABEL_PROPERTY_HASH_INDEX_CREATE);
     add_case(LABEL_PROPERTY_INDEX_STATS_CLEAR);
     add_case(LABEL_PROPERTY_INDEX_STATS_SET);
     add_case(TEXT_INDEX_CREATE);
@@ -169,6 +176,7 @@ constexpr WalDeltaData::Type MarkerToWalDeltaDataType(Marker marker) {
     add_case(LABEL_INDEX_STATS_SET);
     add_case(LABEL_PROPERTY_INDEX_CREATE);
     add_case(LABEL_PROPERTY_INDEX_DROP);
+    add_case(LABEL_PROPERTY_HASH_INDEX_CREATE);
     add_case(LABEL_PROPERTY_INDEX_STATS_CLEAR);
     add_case(LABEL_PROPERTY_INDEX_STATS_SET);
     add_case(TEXT_INDEX_CREATE);
@@ -339,6 +347,7 @@ WalDeltaData ReadSkipWalDeltaData(BaseDecoder *decoder, const uint64_t version)
     } break;
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE:
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP:
+    case WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_CREATE:
     case WalDeltaData::Type::POINT_INDEX_CREATE:
     case WalDeltaData::Type::POINT_INDEX_DROP:
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE:
@@ -657,6 +666,7 @@ bool operator==(const WalDeltaData &a, const WalDeltaData &b) {
 
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE:
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP:
+    case WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_CREATE:
     case WalDeltaData::Type::POINT_INDEX_CREATE:
     case WalDeltaData::Type::POINT_INDEX_DROP:
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE:
@@ -946,12 +956,14 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
             auto it = std::find(from_vertex->out_edges.begin(), from_vertex->out_edges.end(), link);
             if (it != from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex already has this edge!");
             from_vertex->out_edges.push_back(link);
+            from_vertex->out_edges_unsorted = kAdjacencyUnsorted;
           }
           {
             std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
             auto it = std::find(to_vertex->in_edges.begin(), to_vertex->in_edges.end(), link);
             if (it != to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex already has this edge!");
             to_vertex->in_edges.push_back(link);
+            to_vertex->in_edges_unsorted = kAdjacencyUnsorted;
           }
 
           ret.next_edge_id = std::max(ret.next_edge_id, edge_gid.AsUint() + 1);
@@ -982,6 +994,7 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
             if (it == from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex doesn't have this edge!");
             std::swap(*it, from_vertex->out_edges.back());
             from_vertex->out_edges.pop_back();
+            from_vertex->out_edges_unsorted = kAdjacencyUnsorted;
           }
           {
             std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
@@ -989,6 +1002,7 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
             if (it == to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex doesn't have this edge!");
             std::swap(*it, to_vertex->in_edges.back());
             to_vertex->in_edges.pop_back();
+            to_vertex->in_edges_unsorted = kAdjacencyUnsorted;
           }
           if (items.properties_on_edges) {
             if (!edge_acc.remove(edge_gid)) throw RecoveryFailure("The edge must be removed here!");
@@ -1111,6 +1125,17 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
           auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
           RemoveRecoveredIndexConstraint(&indices_constraints->indices.label_property, {label_id, property_id},
                                          "The label property index doesn't exist!");
+          // Dropping the index drops its hash lookup as well
+          std::erase(indices_constraints->indices.label_property_hash, std::make_pair(label_id, property_id));
+          break;
+        }
+        case WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_CREATE: {
+          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+          AddRecoveredIndexConstraint(&indices_constraints->indices.label_property, {label_id, property_id},
+                                      "The label property index already exists!");
+          AddRecoveredIndexConstraint(&indices_constraints->indices.label_property_hash, {label_id, property_id},
+                                      "The label property hash index already exists!");
           break;
         }
         case WalDeltaData::Type::POINT_INDEX_CREATE: {
@@ -1327,6 +1352,7 @@ WalFile::WalFile(std::filesystem::path current_wal_path, SalientConfig::Items it
       seq_num_(seq_num),
       file_retainer_(file_retainer) {
   wal_.OpenExisting(path_);
+  reported_size_ = wal_.GetSize();
 }
 
 void WalFile::FinalizeWal() {
@@ -1372,7 +1398,16 @@ void WalFile::AppendTransactionEnd(uint64_t timestamp) {
 
 void WalFile::Sync() { wal_.Sync(); }
 
-uint64_t WalFile::GetSize() { return wal_.GetSize(); }
+uint64_t WalFile::GetSize() {
+  // Storage checks the size after every committed transaction, which makes this a cheap place to track how much was
+  // written (GetSize already has to seek).
+  const auto size = wal_.GetSize();
+  if (size > reported_size_) {
+    memgraph::metrics::IncrementCounter(memgraph::metrics::WalBytesWritten, size - reported_size_);
+    reported_size_ = size;
+  }
+  return size;
+}
 
 uint64_t WalFile::SequenceNumber() const { return seq_num_; }
 
@@ -66,6 +66,7 @@ struct WalDeltaData {
     LABEL_INDEX_STATS_CLEAR,
     LABEL_PROPERTY_INDEX_CREATE,
     LABEL_PROPERTY_INDEX_DROP,
+    LABEL_PROPERTY_HASH_INDEX_CREATE,
     LABEL_PROPERTY_INDEX_STATS_SET,
     LABEL_PROPERTY_INDEX_STATS_CLEAR,
     EDGE_INDEX_CREATE,
@@ -204,6 +205,7 @@ constexpr bool IsWalDeltaDataTypeTransactionEndVersion15(const WalDeltaData::Typ
     case WalDeltaData::Type::LABEL_INDEX_STATS_CLEAR:
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE:
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP:
+    case WalDeltaData::Type::LABEL_PROPERTY_HASH_INDEX_CREATE:
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_STATS_SET:
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_STATS_CLEAR:
     case WalDeltaData::Type::EDGE_INDEX_CREATE:
@@ -367,6 +369,8 @@ class WalFile {
   uint64_t to_timestamp_;
   uint64_t count_;
   uint64_t seq_num_;
+  // WAL bytes already reported to the WalBytesWritten metric.
+  uint64_t reported_size_{0};
 
   utils::FileRetainer *file_retainer_;
 };
@@ -0,0 +1,67 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/graph_projection.hpp"
+
+#include <algorithm>
+
+namespace memgraph::storage {
+
+std::shared_ptr<const GraphProjection> GraphProjectionCache::GetOrBuild(
+    const GraphProjectionSpec &spec, uint64_t commit_timestamp, const std::function<GraphProjection()> &build) {
+  {
+    auto guard = std::lock_guard{lock_};
+    auto it = std::ranges::find_if(
+        entries_, [&](const Entry &entry) { return entry.commit_timestamp == commit_timestamp && entry.spec == spec; });
+    if (it != entries_.end()) {
+      entries_.splice(entries_.begin(), entries_, it);
+      return it->projection;
+    }
+  }
+
+  auto projection = std::make_shared<const GraphProjection>(build());
+  const auto bytes = projection->MemoryUsage();
+  if (bytes > max_bytes_) return projection;
+
+  auto guard = std::lock_guard{lock_};
+  // Projections of the same spec at older timestamps are only useful to
+  // transactions which started before the newest commit, so they are dropped.
+  std::erase_if(entries_, [&](const Entry &entry) {
+    if (entry.spec != spec || entry.commit_timestamp > commit_timestamp) return false;
+    bytes_ -= entry.bytes;
+    return true;
+  });
+  entries_.push_front(Entry{spec, commit_timestamp, projection, bytes});
+  bytes_ += bytes;
+  while (entries_.size() > capacity_ || bytes_ > max_bytes_) {
+    bytes_ -= entries_.back().bytes;
+    entries_.pop_back();
+  }
+  return projection;
+}
+
+void GraphProjectionCache::Clear() {
+  auto guard = std::lock_guard{lock_};
+  entries_.clear();
+  bytes_ = 0;
+}
+
+size_t GraphProjectionCache::Size() const {
+  auto guard = std::lock_guard{lock_};
+  return entries_.size();
+}
+
+size_t GraphProjectionCache::MemoryUsage() const {
+  auto guard = std::lock_guard{lock_};
+  return bytes_;
+}
+
+}  // namespace memgraph::storage
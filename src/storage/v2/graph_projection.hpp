@@ -0,0 +1,111 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+
+namespace memgraph::storage {
+
+/// Describes which part of the graph is projected.
+struct GraphProjectionSpec {
+  /// Only vertices with at least one of the labels are projected. All vertices are projected if empty.
+  std::vector<LabelId> labels;
+  /// Only edges of one of the types are projected. All edges are projected if empty.
+  std::vector<EdgeTypeId> edge_types;
+  /// Numeric edge property exported as the weight column.
+  std::optional<PropertyId> weight_property;
+
+  friend bool operator==(const GraphProjectionSpec &, const GraphProjectionSpec &) = default;
+};
+
+/// Compressed sparse row snapshot of the outgoing adjacency of a graph.
+/// Projected vertices are numbered densely from 0. Edges of the i-th vertex
+/// are stored in the range [offsets[i], offsets[i + 1]) of the edge arrays.
+/// Edges whose destination isn't projected are not part of the projection.
+struct GraphProjection {
+  /// Gid of every projected vertex, indexed by the dense vertex index.
+  std::vector<int64_t> vertex_ids;
+  /// `vertex_ids.size() + 1` offsets into the edge arrays.
+  std::vector<size_t> offsets;
+  /// Dense index of the destination of every edge.
+  std::vector<size_t> targets;
+  std::vector<int64_t> edge_ids;
+  std::vector<EdgeTypeId> edge_types;
+  /// Empty if the projection has no weight property. Edges without a numeric
+  /// weight get the weight 1.0.
+  std::vector<double> weights;
+
+  size_t VertexCount() const { return vertex_ids.size(); }
+  size_t EdgeCount() const { return targets.size(); }
+
+  /// Bytes held by the arrays.
+  size_t MemoryUsage() const {
+    return vertex_ids.capacity() * sizeof(int64_t) + offsets.capacity() * sizeof(size_t) +
+           targets.capacity() * sizeof(size_t) + edge_ids.capacity() * sizeof(int64_t) +
+           edge_types.capacity() * sizeof(EdgeTypeId) + weights.capacity() * sizeof(double);
+  }
+};
+
+/// Keeps the most recently used projections, keyed by their spec and the
+/// last commit timestamp which was visible when they were built. A
+/// projection is only valid for transactions which see exactly that state of
+/// the graph, so it's up to the caller to decide whether a transaction may
+/// use the cache. The cache holds at most `capacity` projections of at most
+/// `max_bytes` in total, larger projections aren't cached at all.
+class GraphProjectionCache {
+ public:
+  static constexpr size_t kDefaultCapacity = 4;
+  static constexpr size_t kDefaultMaxBytes = 1ULL << 30U;
+
+  explicit GraphProjectionCache(size_t capacity = kDefaultCapacity, size_t max_bytes = kDefaultMaxBytes)
+      : capacity_(capacity), max_bytes_(max_bytes) {}
+
+  /// Returns the projection for `spec` at `commit_timestamp`. On a cache miss
+  /// the projection is built with `build` outside of the cache lock, so
+  /// concurrent misses for the same key may build it more than once.
+  std::shared_ptr<const GraphProjection> GetOrBuild(const GraphProjectionSpec &spec, uint64_t commit_timestamp,
+                                                    const std::function<GraphProjection()> &build);
+
+  /// Drops all cached projections. Must be called whenever commit timestamps
+  /// stop identifying the state of the graph, e.g. when the storage is cleared.
+  void Clear();
+
+  size_t Size() const;
+
+  /// Bytes held by the cached projections.
+  size_t MemoryUsage() const;
+
+ private:
+  struct Entry {
+    GraphProjectionSpec spec;
+    uint64_t commit_timestamp;
+    std::shared_ptr<const GraphProjection> projection;
+    size_t bytes;
+  };
+
+  size_t capacity_;
+  size_t max_bytes_;
+  size_t bytes_{0};
+  mutable std::mutex lock_;
+  // Most recently used entries are at the front.
+  std::list<Entry> entries_;
+};
+
+}  // namespace memgraph::storage
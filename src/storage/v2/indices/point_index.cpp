@@ -14,8 +14,11 @@
 #include <boost/geometry.hpp>
 #include <boost/geometry/index/predicates.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <utility>
+#include <vector>
 #include "storage/v2/indices/point_index_change_collector.hpp"
 #include "storage/v2/indices/point_index_expensive_header.hpp"
 #include "storage/v2/indices/point_iterator.hpp"
@@ -36,27 +39,36 @@ struct PointIndex {
   auto CreateNewPointIndex(LabelPropKey labelPropKey, absl::flat_hash_set<Vertex const *> const &changed_vertices) const
       -> PointIndex;
 
+  auto NeedsMerge() const -> bool {
+    return wgs_2d_index_.NeedsMerge() || wgs_3d_index_.NeedsMerge() || cartesian_2d_index_.NeedsMerge() ||
+           cartesian_3d_index_.NeedsMerge();
+  }
+
+  /// Merges the layers of the coordinate reference systems which need it.
+  auto Merge() const -> PointIndex;
+
+  /// See `LayeredIndex::Rebase`.
+  auto Rebase(PointIndex const &merged_from, PointIndex const &merged) const -> PointIndex;
+
   auto EntryCount() const -> std::size_t {
-    return wgs_2d_index_->size() + wgs_3d_index_->size() + cartesian_2d_index_->size() + cartesian_3d_index_->size();
+    return wgs_2d_index_.EntryCount() + wgs_3d_index_.EntryCount() + cartesian_2d_index_.EntryCount() +
+           cartesian_3d_index_.EntryCount();
   }
 
-  auto GetWgs2dIndex() const -> std::shared_ptr<index_t<IndexPointWGS2d>> { return wgs_2d_index_; }
-  auto GetWgs3dIndex() const -> std::shared_ptr<index_t<IndexPointWGS3d>> { return wgs_3d_index_; }
-  auto GetCartesian2dIndex() const -> std::shared_ptr<index_t<IndexPointCartesian2d>> { return cartesian_2d_index_; }
-  auto GetCartesian3dIndex() const -> std::shared_ptr<index_t<IndexPointCartesian3d>> { return cartesian_3d_index_; }
+  auto GetWgs2dIndex() const -> LayeredIndex<IndexPointWGS2d> const & { return wgs_2d_index_; }
+  auto GetWgs3dIndex() const -> LayeredIndex<IndexPointWGS3d> const & { return wgs_3d_index_; }
+  auto GetCartesian2dIndex() const -> LayeredIndex<IndexPointCartesian2d> const & { return cartesian_2d_index_; }
+  auto GetCartesian3dIndex() const -> LayeredIndex<IndexPointCartesian3d> const & { return cartesian_3d_index_; }
 
  private:
-  PointIndex(std::shared_ptr<index_t<IndexPointWGS2d>> points2dWGS,
-             std::shared_ptr<index_t<IndexPointWGS3d>> points3dWGS,
-             std::shared_ptr<index_t<IndexPointCartesian2d>> points2dCartesian,
-             std::shared_ptr<index_t<IndexPointCartesian3d>> points3dCartesian);
-
-  std::shared_ptr<index_t<IndexPointWGS2d>> wgs_2d_index_ = std::make_shared<index_t<IndexPointWGS2d>>();
-  std::shared_ptr<index_t<IndexPointWGS3d>> wgs_3d_index_ = std::make_shared<index_t<IndexPointWGS3d>>();
-  std::shared_ptr<index_t<IndexPointCartesian2d>> cartesian_2d_index_ =
-      std::make_shared<index_t<IndexPointCartesian2d>>();
-  std::shared_ptr<index_t<IndexPointCartesian3d>> cartesian_3d_index_ =
-      std::make_shared<index_t<IndexPointCartesian3d>>();
+  PointIndex(LayeredIndex<IndexPointWGS2d> points2dWGS, LayeredIndex<IndexPointWGS3d> points3dWGS,
+             LayeredIndex<IndexPointCartesian2d> points2dCartesian,
+             LayeredIndex<IndexPointCartesian3d> points3dCartesian);
+
+  LayeredIndex<IndexPointWGS2d> wgs_2d_index_;
+  LayeredIndex<IndexPointWGS3d> wgs_3d_index_;
+  LayeredIndex<IndexPointCartesian2d> cartesian_2d_index_;
+  LayeredIndex<IndexPointCartesian3d> cartesian_3d_index_;
 };
 
 namespace {
@@ -177,6 +189,31 @@ void PointIndexStorage::InstallNewPointIndex(PointIndexChangeCollector &collecto
     indexes_ = context.current_indexes_;
   };
 }
+void PointIndexStorage::MergeLayers(utils::SpinLock &lock) {
+  auto indexes = std::invoke([&] {
+    auto guard = std::lock_guard{lock};
+    return indexes_;
+  });
+
+  // Merging the layers is expensive, it's done without the lock
+  auto merged = std::map<LabelPropKey, std::pair<std::shared_ptr<PointIndex const>, PointIndex>>{};
+  for (auto const &[key, index] : *indexes) {
+    if (index->NeedsMerge()) merged.try_emplace(key, index, index->Merge());
+  }
+  if (merged.empty()) return;
+
+  auto guard = std::lock_guard{lock};
+  auto new_indexes = std::make_shared<index_container_t>(*indexes_);
+  for (auto const &[key, merged_index] : merged) {
+    auto it = new_indexes->find(key);
+    if (it == new_indexes->end()) continue;
+    auto const &[merged_from, index] = merged_index;
+    it->second = std::make_shared<PointIndex const>(it->second->Rebase(*merged_from, index));
+  }
+  // Transactions which started with the old indexes rebuild theirs on commit
+  indexes_ = std::move(new_indexes);
+}
+
 void PointIndexStorage::Clear() { indexes_->clear(); }
 
 std::vector<std::pair<LabelId, PropertyId>> PointIndexStorage::ListIndices() {
@@ -240,28 +277,23 @@ auto PointIndex::CreateNewPointIndex(LabelPropKey labelPropKey,
     }
   }
 
-  auto helper = [&]<typename PointType>(std::shared_ptr<index_t<PointType>> const &index,
-                                        std::unordered_map<Vertex const *, PointType> const &changed_values
-
-                                        ) -> std::shared_ptr<index_t<PointType>> {
-    auto modified = [&](Entry<PointType> const &entry) { return changed_vertices.contains(entry.vertex()); };
-    if (changed_values.empty() && !std::ranges::any_of(*index, modified)) {
-      // was unmodified, no need to rebuild
-      return index;
-    }
-
-    auto copy_old = *index | std::views::filter(std::not_fn(modified));
-    auto as_entry = [](std::pair<Vertex const *, PointType> const &p) { return Entry<PointType>{p.second, p.first}; };
-    auto insert_modified = changed_values | std::views::transform(as_entry);
+  return PointIndex{wgs_2d_index_.Update(changed_vertices, changed_wgs_2d),
+                    wgs_3d_index_.Update(changed_vertices, changed_wgs_3d),
+                    cartesian_2d_index_.Update(changed_vertices, changed_cartesian_2d),
+                    cartesian_3d_index_.Update(changed_vertices, changed_cartesian_3d)};
+}
 
-    auto new_index = std::make_shared<index_t<PointType>>(copy_old.begin(), copy_old.end());
-    new_index->insert(insert_modified.begin(), insert_modified.end());
-    return new_index;
-  };
+auto PointIndex::Merge() const -> PointIndex {
+  auto merge = [](auto const &index) { return index.NeedsMerge() ? index.Merge() : index; };
+  return PointIndex{merge(wgs_2d_index_), merge(wgs_3d_index_), merge(cartesian_2d_index_),
+                    merge(cartesian_3d_index_)};
+}
 
-  return PointIndex{helper(wgs_2d_index_, changed_wgs_2d), helper(wgs_3d_index_, changed_wgs_3d),
-                    helper(cartesian_2d_index_, changed_cartesian_2d),
-                    helper(cartesian_3d_index_, changed_cartesian_3d)};
+auto PointIndex::Rebase(PointIndex const &merged_from, PointIndex const &merged) const -> PointIndex {
+  return PointIndex{wgs_2d_index_.Rebase(merged_from.wgs_2d_index_, merged.wgs_2d_index_),
+                    wgs_3d_index_.Rebase(merged_from.wgs_3d_index_, merged.wgs_3d_index_),
+                    cartesian_2d_index_.Rebase(merged_from.cartesian_2d_index_, merged.cartesian_2d_index_),
+                    cartesian_3d_index_.Rebase(merged_from.cartesian_3d_index_, merged.cartesian_3d_index_)};
 }
 
 void PointIndexContext::rebuild_current(std::shared_ptr<index_container_t> latest_index,
@@ -300,24 +332,21 @@ PointIndex::PointIndex(std::span<Entry<IndexPointWGS2d>> points2dWGS,
                        std::span<Entry<IndexPointCartesian2d>> points2dCartesian,
                        std::span<Entry<IndexPointWGS3d>> points3dWGS,
                        std::span<Entry<IndexPointCartesian3d>> points3dCartesian)
-    : wgs_2d_index_{std::make_shared<index_t<IndexPointWGS2d>>(points2dWGS.begin(), points2dWGS.end())},
-      wgs_3d_index_{std::make_shared<index_t<IndexPointWGS3d>>(points3dWGS.begin(), points3dWGS.end())},
-      cartesian_2d_index_{
-          std::make_shared<index_t<IndexPointCartesian2d>>(points2dCartesian.begin(), points2dCartesian.end())},
-      cartesian_3d_index_{
-          std::make_shared<index_t<IndexPointCartesian3d>>(points3dCartesian.begin(), points3dCartesian.end())} {}
-
-PointIndex::PointIndex(std::shared_ptr<index_t<IndexPointWGS2d>> points2dWGS,
-                       std::shared_ptr<index_t<IndexPointWGS3d>> points3dWGS,
-                       std::shared_ptr<index_t<IndexPointCartesian2d>> points2dCartesian,
-                       std::shared_ptr<index_t<IndexPointCartesian3d>> points3dCartesian)
+    : wgs_2d_index_{LayeredIndex<IndexPointWGS2d>::BulkLoad(points2dWGS)},
+      wgs_3d_index_{LayeredIndex<IndexPointWGS3d>::BulkLoad(points3dWGS)},
+      cartesian_2d_index_{LayeredIndex<IndexPointCartesian2d>::BulkLoad(points2dCartesian)},
+      cartesian_3d_index_{LayeredIndex<IndexPointCartesian3d>::BulkLoad(points3dCartesian)} {}
+
+PointIndex::PointIndex(LayeredIndex<IndexPointWGS2d> points2dWGS, LayeredIndex<IndexPointWGS3d> points3dWGS,
+                       LayeredIndex<IndexPointCartesian2d> points2dCartesian,
+                       LayeredIndex<IndexPointCartesian3d> points3dCartesian)
     : wgs_2d_index_{std::move(points2dWGS)},
       wgs_3d_index_{std::move(points3dWGS)},
       cartesian_2d_index_{std::move(points2dCartesian)},
       cartesian_3d_index_{std::move(points3dCartesian)} {}
 
 struct PointIterable::impl {
-  explicit impl(Storage *storage, Transaction *transaction, std::shared_ptr<index_t<IndexPointWGS2d>> index,
+  explicit impl(Storage *storage, Transaction *transaction, LayeredIndex<IndexPointWGS2d> index,
                 PropertyValue point_value, PropertyValue boundary_value, PointDistanceCondition condition)
       : storage_{storage},
         transaction_{transaction},
@@ -328,7 +357,7 @@ struct PointIterable::impl {
         wgs84_2d_{std::move(index)},
         distance_condition_{condition} {}
 
-  explicit impl(Storage *storage, Transaction *transaction, std::shared_ptr<index_t<IndexPointWGS3d>> index,
+  explicit impl(Storage *storage, Transaction *transaction, LayeredIndex<IndexPointWGS3d> index,
                 PropertyValue point_value, PropertyValue boundary_value, PointDistanceCondition condition)
       : storage_{storage},
         transaction_{transaction},
@@ -339,7 +368,7 @@ struct PointIterable::impl {
         wgs84_3d_{std::move(index)},
         distance_condition_{condition} {}
 
-  explicit impl(Storage *storage, Transaction *transaction, std::shared_ptr<index_t<IndexPointCartesian2d>> index,
+  explicit impl(Storage *storage, Transaction *transaction, LayeredIndex<IndexPointCartesian2d> index,
                 PropertyValue point_value, PropertyValue boundary_value, PointDistanceCondition condition)
       : storage_{storage},
         transaction_{transaction},
@@ -350,7 +379,7 @@ struct PointIterable::impl {
         cartesian_2d_{std::move(index)},
         distance_condition_{condition} {}
 
-  explicit impl(Storage *storage, Transaction *transaction, std::shared_ptr<index_t<IndexPointCartesian3d>> index,
+  explicit impl(Storage *storage, Transaction *transaction, LayeredIndex<IndexPointCartesian3d> index,
                 PropertyValue point_value, PropertyValue boundary_value, PointDistanceCondition condition)
       : storage_{storage},
         transaction_{transaction},
@@ -368,7 +397,6 @@ struct PointIterable::impl {
   impl &operator=(impl const &) = delete;
   impl &operator=(impl &&) = delete;
 
-  // don't need destroy_at for shared ptrs
   ~impl() {
     switch (crs_) {
       case CoordinateReferenceSystem::WGS84_2d:
@@ -394,10 +422,10 @@ struct PointIterable::impl {
   PropertyValue boundary_value_;
   bool using_distance_;
   union {
-    std::shared_ptr<index_t<IndexPointWGS2d>> wgs84_2d_;
-    std::shared_ptr<index_t<IndexPointWGS3d>> wgs84_3d_;
-    std::shared_ptr<index_t<IndexPointCartesian2d>> cartesian_2d_;
-    std::shared_ptr<index_t<IndexPointCartesian3d>> cartesian_3d_;
+    LayeredIndex<IndexPointWGS2d> wgs84_2d_;
+    LayeredIndex<IndexPointWGS3d> wgs84_3d_;
+    LayeredIndex<IndexPointCartesian2d> cartesian_2d_;
+    LayeredIndex<IndexPointCartesian3d> cartesian_3d_;
   };
 
   union {
@@ -605,6 +633,19 @@ auto get_index_iterator_distance(Index &index, PropertyValue const &point_value,
   }
 }
 
+template <typename IndexPoint>
+auto get_layered_iterator_distance(LayeredIndex<IndexPoint> const &index, PropertyValue const &point_value,
+                                   PropertyValue const &boundary_value, PointDistanceCondition condition)
+    -> LayeredQueryIterator<IndexPoint> {
+  return {get_index_iterator_distance(*index.base, point_value, boundary_value, condition), index.base->qend(),
+          get_index_iterator_distance(*index.delta, point_value, boundary_value, condition), index.masked.get()};
+}
+
+template <typename IndexPoint>
+auto get_layered_iterator_end(LayeredIndex<IndexPoint> const &index) -> LayeredQueryIterator<IndexPoint> {
+  return {index.base->qend(), index.base->qend(), index.delta->qend(), index.masked.get()};
+}
+
 }  // namespace
 
 auto PointIterable::begin() const -> PointIterator {
@@ -612,20 +653,20 @@ auto PointIterable::begin() const -> PointIterator {
     switch (pimpl->crs_) {
       case CoordinateReferenceSystem::WGS84_2d:
         return PointIterator{pimpl->storage_, pimpl->transaction_, pimpl->crs_,
-                             get_index_iterator_distance(*pimpl->wgs84_2d_, pimpl->point_value_, pimpl->boundary_value_,
-                                                         pimpl->distance_condition_)};
+                             get_layered_iterator_distance(pimpl->wgs84_2d_, pimpl->point_value_,
+                                                           pimpl->boundary_value_, pimpl->distance_condition_)};
       case CoordinateReferenceSystem::WGS84_3d:
         return PointIterator{pimpl->storage_, pimpl->transaction_, pimpl->crs_,
-                             get_index_iterator_distance(*pimpl->wgs84_3d_, pimpl->point_value_, pimpl->boundary_value_,
-                                                         pimpl->distance_condition_)};
+                             get_layered_iterator_distance(pimpl->wgs84_3d_, pimpl->point_value_,
+                                                           pimpl->boundary_value_, pimpl->distance_condition_)};
       case CoordinateReferenceSystem::Cartesian_2d:
         return PointIterator{pimpl->storage_, pimpl->transaction_, pimpl->crs_,
-                             get_index_iterator_distance(*pimpl->cartesian_2d_, pimpl->point_value_,
-                                                         pimpl->boundary_value_, pimpl->distance_condition_)};
+                             get_layered_iterator_distance(pimpl->cartesian_2d_, pimpl->point_value_,
+                                                           pimpl->boundary_value_, pimpl->distance_condition_)};
       case CoordinateReferenceSystem::Cartesian_3d:
         return PointIterator{pimpl->storage_, pimpl->transaction_, pimpl->crs_,
-                             get_index_iterator_distance(*pimpl->cartesian_3d_, pimpl->point_value_,
-                                                         pimpl->boundary_value_, pimpl->distance_condition_)};
+                             get_layered_iterator_distance(pimpl->cartesian_3d_, pimpl->point_value_,
+                                                           pimpl->boundary_value_, pimpl->distance_condition_)};
     }
   } else {
     throw utils::NotYetImplemented("Crash");
@@ -635,13 +676,17 @@ auto PointIterable::end() const -> PointIterator {
   if (pimpl->using_distance_) {
     switch (pimpl->crs_) {
       case CoordinateReferenceSystem::WGS84_2d:
-        return PointIterator{pimpl->storage_, pimpl->transaction_, pimpl->crs_, pimpl->wgs84_2d_->qend()};
+        return PointIterator{pimpl->storage_, pimpl->transaction_, pimpl->crs_,
+                             get_layered_iterator_end(pimpl->wgs84_2d_)};
       case CoordinateReferenceSystem::WGS84_3d:
-        return PointIterator{pimpl->storage_, pimpl->transaction_, pimpl->crs_, pimpl->wgs84_3d_->qend()};
+        return PointIterator{pimpl->storage_, pimpl->transaction_, pimpl->crs_,
+                             get_layered_iterator_end(pimpl->wgs84_3d_)};
       case CoordinateReferenceSystem::Cartesian_2d:
-        return PointIterator{pimpl->storage_, pimpl->transaction_, pimpl->crs_, pimpl->cartesian_2d_->qend()};
+        return PointIterator{pimpl->storage_, pimpl->transaction_, pimpl->crs_,
+                             get_layered_iterator_end(pimpl->cartesian_2d_)};
       case CoordinateReferenceSystem::Cartesian_3d:
-        return PointIterator{pimpl->storage_, pimpl->transaction_, pimpl->crs_, pimpl->cartesian_3d_->qend()};
+        return PointIterator{pimpl->storage_, pimpl->transaction_, pimpl->crs_,
+                             get_layered_iterator_end(pimpl->cartesian_3d_)};
     }
   } else {
     throw utils::NotYetImplemented("Crash");
@@ -16,6 +16,7 @@
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/vertex_accessor.hpp"
 #include "utils/skip_list.hpp"
+#include "utils/spin_lock.hpp"
 
 namespace memgraph::storage {
 
@@ -89,6 +90,9 @@ struct PointIndexStorage {
   // Commit
   void InstallNewPointIndex(PointIndexChangeCollector &collector, PointIndexContext &context);
 
+  // GC (merge the layers commits added to, `lock` is the one commits install new indexes under)
+  void MergeLayers(utils::SpinLock &lock);
+
   void Clear();
 
   std::vector<std::pair<LabelId, PropertyId>> ListIndices();
@@ -13,6 +13,17 @@
 
 #include "storage/v2/point.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <absl/container/flat_hash_set.h>
 #include <boost/geometry.hpp>
 #include <boost/geometry/geometries/point.hpp>
 #include <boost/geometry/index/rtree.hpp>
@@ -54,7 +65,7 @@ struct Entry {
 
   friend bool operator==(Entry const &lhs, Entry const &rhs) {
     if (lhs.vertex_ != rhs.vertex_) return false;
-    if (!boost::geometry::equals(lhs.p_, rhs.p_)) return false;
+    if (!boost::geometry::equals(lhs.point(), rhs.point())) return false;
     return true;
   };
 
@@ -77,4 +88,185 @@ namespace memgraph::storage {
 template <typename IndexPoint>
 using index_t = bgi::rtree<Entry<IndexPoint>, bgi::quadratic<64>>;  // TODO: tune this
 
+/// Point index of a single coordinate reference system, split into layers so
+/// that a commit doesn't need to rebuild the whole R-tree.
+///
+/// `base` is bulk loaded and holds most of the entries. `delta` holds the
+/// entries of vertices changed since `base` was built, and `masked` holds those
+/// of the changed vertices which have an entry in `base`, so that their stale
+/// entries are skipped. Layers are never modified once published, a commit
+/// builds a new `delta` and `masked`. Once they grow too big compared to
+/// `base`, a background task merges all layers into a new `base` and rebases
+/// the commits made in the meantime onto it.
+template <typename IndexPoint>
+struct LayeredIndex {
+  using entry_t = Entry<IndexPoint>;
+  using tree_t = index_t<IndexPoint>;
+  using masked_t = absl::flat_hash_set<Vertex const *>;
+  using changed_values_t = std::unordered_map<Vertex const *, IndexPoint>;
+
+  /// Index with all of `entries` in `base`. Expects at most one entry per vertex.
+  static auto BulkLoad(std::span<entry_t const> entries) -> LayeredIndex {
+    auto base_vertices = std::vector<Vertex const *>{};
+    base_vertices.reserve(entries.size());
+    std::ranges::transform(entries, std::back_inserter(base_vertices), &entry_t::vertex);
+    std::ranges::sort(base_vertices);
+    return LayeredIndex{.base = std::make_shared<tree_t>(entries.begin(), entries.end()),
+                        .base_vertices = std::make_shared<std::vector<Vertex const *> const>(std::move(base_vertices))};
+  }
+
+  // Layers are merged once the changes since the last merge outgrow this.
+  // Keeping it proportional to the square root of the index size balances the
+  // cost of copying the small layers on every commit against the cost of the
+  // merges.
+  static auto MaxDeltaSize(std::size_t base_size) -> std::size_t {
+    constexpr std::size_t kMinDeltaSize = 1024;
+    constexpr double kDeltaSizeFactor = 16.0;
+    return std::max(kMinDeltaSize, static_cast<std::size_t>(kDeltaSizeFactor * std::sqrt(base_size)));
+  }
+
+  /// Every vertex has at most one entry in `delta` and masked vertices have
+  /// exactly one in `base`, so this is exact.
+  auto EntryCount() const -> std::size_t { return base->size() - masked->size() + delta->size(); }
+
+  auto InBase(Vertex const *vertex) const -> bool { return std::ranges::binary_search(*base_vertices, vertex); }
+
+  auto NeedsMerge() const -> bool { return delta->size() + masked->size() > MaxDeltaSize(base->size()); }
+
+  /// Index after `changed_vertices` changed; `changed_values` holds the new
+  /// entries of those which still belong to this index. Only `delta` and
+  /// `masked` are rebuilt, and only if one of the changes concerns this index.
+  auto Update(masked_t const &changed_vertices, changed_values_t const &changed_values) const -> LayeredIndex {
+    auto concerned = [&](Vertex const *vertex) { return InBase(vertex) || delta_vertices->contains(vertex); };
+    if (changed_values.empty() && std::ranges::none_of(changed_vertices, concerned)) {
+      // e.g. points of another coordinate reference system changed
+      return *this;
+    }
+
+    auto modified = [&](entry_t const &entry) { return changed_vertices.contains(entry.vertex()); };
+    auto as_entry = [](std::pair<Vertex const *, IndexPoint> const &p) { return entry_t{p.second, p.first}; };
+
+    // Only the small layers are copied; entries of the changed vertices are
+    // replaced in `delta` and hidden in `base`.
+    auto delta_entries = std::vector<entry_t>{};
+    delta_entries.reserve(delta->size() + changed_values.size());
+    std::ranges::copy(*delta | std::views::filter(std::not_fn(modified)), std::back_inserter(delta_entries));
+    std::ranges::copy(changed_values | std::views::transform(as_entry), std::back_inserter(delta_entries));
+
+    auto new_masked = *masked;
+    for (auto const *vertex : changed_vertices) {
+      if (InBase(vertex)) new_masked.insert(vertex);
+    }
+
+    return WithDelta(base, base_vertices, std::move(delta_entries), std::move(new_masked));
+  }
+
+  /// All layers bulk loaded into a new `base`.
+  auto Merge() const -> LayeredIndex {
+    auto merged = std::vector<entry_t>{};
+    merged.reserve(EntryCount());
+    auto not_masked = [&](entry_t const &entry) { return !masked->contains(entry.vertex()); };
+    std::ranges::copy(*base | std::views::filter(not_masked), std::back_inserter(merged));
+    std::ranges::copy(*delta, std::back_inserter(merged));
+    return BulkLoad(merged);
+  }
+
+  /// `merged` is `merged_from.Merge()`, where `merged_from` is an older
+  /// version of this index. Returns the merged index with the changes made
+  /// since `merged_from` applied on top of it, or this index if it has been
+  /// merged in the meantime. Costs about as much as an `Update`.
+  auto Rebase(LayeredIndex const &merged_from, LayeredIndex const &merged) const -> LayeredIndex {
+    if (base != merged_from.base || merged.base == merged_from.base) return *this;
+    if (delta == merged_from.delta && masked == merged_from.masked) return merged;
+
+    // Vertices are in `delta` and `masked` since their last change, unchanged
+    // ones have the same entry in both versions
+    auto merged_from_entries = std::unordered_map<Vertex const *, entry_t const *>{};
+    for (auto const &entry : *merged_from.delta) merged_from_entries.emplace(entry.vertex(), &entry);
+    auto changed_since = masked_t{};
+    for (auto const *vertex : *masked) {
+      if (!merged_from.masked->contains(vertex)) changed_since.insert(vertex);
+    }
+    for (auto const &entry : *delta) {
+      auto it = merged_from_entries.find(entry.vertex());
+      if (it == merged_from_entries.end() || !(*it->second == entry)) changed_since.insert(entry.vertex());
+    }
+    for (auto const *vertex : merged_from_entries | std::views::keys) {
+      if (!delta_vertices->contains(vertex)) changed_since.insert(vertex);
+    }
+
+    auto delta_entries = std::vector<entry_t>{};
+    auto changed = [&](entry_t const &entry) { return changed_since.contains(entry.vertex()); };
+    std::ranges::copy(*delta | std::views::filter(changed), std::back_inserter(delta_entries));
+    auto new_masked = masked_t{};
+    for (auto const *vertex : changed_since) {
+      if (merged.InBase(vertex)) new_masked.insert(vertex);
+    }
+    return WithDelta(merged.base, merged.base_vertices, std::move(delta_entries), std::move(new_masked));
+  }
+
+  std::shared_ptr<tree_t> base = std::make_shared<tree_t>();
+  // Sorted vertices of the entries in `base`
+  std::shared_ptr<std::vector<Vertex const *> const> base_vertices =
+      std::make_shared<std::vector<Vertex const *> const>();
+  std::shared_ptr<tree_t> delta = std::make_shared<tree_t>();
+  // Vertices of the entries in `delta`
+  std::shared_ptr<masked_t const> delta_vertices = std::make_shared<masked_t const>();
+  std::shared_ptr<masked_t const> masked = std::make_shared<masked_t const>();
+
+ private:
+  static auto WithDelta(std::shared_ptr<tree_t> base, std::shared_ptr<std::vector<Vertex const *> const> base_vertices,
+                        std::vector<entry_t> delta_entries, masked_t masked) -> LayeredIndex {
+    auto delta_vertices = masked_t{};
+    delta_vertices.reserve(delta_entries.size());
+    std::ranges::transform(delta_entries, std::inserter(delta_vertices, delta_vertices.end()), &entry_t::vertex);
+    return LayeredIndex{.base = std::move(base),
+                        .base_vertices = std::move(base_vertices),
+                        .delta = std::make_shared<tree_t>(delta_entries.begin(), delta_entries.end()),
+                        .delta_vertices = std::make_shared<masked_t const>(std::move(delta_vertices)),
+                        .masked = std::make_shared<masked_t const>(std::move(masked))};
+  }
+};
+
+/// Query iterator over all layers of a `LayeredIndex`, yields the entries of
+/// `base` which aren't masked followed by the entries of `delta`.
+template <typename IndexPoint>
+struct LayeredQueryIterator {
+  using query_iterator = typename index_t<IndexPoint>::const_query_iterator;
+  using masked_t = typename LayeredIndex<IndexPoint>::masked_t;
+
+  LayeredQueryIterator(query_iterator base, query_iterator base_end, query_iterator delta, masked_t const *masked)
+      : base_{std::move(base)}, base_end_{std::move(base_end)}, delta_{std::move(delta)}, masked_{masked} {
+    SkipMasked();
+  }
+
+  friend bool operator==(LayeredQueryIterator const &lhs, LayeredQueryIterator const &rhs) {
+    return lhs.base_ == rhs.base_ && lhs.delta_ == rhs.delta_;
+  }
+
+  auto operator++() -> LayeredQueryIterator & {
+    if (base_ != base_end_) {
+      ++base_;
+      SkipMasked();
+    } else {
+      ++delta_;
+    }
+    return *this;
+  }
+
+  auto operator*() const -> Entry<IndexPoint> const & { return base_ != base_end_ ? *base_ : *delta_; }
+  auto operator->() const -> Entry<IndexPoint> const * { return &**this; }
+
+ private:
+  void SkipMasked() {
+    if (masked_->empty()) return;
+    while (base_ != base_end_ && masked_->contains(base_->vertex())) ++base_;
+  }
+
+  query_iterator base_;
+  query_iterator base_end_;
+  query_iterator delta_;
+  masked_t const *masked_;
+};
+
 }
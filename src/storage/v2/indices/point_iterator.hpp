@@ -22,19 +22,19 @@ struct PointIterator {
   using value_type = VertexAccessor;
 
   PointIterator(Storage *storage, Transaction *transaction, CoordinateReferenceSystem crs,
-                index_t<IndexPointWGS2d>::const_query_iterator iter)
+                LayeredQueryIterator<IndexPointWGS2d> iter)
       : storage_{storage}, transaction_{transaction}, crs_{crs}, wgs84_2d_{std::move(iter)} {}
 
   PointIterator(Storage *storage, Transaction *transaction, CoordinateReferenceSystem crs,
-                index_t<IndexPointWGS3d>::const_query_iterator iter)
+                LayeredQueryIterator<IndexPointWGS3d> iter)
       : storage_{storage}, transaction_{transaction}, crs_{crs}, wgs84_3d_{std::move(iter)} {}
 
   PointIterator(Storage *storage, Transaction *transaction, CoordinateReferenceSystem crs,
-                index_t<IndexPointCartesian2d>::const_query_iterator iter)
+                LayeredQueryIterator<IndexPointCartesian2d> iter)
       : storage_{storage}, transaction_{transaction}, crs_{crs}, cartesian_2d_{std::move(iter)} {}
 
   PointIterator(Storage *storage, Transaction *transaction, CoordinateReferenceSystem crs,
-                index_t<IndexPointCartesian3d>::const_query_iterator iter)
+                LayeredQueryIterator<IndexPointCartesian3d> iter)
       : storage_{storage}, transaction_{transaction}, crs_{crs}, cartesian_3d_{std::move(iter)} {}
 
   PointIterator(PointIterator const &o) : storage_{o.storage_}, transaction_{o.transaction_}, crs_{o.crs_} {
@@ -211,10 +211,10 @@ struct PointIterator {
   Transaction *transaction_ = nullptr;
   CoordinateReferenceSystem crs_;
   union {
-    index_t<IndexPointWGS2d>::const_query_iterator wgs84_2d_;
-    index_t<IndexPointWGS3d>::const_query_iterator wgs84_3d_;
-    index_t<IndexPointCartesian2d>::const_query_iterator cartesian_2d_;
-    index_t<IndexPointCartesian3d>::const_query_iterator cartesian_3d_;
+    LayeredQueryIterator<IndexPointWGS2d> wgs84_2d_;
+    LayeredQueryIterator<IndexPointWGS3d> wgs84_3d_;
+    LayeredQueryIterator<IndexPointCartesian2d> cartesian_2d_;
+    LayeredQueryIterator<IndexPointCartesian3d> cartesian_3d_;
   };
 };
 }  // namespace memgraph::storage
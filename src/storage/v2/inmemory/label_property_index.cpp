@@ -9,9 +9,14 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
 
 #include "storage/v2/constraints/constraints.hpp"
 #include "storage/v2/indices/indices_utils.hpp"
@@ -27,6 +32,128 @@
 
 namespace memgraph::storage {
 
+size_t InMemoryLabelPropertyIndex::HashLookup::ValueHash::operator()(const PropertyValue &value) const {
+  return HashPropertyValue(value);
+}
+
+auto InMemoryLabelPropertyIndex::HashLookup::Matches::Iterator::operator*() const -> const Match & {
+  return std::visit([](const auto &it) -> const Match & { return *it; }, it_);
+}
+
+auto InMemoryLabelPropertyIndex::HashLookup::Matches::Iterator::operator++() -> Iterator & {
+  std::visit([](auto &it) { ++it; }, it_);
+  return *this;
+}
+
+auto InMemoryLabelPropertyIndex::HashLookup::Matches::begin() const -> Iterator {
+  if (large_accessor_) return Iterator{large_accessor_->begin()};
+  return Iterator{small_ ? small_->data() : nullptr};
+}
+
+auto InMemoryLabelPropertyIndex::HashLookup::Matches::end() const -> Iterator {
+  if (large_accessor_) return Iterator{large_accessor_->end()};
+  return Iterator{small_ ? small_->data() + small_->size() : nullptr};
+}
+
+void InMemoryLabelPropertyIndex::HashLookup::Insert(const PropertyValue &value, Vertex *vertex, uint64_t timestamp) {
+  const auto hash = HashPropertyValue(value);
+  auto &shard = ShardFor(hash);
+  auto guard = std::unique_lock{shard.lock};
+  const Match match{vertex, timestamp};
+  auto &bucket = shard.entries[value];
+  if (bucket.large) {
+    // Same as the skip list, an already existing entry isn't added again
+    bucket.large->access().insert(match);
+    return;
+  }
+
+  static const std::vector<Match> kNoMatches;
+  const auto &matches = bucket.small ? *bucket.small : kNoMatches;
+  auto it = std::lower_bound(matches.begin(), matches.end(), match);
+  if (it != matches.end() && *it == match) return;
+  if (matches.size() < kMaxSmallBucket) {
+    // Readers might still iterate the old vector, so it is replaced instead of changed
+    auto updated = std::vector<Match>{};
+    updated.reserve(matches.size() + 1);
+    updated.insert(updated.end(), matches.begin(), it);
+    updated.push_back(match);
+    updated.insert(updated.end(), it, matches.end());
+    bucket.small = std::make_shared<const std::vector<Match>>(std::move(updated));
+    return;
+  }
+
+  auto large = std::make_shared<utils::SkipList<Match>>();
+  {
+    auto acc = large->access();
+    for (const auto &small_match : matches) acc.insert(small_match);
+    acc.insert(match);
+  }
+  bucket.large = std::move(large);
+  bucket.small.reset();
+}
+
+void InMemoryLabelPropertyIndex::HashLookup::Remove(const PropertyValue &value, Vertex *vertex, uint64_t timestamp) {
+  const auto hash = HashPropertyValue(value);
+  auto &shard = ShardFor(hash);
+  auto guard = std::unique_lock{shard.lock};
+  auto entry = shard.entries.find(value);
+  if (entry == shard.entries.end()) return;
+  auto &bucket = entry->second;
+  const Match match{vertex, timestamp};
+  if (bucket.large) {
+    if (bucket.large->access().remove(match) && bucket.large->size() == 0) shard.entries.erase(entry);
+    return;
+  }
+
+  const auto &matches = *bucket.small;
+  auto it = std::lower_bound(matches.begin(), matches.end(), match);
+  if (it == matches.end() || *it != match) return;
+  if (matches.size() == 1) {
+    shard.entries.erase(entry);
+    return;
+  }
+  auto updated = std::vector<Match>{};
+  updated.reserve(matches.size() - 1);
+  updated.insert(updated.end(), matches.begin(), it);
+  updated.insert(updated.end(), std::next(it), matches.end());
+  bucket.small = std::make_shared<const std::vector<Match>>(std::move(updated));
+}
+
+auto InMemoryLabelPropertyIndex::HashLookup::Find(const PropertyValue &value) const -> Matches {
+  const auto hash = HashPropertyValue(value);
+  const auto &shard = ShardFor(hash);
+  auto guard = std::shared_lock{shard.lock};
+  Matches matches;
+  auto entry = shard.entries.find(value);
+  if (entry == shard.entries.end()) return matches;
+  if (entry->second.large) {
+    matches.large_ = entry->second.large;
+    matches.large_accessor_.emplace(matches.large_->access());
+  } else {
+    matches.small_ = entry->second.small;
+  }
+  return matches;
+}
+
+uint64_t InMemoryLabelPropertyIndex::HashLookup::Count(const PropertyValue &value) const {
+  const auto hash = HashPropertyValue(value);
+  const auto &shard = ShardFor(hash);
+  auto guard = std::shared_lock{shard.lock};
+  auto entry = shard.entries.find(value);
+  if (entry == shard.entries.end()) return 0;
+  const auto &bucket = entry->second;
+  return bucket.large ? bucket.large->size() : bucket.small->size();
+}
+
+void InMemoryLabelPropertyIndex::HashLookup::RunGC() {
+  for (auto &shard : shards_) {
+    auto guard = std::shared_lock{shard.lock};
+    for (auto &[_, bucket] : shard.entries) {
+      if (bucket.large) bucket.large->run_gc();
+    }
+  }
+}
+
 bool InMemoryLabelPropertyIndex::Entry::operator<(const Entry &rhs) const {
   if (value < rhs.value) {
     return true;
@@ -101,6 +228,9 @@ void InMemoryLabelPropertyIndex::UpdateOnAddLabel(LabelId added_label, Vertex *v
     }
     auto prop_value = vertex_after_update->properties.GetProperty(label_prop.second);
     if (!prop_value.IsNull()) {
+      if (auto *hash_lookup = FindHashLookup(label_prop)) {
+        hash_lookup->Insert(prop_value, vertex_after_update, tx.start_timestamp);
+      }
       auto acc = storage.access();
       acc.insert(Entry{std::move(prop_value), vertex_after_update, tx.start_timestamp});
     }
@@ -120,6 +250,9 @@ void InMemoryLabelPropertyIndex::UpdateOnSetProperty(PropertyId property, const
 
   for (const auto &[label, storage] : index->second) {
     if (!utils::Contains(vertex->labels, label)) continue;
+    if (auto *hash_lookup = FindHashLookup({label, property})) {
+      hash_lookup->Insert(value, vertex, tx.start_timestamp);
+    }
     auto acc = storage->access();
     acc.insert(Entry{value, vertex, tx.start_timestamp});
   }
@@ -134,6 +267,7 @@ bool InMemoryLabelPropertyIndex::DropIndex(LabelId label, PropertyId property) {
     }
   }
 
+  hash_lookups_.erase({label, property});
   return index_.erase({label, property}) > 0;
 }
 
@@ -150,6 +284,51 @@ std::vector<std::pair<LabelId, PropertyId>> InMemoryLabelPropertyIndex::ListIndi
   return ret;
 }
 
+bool InMemoryLabelPropertyIndex::CreateHashLookup(LabelId label, PropertyId property) {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
+  auto [hash_it, emplaced] = hash_lookups_.try_emplace({label, property});
+  if (!emplaced) {
+    return false;
+  }
+  auto &hash_lookup = hash_it->second;
+  for (const auto &entry : it->second.access()) {
+    hash_lookup.Insert(entry.value, entry.vertex, entry.timestamp);
+  }
+  return true;
+}
+
+bool InMemoryLabelPropertyIndex::HashLookupExists(LabelId label, PropertyId property) const {
+  return hash_lookups_.contains({label, property});
+}
+
+std::vector<std::pair<LabelId, PropertyId>> InMemoryLabelPropertyIndex::ListHashLookups() const {
+  std::vector<std::pair<LabelId, PropertyId>> ret;
+  ret.reserve(hash_lookups_.size());
+  for (const auto &item : hash_lookups_) {
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+InMemoryLabelPropertyIndex::HashLookup *InMemoryLabelPropertyIndex::FindHashLookup(
+    const std::pair<LabelId, PropertyId> &key) {
+  if (hash_lookups_.empty()) return nullptr;
+  auto it = hash_lookups_.find(key);
+  return it == hash_lookups_.end() ? nullptr : &it->second;
+}
+
+const InMemoryLabelPropertyIndex::HashLookup *InMemoryLabelPropertyIndex::FindEqualityLookup(
+    LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound) const {
+  if (hash_lookups_.empty()) return nullptr;
+  const bool is_equality = lower_bound && upper_bound && lower_bound->IsInclusive() && upper_bound->IsInclusive() &&
+                           !lower_bound->value().IsNull() && lower_bound->value() == upper_bound->value();
+  if (!is_equality) return nullptr;
+  auto it = hash_lookups_.find({label, property});
+  return it == hash_lookups_.end() ? nullptr : &it->second;
+}
+
 void InMemoryLabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) {
   auto maybe_stop = utils::ResettableCounter<2048>();
 
@@ -158,6 +337,7 @@ void InMemoryLabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_st
     // before starting index, check if stop_requested
     if (token.stop_requested()) return;
 
+    auto *hash_lookup = FindHashLookup(label_property);
     auto index_acc = index.access();
     auto it = index_acc.begin();
     auto end_it = index_acc.end();
@@ -174,6 +354,7 @@ void InMemoryLabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_st
         bool redundant_duplicate = has_next && it->vertex == next_it->vertex && it->value == next_it->value;
         if (redundant_duplicate ||
             !AnyVersionHasLabelProperty(*it->vertex, label_id, prop_id, it->value, oldest_active_start_timestamp)) {
+          if (hash_lookup) hash_lookup->Remove(it->value, it->vertex, it->timestamp);
           index_acc.remove(*it);
         }
       }
@@ -184,21 +365,50 @@ void InMemoryLabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_st
 }
 
 InMemoryLabelPropertyIndex::Iterable::Iterator::Iterator(Iterable *self,
-                                                         utils::SkipList<Entry>::Iterator index_iterator)
+                                                         utils::SkipList<Entry>::Iterator index_iterator,
+                                                         HashLookup::Matches::Iterator hash_iterator)
     : self_(self),
       index_iterator_(index_iterator),
+      hash_iterator_(hash_iterator),
       current_vertex_accessor_(nullptr, self_->storage_, nullptr),
       current_vertex_(nullptr) {
   AdvanceUntilValid();
 }
 
 InMemoryLabelPropertyIndex::Iterable::Iterator &InMemoryLabelPropertyIndex::Iterable::Iterator::operator++() {
-  ++index_iterator_;
+  if (self_->hash_lookup_) {
+    ++hash_iterator_;
+  } else {
+    ++index_iterator_;
+  }
   AdvanceUntilValid();
   return *this;
 }
 
 void InMemoryLabelPropertyIndex::Iterable::Iterator::AdvanceUntilValid() {
+  if (self_->hash_lookup_) {
+    // All matches are equal to the looked up value, so only the visibility
+    // checks of the skip list iteration below are needed.
+    for (const auto hash_end = self_->hash_matches_.end(); hash_iterator_ != hash_end; ++hash_iterator_) {
+      const auto &match = *hash_iterator_;
+      if (match.vertex == current_vertex_) {
+        continue;
+      }
+
+      if (!CanSeeEntityWithTimestamp(match.timestamp, self_->transaction_)) {
+        continue;
+      }
+
+      if (CurrentVersionHasLabelProperty(*match.vertex, self_->label_, self_->property_, self_->lower_bound_->value(),
+                                         self_->transaction_, self_->view_)) {
+        current_vertex_ = match.vertex;
+        current_vertex_accessor_ = VertexAccessor(current_vertex_, self_->storage_, self_->transaction_);
+        break;
+      }
+    }
+    return;
+  }
+
   for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
     if (index_iterator_->vertex == current_vertex_) {
       continue;
@@ -241,7 +451,8 @@ InMemoryLabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor
                                                PropertyId property,
                                                const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                                                const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
-                                               Storage *storage, Transaction *transaction)
+                                               Storage *storage, Transaction *transaction,
+                                               const HashLookup *hash_lookup)
     : pin_accessor_(std::move(vertices_accessor)),
       index_accessor_(std::move(index_accessor)),
       label_(label),
@@ -250,7 +461,14 @@ InMemoryLabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor
       upper_bound_(upper_bound),
       view_(view),
       storage_(storage),
-      transaction_(transaction) {
+      transaction_(transaction),
+      hash_lookup_(hash_lookup) {
+  if (hash_lookup_) {
+    // Equality lookup, the bounds are already valid and equal
+    hash_matches_ = hash_lookup_->Find(lower_bound_->value());
+    return;
+  }
+
   // We have to fix the bounds that the user provided to us. If the user
   // provided only one bound we should make sure that only values of that type
   // are returned by the iterator. We ensure this by supplying either an
@@ -361,6 +579,7 @@ InMemoryLabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor
 }
 
 InMemoryLabelPropertyIndex::Iterable::Iterator InMemoryLabelPropertyIndex::Iterable::begin() {
+  if (hash_lookup_) return {this, index_accessor_.end(), hash_matches_.begin()};
   // If the bounds are set and don't have comparable types we don't yield any
   // items from the index.
   if (!bounds_valid_) return {this, index_accessor_.end()};
@@ -372,7 +591,7 @@ InMemoryLabelPropertyIndex::Iterable::Iterator InMemoryLabelPropertyIndex::Itera
 }
 
 InMemoryLabelPropertyIndex::Iterable::Iterator InMemoryLabelPropertyIndex::Iterable::end() {
-  return {this, index_accessor_.end()};
+  return {this, index_accessor_.end(), hash_matches_.end()};
 }
 
 uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(LabelId label, PropertyId property) const {
@@ -385,6 +604,11 @@ uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(LabelId label, Prope
                                                             const PropertyValue &value) const {
   auto it = index_.find({label, property});
   MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
+  if (!value.IsNull()) {
+    if (auto hash_it = hash_lookups_.find({label, property}); hash_it != hash_lookups_.end()) {
+      return hash_it->second.Count(value);
+    }
+  }
   auto acc = it->second.access();
   if (!value.IsNull()) {
     // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
@@ -455,6 +679,9 @@ void InMemoryLabelPropertyIndex::RunGC() {
   for (auto &index_entry : index_) {
     index_entry.second.run_gc();
   }
+  for (auto &[_, hash_lookup] : hash_lookups_) {
+    hash_lookup.RunGC();
+  }
 }
 
 InMemoryLabelPropertyIndex::Iterable InMemoryLabelPropertyIndex::Vertices(
@@ -467,8 +694,16 @@ InMemoryLabelPropertyIndex::Iterable InMemoryLabelPropertyIndex::Vertices(
   auto vertices_acc = static_cast<InMemoryStorage const *>(storage)->vertices_.access();
   auto it = index_.find({label, property});
   MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
-  return {it->second.access(), std::move(vertices_acc), label, property, lower_bound, upper_bound, view, storage,
-          transaction};
+  return {it->second.access(),
+          std::move(vertices_acc),
+          label,
+          property,
+          lower_bound,
+          upper_bound,
+          view,
+          storage,
+          transaction,
+          FindEqualityLookup(label, property, lower_bound, upper_bound)};
 }
 
 InMemoryLabelPropertyIndex::Iterable InMemoryLabelPropertyIndex::Vertices(
@@ -479,8 +714,16 @@ InMemoryLabelPropertyIndex::Iterable InMemoryLabelPropertyIndex::Vertices(
     Transaction *transaction) {
   auto it = index_.find({label, property});
   MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
-  return {it->second.access(), std::move(vertices_acc), label, property, lower_bound, upper_bound, view, storage,
-          transaction};
+  return {it->second.access(),
+          std::move(vertices_acc),
+          label,
+          property,
+          lower_bound,
+          upper_bound,
+          view,
+          storage,
+          transaction,
+          FindEqualityLookup(label, property, lower_bound, upper_bound)};
 }
 
 void InMemoryLabelPropertyIndex::AbortEntries(PropertyId property,
@@ -490,9 +733,11 @@ void InMemoryLabelPropertyIndex::AbortEntries(PropertyId property,
   if (it == indices_by_property_.end()) return;
 
   auto &indices = it->second;
-  for (const auto &[_, index] : indices) {
+  for (const auto &[label, index] : indices) {
+    auto *hash_lookup = FindHashLookup({label, property});
     auto index_acc = index->access();
     for (auto const &[value, vertex] : vertices) {
+      if (hash_lookup) hash_lookup->Remove(value, vertex, exact_start_timestamp);
       index_acc.remove(Entry{value, vertex, exact_start_timestamp});
     }
   }
@@ -506,9 +751,11 @@ void InMemoryLabelPropertyIndex::AbortEntries(LabelId label,
       continue;
     }
 
+    auto *hash_lookup = FindHashLookup(label_prop);
     auto index_acc = storage.access();
     for (const auto &[property, vertex] : vertices) {
       if (!property.IsNull()) {
+        if (hash_lookup) hash_lookup->Remove(property, vertex, exact_start_timestamp);
         index_acc.remove(Entry{property, vertex, exact_start_timestamp});
       }
     }
@@ -516,6 +763,7 @@ void InMemoryLabelPropertyIndex::AbortEntries(LabelId label,
 }
 
 void InMemoryLabelPropertyIndex::DropGraphClearIndices() {
+  hash_lookups_.clear();
   index_.clear();
   indices_by_property_.clear();
   stats_->clear();
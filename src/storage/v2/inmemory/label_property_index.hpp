@@ -11,7 +11,12 @@
 
 #pragma once
 
+#include <array>
+#include <memory>
+#include <optional>
 #include <span>
+#include <unordered_map>
+#include <variant>
 
 #include "storage/v2/constraints/constraints.hpp"
 #include "storage/v2/durability/recovery_type.hpp"
@@ -20,6 +25,8 @@
 #include "storage/v2/indices/label_property_index_stats.hpp"
 #include "storage/v2/property_value.hpp"
 #include "utils/rw_lock.hpp"
+#include "utils/rw_spin_lock.hpp"
+#include "utils/skip_list.hpp"
 #include "utils/synchronized.hpp"
 
 namespace memgraph::storage {
@@ -38,6 +45,90 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
     bool operator==(const PropertyValue &rhs) const;
   };
 
+  /// Equality lookup kept next to the skip list of an index created with
+  /// `USING HASH`. It holds exactly the same entries as the skip list, grouped
+  /// by property value, so an equality seek is a single hash probe instead of
+  /// a descent through the skip list comparing property values. Entries with
+  /// the same value are kept sorted by vertex. Buckets of up to
+  /// `kMaxSmallBucket` entries are immutable vectors replaced on every change,
+  /// larger ones are skip lists, so updates never shift a large bucket and
+  /// readers iterate a bucket without copying it.
+  class HashLookup {
+   public:
+    struct Match {
+      Vertex *vertex;
+      uint64_t timestamp;
+
+      auto operator<=>(const Match &) const = default;
+    };
+
+    /// Entries equal to a value, sorted by vertex. Keeps the bucket alive, so
+    /// it stays valid while the lookup is updated.
+    class Matches {
+     public:
+      class Iterator {
+       public:
+        Iterator() = default;
+        explicit Iterator(const Match *match) : it_(match) {}
+        explicit Iterator(utils::SkipList<Match>::ConstIterator it) : it_(it) {}
+
+        const Match &operator*() const;
+        Iterator &operator++();
+
+        bool operator==(const Iterator &other) const = default;
+
+       private:
+        std::variant<const Match *, utils::SkipList<Match>::ConstIterator> it_;
+      };
+
+      Iterator begin() const;
+      Iterator end() const;
+
+     private:
+      friend class HashLookup;
+
+      std::shared_ptr<const std::vector<Match>> small_;
+      std::shared_ptr<const utils::SkipList<Match>> large_;
+      // Declared after `large_` so it is released before the skip list
+      std::optional<utils::SkipList<Match>::ConstAccessor> large_accessor_;
+    };
+
+    void Insert(const PropertyValue &value, Vertex *vertex, uint64_t timestamp);
+    void Remove(const PropertyValue &value, Vertex *vertex, uint64_t timestamp);
+
+    Matches Find(const PropertyValue &value) const;
+
+    uint64_t Count(const PropertyValue &value) const;
+
+    /// Frees the entries removed from large buckets.
+    void RunGC();
+
+   private:
+    static constexpr size_t kMaxSmallBucket = 64;
+
+    struct ValueHash {
+      size_t operator()(const PropertyValue &value) const;
+    };
+
+    /// Exactly one of the two is set.
+    struct Bucket {
+      std::shared_ptr<const std::vector<Match>> small;
+      std::shared_ptr<utils::SkipList<Match>> large;
+    };
+
+    struct Shard {
+      mutable utils::RWSpinLock lock;
+      std::unordered_map<PropertyValue, Bucket, ValueHash> entries;
+    };
+
+    static constexpr size_t kShards = 64;
+
+    Shard &ShardFor(size_t hash) { return shards_[hash % kShards]; }
+    const Shard &ShardFor(size_t hash) const { return shards_[hash % kShards]; }
+
+    std::array<Shard, kShards> shards_;
+  };
+
  public:
   InMemoryLabelPropertyIndex() = default;
 
@@ -60,6 +151,15 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
 
   std::vector<std::pair<LabelId, PropertyId>> ListIndices() const override;
 
+  /// Adds a hash lookup for equality seeks to an existing index. Returns
+  /// false if the index already has one.
+  /// @throw std::bad_alloc
+  bool CreateHashLookup(LabelId label, PropertyId property);
+
+  bool HashLookupExists(LabelId label, PropertyId property) const;
+
+  std::vector<std::pair<LabelId, PropertyId>> ListHashLookups() const;
+
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token);
 
   void AbortEntries(PropertyId property, std::span<std::pair<PropertyValue, Vertex *> const> vertices,
@@ -82,16 +182,19 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
     Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
              LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
              const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
-             Transaction *transaction);
+             Transaction *transaction, const HashLookup *hash_lookup = nullptr);
 
     class Iterator {
      public:
-      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator,
+               HashLookup::Matches::Iterator hash_iterator = {});
 
       VertexAccessor const &operator*() const { return current_vertex_accessor_; }
 
-      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
-      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+      bool operator==(const Iterator &other) const {
+        return index_iterator_ == other.index_iterator_ && hash_iterator_ == other.hash_iterator_;
+      }
+      bool operator!=(const Iterator &other) const { return !(*this == other); }
 
       Iterator &operator++();
 
@@ -100,6 +203,8 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
 
       Iterable *self_;
       utils::SkipList<Entry>::Iterator index_iterator_;
+      // Position in `hash_matches_` when the iterable uses the hash lookup
+      HashLookup::Matches::Iterator hash_iterator_;
       VertexAccessor current_vertex_accessor_;
       Vertex *current_vertex_;
     };
@@ -118,6 +223,8 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
     View view_;
     Storage *storage_;
     Transaction *transaction_;
+    const HashLookup *hash_lookup_;
+    HashLookup::Matches hash_matches_;
   };
 
   uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const override;
@@ -157,7 +264,13 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
   void DropGraphClearIndices() override;
 
  private:
+  HashLookup *FindHashLookup(const std::pair<LabelId, PropertyId> &key);
+  const HashLookup *FindEqualityLookup(LabelId label, PropertyId property,
+                                       const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                       const std::optional<utils::Bound<PropertyValue>> &upper_bound) const;
+
   std::map<std::pair<LabelId, PropertyId>, utils::SkipList<Entry>> index_;
+  std::map<std::pair<LabelId, PropertyId>, HashLookup> hash_lookups_;
   std::unordered_map<PropertyId, std::unordered_map<LabelId, utils::SkipList<Entry> *>> indices_by_property_;
   utils::Synchronized<std::map<std::pair<LabelId, PropertyId>, storage::LabelPropertyIndexStats>,
                       utils::ReadPrioritizedRWLock>
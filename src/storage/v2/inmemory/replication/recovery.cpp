@@ -15,6 +15,7 @@
 #include <iterator>
 #include <type_traits>
 #include "storage/v2/durability/durability.hpp"
+#include "storage/v2/durability/snapshot.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "storage/v2/replication/recovery.hpp"
 #include "storage/v2/transaction.hpp"
@@ -62,6 +63,8 @@ void InMemoryCurrentWalHandler::AppendSize(const size_t size) {
 
 void InMemoryCurrentWalHandler::AppendFileData(utils::InputFile *file) {
   replication::Encoder encoder(stream_.GetBuilder());
+  // The current WAL is never staged, its data always follows inline
+  encoder.WriteBool(false);
   encoder.WriteFileData(file);
 }
 
@@ -73,23 +76,97 @@ void InMemoryCurrentWalHandler::AppendBufferData(const uint8_t *buffer, const si
 replication::CurrentWalRes InMemoryCurrentWalHandler::Finalize() { return stream_.AwaitResponse(); }
 
 ////// ReplicationClient Helpers //////
+namespace {
+constexpr int kMaxFileChunkRetries = 3;
+
+bool ShouldStageFile(const std::filesystem::path &path) {
+  std::error_code error_code;  // For exception suppression.
+  const auto file_size = std::filesystem::file_size(path, error_code);
+  return !error_code && file_size > replication::kFileChunkSize;
+}
+
+/// Sends `size` bytes of the file starting at `source_offset` to the replica's
+/// staging directory in chunks, where they are stored as `filename` of
+/// `file_size` bytes. The transfer continues from whatever the replica already
+/// holds, so a transfer that was interrupted by a lost connection doesn't
+/// start over.
+/// @throw rpc::RpcFailedException
+void StageFile(const utils::UUID &main_uuid, const utils::UUID &uuid, rpc::Client &client,
+               const std::filesystem::path &path, const std::string &filename, uint64_t file_size,
+               uint64_t source_offset, uint64_t size) {
+  auto send_chunk = [&](uint64_t offset, uint64_t chunk_size) {
+    auto stream = client.Stream<replication::FileChunkRpc>(main_uuid, uuid, filename, file_size, offset, chunk_size);
+    replication::Encoder encoder(stream.GetBuilder());
+    encoder.WriteFileChunk(path, source_offset + offset, chunk_size);
+    auto response = stream.AwaitResponse();
+    if (!response.success) throw rpc::GenericRpcFailedException();
+    return response.offset;
+  };
+
+  auto offset = send_chunk(0, 0);
+  if (offset > 0) spdlog::info("Resuming the transfer of {} at {} of {} bytes", filename, offset, size);
+  int retries = 0;
+  while (offset < size) {
+    const auto chunk_size = std::min(size - offset, replication::kFileChunkSize);
+    const auto new_offset = send_chunk(offset, chunk_size);
+    if (new_offset <= offset) {
+      // The replica dropped the chunk because it was corrupted
+      if (++retries > kMaxFileChunkRetries) throw rpc::GenericRpcFailedException();
+      spdlog::warn("Replica rejected the chunk at {} of {}, sending it again", offset, filename);
+    } else {
+      retries = 0;
+    }
+    offset = new_offset;
+  }
+}
+}  // namespace
+
 replication::WalFilesRes TransferWalFiles(const utils::UUID &main_uuid, const utils::UUID &uuid, rpc::Client &client,
                                           const std::vector<std::filesystem::path> &wal_files) {
   MG_ASSERT(!wal_files.empty(), "Wal files list is empty!");
+  for (const auto &wal : wal_files) {
+    if (ShouldStageFile(wal)) {
+      spdlog::debug("Staging wal file: {}", wal);
+      const auto file_size = std::filesystem::file_size(wal);
+      StageFile(main_uuid, uuid, client, wal, wal.filename().generic_string(), file_size, 0, file_size);
+    }
+  }
   auto stream = client.Stream<replication::WalFilesRpc>(main_uuid, uuid, wal_files.size());
   replication::Encoder encoder(stream.GetBuilder());
   for (const auto &wal : wal_files) {
     spdlog::debug("Sending wal file: {}", wal);
-    encoder.WriteFile(wal);
+    if (ShouldStageFile(wal)) {
+      encoder.WriteStagedFile(wal);
+    } else {
+      encoder.WriteFile(wal);
+    }
   }
   return stream.AwaitResponse();
 }
 
 replication::SnapshotRes TransferSnapshot(const utils::UUID &main_uuid, const utils::UUID &uuid, rpc::Client &client,
-                                          const std::filesystem::path &path) {
+                                          const std::filesystem::path &path, const bool streamed) {
+  const bool staged = ShouldStageFile(path);
+  if (staged && streamed) {
+    // The end of the snapshot goes first, so the replica can load the vertices
+    // and edges while they're still being received
+    const auto file_size = std::filesystem::file_size(path);
+    const auto filename = path.filename().generic_string();
+    const auto tail_offset = durability::ReadSnapshotInfo(path).offset_indices;
+    StageFile(main_uuid, uuid, client, path, filename + std::string{replication::kStagedTailSuffix},
+              file_size - tail_offset, tail_offset, file_size - tail_offset);
+    StageFile(main_uuid, uuid, client, path, filename, file_size, 0, tail_offset);
+  } else if (staged) {
+    const auto file_size = std::filesystem::file_size(path);
+    StageFile(main_uuid, uuid, client, path, path.filename().generic_string(), file_size, 0, file_size);
+  }
   auto stream = client.Stream<replication::SnapshotRpc>(main_uuid, uuid);
   replication::Encoder encoder(stream.GetBuilder());
-  encoder.WriteFile(path);
+  if (staged) {
+    encoder.WriteStagedFile(path);
+  } else {
+    encoder.WriteFile(path);
+  }
   return stream.AwaitResponse();
 }
 
@@ -102,6 +179,7 @@ uint64_t ReplicateCurrentWal(const utils::UUID &main_uuid, const InMemoryStorage
   stream.AppendSize(file.GetSize());
   stream.AppendFileData(&file);
   auto response = stream.Finalize();
+  if (!response.success) throw rpc::GenericRpcFailedException();
   return response.current_commit_timestamp;
 }
 
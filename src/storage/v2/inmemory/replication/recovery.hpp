@@ -22,8 +22,10 @@ class InMemoryStorage;
 replication::WalFilesRes TransferWalFiles(const utils::UUID &main_uuid, const utils::UUID &uuid, rpc::Client &client,
                                           const std::vector<std::filesystem::path> &wal_files);
 
+/// @param streamed whether the end of a staged snapshot goes first, so the
+/// replica can load the snapshot while it's being received
 replication::SnapshotRes TransferSnapshot(const utils::UUID &main_uuid, const utils::UUID &uuid, rpc::Client &client,
-                                          const std::filesystem::path &path);
+                                          const std::filesystem::path &path, bool streamed);
 
 uint64_t ReplicateCurrentWal(const utils::UUID &main_uuid, const InMemoryStorage *storage, rpc::Client &client,
                              durability::WalFile const &wal_file);
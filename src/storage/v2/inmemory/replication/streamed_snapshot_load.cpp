@@ -0,0 +1,76 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/inmemory/replication/streamed_snapshot_load.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include "storage/v2/durability/exceptions.hpp"
+
+namespace memgraph::storage {
+
+StreamedSnapshotLoad::StreamedSnapshotLoad(std::string filename, std::filesystem::path tail_path,
+                                           uint64_t tail_offset, uint64_t size, uint64_t available, LoadFunction load,
+                                           std::chrono::milliseconds stall_timeout)
+    : filename_{std::move(filename)},
+      stream_{.tail_path = std::move(tail_path),
+              .tail_offset = tail_offset,
+              .size = size,
+              .wait_for = [this](uint64_t offset) { WaitFor(offset); }},
+      stall_timeout_{stall_timeout},
+      available_{available},
+      loader_{[this, load = std::move(load)] {
+        auto result = load(stream_);
+        auto lock = std::unique_lock{mutex_};
+        done_ = true;
+        result_ = std::move(result);
+      }} {
+  spdlog::info("Loading snapshot {} while it's being received", filename_);
+}
+
+StreamedSnapshotLoad::~StreamedSnapshotLoad() { Abort(); }
+
+void StreamedSnapshotLoad::Advance(uint64_t available) {
+  {
+    auto lock = std::unique_lock{mutex_};
+    available_ = std::max(available_, available);
+  }
+  cv_.notify_all();
+}
+
+bool StreamedSnapshotLoad::Failed() {
+  auto lock = std::unique_lock{mutex_};
+  return done_ && !result_;
+}
+
+std::unique_ptr<StagedSnapshot> StreamedSnapshotLoad::Finish() {
+  Abort();
+  loader_.join();
+  return std::move(result_);
+}
+
+void StreamedSnapshotLoad::Abort() {
+  {
+    auto lock = std::unique_lock{mutex_};
+    aborted_ = true;
+  }
+  cv_.notify_all();
+}
+
+void StreamedSnapshotLoad::WaitFor(uint64_t offset) {
+  auto lock = std::unique_lock{mutex_};
+  if (!cv_.wait_for(lock, stall_timeout_, [&] { return aborted_ || available_ >= offset; })) {
+    throw durability::RecoveryFailure("Timed out waiting for the rest of the snapshot!");
+  }
+  if (available_ < offset) throw durability::RecoveryFailure("The transfer of the snapshot was abandoned!");
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,97 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "storage/v2/durability/snapshot.hpp"
+#include "storage/v2/edge.hpp"
+#include "storage/v2/enum_store.hpp"
+#include "storage/v2/name_id_mapper.hpp"
+#include "storage/v2/vertex.hpp"
+#include "utils/skip_list.hpp"
+
+namespace memgraph::storage {
+
+/// Snapshot loaded next to the storage instead of into it, so that the storage
+/// keeps its contents until the whole snapshot is loaded.
+struct StagedSnapshot {
+  utils::SkipList<Vertex> vertices;
+  utils::SkipList<Edge> edges;
+  utils::SkipList<EdgeMetadata> edges_metadata;
+  std::deque<std::pair<std::string, uint64_t>> epoch_history;
+  std::unique_ptr<NameIdMapper> name_id_mapper = std::make_unique<NameIdMapper>();
+  std::atomic<uint64_t> edge_count{0};
+  EnumStore enum_store;
+  std::optional<durability::RecoveredSnapshot> recovered;
+};
+
+/// Snapshot staged on a separate thread while the rest of it is still being
+/// received. Everything up to `available` bytes of the snapshot is on the disk.
+/// Destroying the load abandons it and waits for the thread to stop.
+class StreamedSnapshotLoad {
+ public:
+  /// Returns nullptr if the snapshot couldn't be loaded.
+  using LoadFunction = std::function<std::unique_ptr<StagedSnapshot>(const durability::SnapshotStream &)>;
+
+  /// A load waiting longer than `stall_timeout` for the next part of the
+  /// snapshot gives up, the snapshot is then loaded once it's received.
+  StreamedSnapshotLoad(std::string filename, std::filesystem::path tail_path, uint64_t tail_offset, uint64_t size,
+                       uint64_t available, LoadFunction load, std::chrono::milliseconds stall_timeout);
+
+  StreamedSnapshotLoad(const StreamedSnapshotLoad &) = delete;
+  StreamedSnapshotLoad(StreamedSnapshotLoad &&) = delete;
+  StreamedSnapshotLoad &operator=(const StreamedSnapshotLoad &) = delete;
+  StreamedSnapshotLoad &operator=(StreamedSnapshotLoad &&) = delete;
+
+  ~StreamedSnapshotLoad();
+
+  const std::string &Filename() const { return filename_; }
+
+  void Advance(uint64_t available);
+
+  bool Failed();
+
+  /// No more of the snapshot is coming, waits for the load to finish.
+  /// @return the loaded snapshot, nullptr if it couldn't be loaded
+  std::unique_ptr<StagedSnapshot> Finish();
+
+ private:
+  void Abort();
+
+  void WaitFor(uint64_t offset);
+
+  std::string filename_;
+  durability::SnapshotStream stream_;
+  std::chrono::milliseconds stall_timeout_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  uint64_t available_;
+  bool aborted_{false};
+  bool done_{false};
+  std::unique_ptr<StagedSnapshot> result_;
+  // Last, so it's stopped before anything it uses is destroyed
+  std::jthread loader_;
+};
+
+}  // namespace memgraph::storage
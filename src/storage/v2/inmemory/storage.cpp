@@ -49,6 +49,7 @@
 
 namespace memgraph::metrics {
 extern const Event PeakMemoryRes;
+extern const Event GCLatency_us;
 }  // namespace memgraph::metrics
 
 namespace memgraph::storage {
@@ -64,6 +65,7 @@ constexpr auto ActionToStorageOperation(MetadataDelta::Action action) -> durabil
     add_case(LABEL_INDEX_STATS_CLEAR);
     add_case(LABEL_INDEX_DROP);
     add_case(LABEL_PROPERTY_INDEX_CREATE);
+    add_case(LABEL_PROPERTY_HASH_INDEX_CREATE);
     add_case(LABEL_PROPERTY_INDEX_STATS_SET);
     add_case(LABEL_PROPERTY_INDEX_DROP);
     add_case(LABEL_PROPERTY_INDEX_STATS_CLEAR);
@@ -166,6 +168,11 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
         repl_storage_state_.last_durable_timestamp_ = *info->last_durable_timestamp;
         spdlog::trace("Recovering last durable timestamp {}.", *info->last_durable_timestamp);
       }
+      // Recovered vertices have no deltas, so the GC would never get to sort them
+      auto vertices_acc = vertices_.access();
+      for (auto &vertex : vertices_acc) {
+        SortAdjacency(vertex);
+      }
     }
   } else if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED ||
              config_.durability.snapshot_on_exit) {
@@ -215,7 +222,6 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
   }
 
   if (config_.gc.type == Config::Gc::Type::PERIODIC) {
-    // TODO: move out of storage have one global gc_runner_
     gc_runner_.Run("Storage GC", config_.gc.interval, [this] { this->FreeMemory({}, true); });
   }
   if (timestamp_ == kTimestampInitialId) {
@@ -227,6 +233,8 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
 
 InMemoryStorage::~InMemoryStorage() {
   stop_source.request_stop();
+  // Abandons a snapshot that is being loaded for replication
+  streamed_snapshot_load_.WithLock([](auto &load) { load.reset(); });
 
   if (config_.gc.type == Config::Gc::Type::PERIODIC) {
     gc_runner_.Stop();
@@ -449,9 +457,11 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdge(VertexAccesso
       [this, edge, from_vertex = from_vertex, edge_type = edge_type, to_vertex = to_vertex, &schema_acc]() {
         CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
         from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+        AdjacencyAppended(from_vertex->out_edges_unsorted);
 
         CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
         to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+        AdjacencyAppended(to_vertex->in_edges_unsorted);
 
         transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
         transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -565,9 +575,11 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdgeEx(VertexAcces
       [this, edge, from_vertex = from_vertex, edge_type = edge_type, to_vertex = to_vertex, &schema_acc]() {
         CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
         from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+        AdjacencyAppended(from_vertex->out_edges_unsorted);
 
         CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
         to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+        AdjacencyAppended(to_vertex->in_edges_unsorted);
 
         transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
         transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -678,6 +690,8 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor
 
   auto op1 = delete_edge_from_storage(to_vertex, &old_from_vertex->out_edges);
   auto op2 = delete_edge_from_storage(old_from_vertex, &to_vertex->in_edges);
+  old_from_vertex->out_edges_unsorted = kAdjacencyUnsorted;
+  to_vertex->in_edges_unsorted = kAdjacencyUnsorted;
 
   if (config_.properties_on_edges) {
     MG_ASSERT((op1 && op2), "Invalid database state!");
@@ -701,6 +715,7 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor
 
     CreateAndLinkDelta(&transaction_, new_from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge_ref);
     new_from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge_ref);
+    AdjacencyAppended(new_from_vertex->out_edges_unsorted);
     CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, new_from_vertex, edge_ref);
     to_vertex->in_edges.emplace_back(edge_type, new_from_vertex, edge_ref);
     if (schema_acc) {
@@ -814,6 +829,8 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetTo(EdgeAccessor *
 
   auto op1 = delete_edge_from_storage(old_to_vertex, &from_vertex->out_edges);
   auto op2 = delete_edge_from_storage(from_vertex, &old_to_vertex->in_edges);
+  from_vertex->out_edges_unsorted = kAdjacencyUnsorted;
+  old_to_vertex->in_edges_unsorted = kAdjacencyUnsorted;
 
   if (config_.properties_on_edges) {
     MG_ASSERT((op1 && op2), "Invalid database state!");
@@ -840,6 +857,7 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetTo(EdgeAccessor *
     from_vertex->out_edges.emplace_back(edge_type, new_to_vertex, edge_ref);
     CreateAndLinkDelta(&transaction_, new_to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge_ref);
     new_to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge_ref);
+    AdjacencyAppended(new_to_vertex->in_edges_unsorted);
     if (schema_acc) {
       std::visit(utils::Overloaded{[&](SchemaInfo::VertexModifyingAccessor &acc) {
                                      acc.CreateEdge(from_vertex, new_to_vertex, edge_type);
@@ -995,6 +1013,30 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
       }
     }
 
+    auto *mem_unique_constraints =
+        static_cast<InMemoryUniqueConstraints *>(storage_->constraints_.unique_constraints_.get());
+
+    // Unique constraints are validated against everything committed so far
+    // before taking the engine lock. Inside of it only values that other
+    // transactions committed to in the meantime are validated again.
+    std::vector<InMemoryUniqueConstraints::ValidationBatch> unique_constraint_batches;
+    if (transaction_.constraint_verification_info &&
+        transaction_.constraint_verification_info->NeedsUniqueConstraintVerification()) {
+      // Before validating vertices against unique constraints, we have to
+      // update unique constraints with the vertices that are going to be
+      // validated/committed.
+      const auto vertices_to_update =
+          transaction_.constraint_verification_info->GetVerticesForUniqueConstraintChecking();
+
+      for (auto const *vertex : vertices_to_update) {
+        mem_unique_constraints->UpdateBeforeCommit(vertex, transaction_);
+      }
+
+      const auto vertices_to_validate =
+          std::vector<Vertex const *>{vertices_to_update.begin(), vertices_to_update.end()};
+      unique_constraint_batches = mem_unique_constraints->PrepareValidation(vertices_to_validate, transaction_);
+    }
+
     // Result of validating the vertex against unqiue constraints. It has to be
     // declared outside of the critical section scope because its value is
     // tested for Abort call which has to be done out of the scope.
@@ -1040,32 +1082,10 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
         });
       }
 
-      auto *mem_unique_constraints =
-          static_cast<InMemoryUniqueConstraints *>(storage_->constraints_.unique_constraints_.get());
-
       commit_timestamp_.emplace(mem_storage->GetCommitTimestamp());
 
-      if (transaction_.constraint_verification_info &&
-          transaction_.constraint_verification_info->NeedsUniqueConstraintVerification()) {
-        // Before committing and validating vertices against unique constraints,
-        // we have to update unique constraints with the vertices that are going
-        // to be validated/committed.
-        const auto vertices_to_update =
-            transaction_.constraint_verification_info->GetVerticesForUniqueConstraintChecking();
-
-        for (auto const *vertex : vertices_to_update) {
-          mem_unique_constraints->UpdateBeforeCommit(vertex, transaction_);
-        }
-
-        for (auto const *vertex : vertices_to_update) {
-          // No need to take any locks here because we modified this vertex and no
-          // one else can touch it until we commit.
-          unique_constraint_violation = mem_unique_constraints->Validate(*vertex, transaction_, *commit_timestamp_);
-          if (unique_constraint_violation) {
-            break;
-          }
-        }
-      }
+      unique_constraint_violation =
+          mem_unique_constraints->ValidatePrepared(unique_constraint_batches, transaction_, *commit_timestamp_);
 
       if (!unique_constraint_violation) {
         // Durability stage
@@ -1112,6 +1132,10 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
         mem_storage->indices_.point_index_.InstallNewPointIndex(transaction_.point_index_change_collector_,
                                                                 transaction_.point_index_ctx_);
 
+        // Transactions validating the same values before taking the engine
+        // lock have to validate them again
+        mem_unique_constraints->MarkCommitted(unique_constraint_batches);
+
         // TODO: can and should this be moved earlier?
         mem_storage->commit_log_->MarkFinished(start_timestamp);
 
@@ -1171,6 +1195,8 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
   auto new_transaction = mem_storage->CreateTransaction(transaction_.isolation_level, transaction_.storage_mode);
   transaction_.start_timestamp = new_transaction.start_timestamp;
   transaction_.transaction_id = new_transaction.transaction_id;
+  // The cached graph projections are looked up by the last commit the transaction sees
+  transaction_.last_commit_timestamp = new_transaction.last_commit_timestamp;
   transaction_.commit_timestamp.reset();
   transaction_.original_start_timestamp = original_start_timestamp;
 
@@ -1181,6 +1207,7 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
 
 void InMemoryStorage::InMemoryAccessor::GCRapidDeltaCleanup(std::list<Gid> &current_deleted_edges,
                                                             std::list<Gid> &current_deleted_vertices,
+                                                            std::list<Gid> &current_unsorted_vertices,
                                                             IndexPerformanceTracker &impact_tracker) {
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
 
@@ -1199,6 +1226,9 @@ void InMemoryStorage::InMemoryAccessor::GCRapidDeltaCleanup(std::list<Gid> &curr
           if (vertex.deleted) {
             DMG_ASSERT(delta.action == Delta::Action::RECREATE_OBJECT);
             current_deleted_vertices.push_back(vertex.gid);
+          } else if (NeedsAdjacencySort(vertex)) {
+            // Merging is left to the GC, so that commits don't pay for it
+            current_unsorted_vertices.push_back(vertex.gid);
           }
           break;
         }
@@ -1251,10 +1281,11 @@ void InMemoryStorage::InMemoryAccessor::FastDiscardOfDeltas(std::unique_lock<std
   // STEP 1 + STEP 2 - delta cleanup
   std::list<Gid> current_deleted_vertices;
   std::list<Gid> current_deleted_edges;
+  std::list<Gid> current_unsorted_vertices;
   auto impact_tracker = IndexPerformanceTracker{};
-  GCRapidDeltaCleanup(current_deleted_edges, current_deleted_vertices, impact_tracker);
+  GCRapidDeltaCleanup(current_deleted_edges, current_deleted_vertices, current_unsorted_vertices, impact_tracker);
 
-  // STEP 3) hand over the deleted vertices and edges to the GC
+  // STEP 3) hand over the deleted vertices and edges, and the vertices with adjacency to sort, to the GC
   if (!current_deleted_vertices.empty()) {
     mem_storage->deleted_vertices_.WithLock(
         [&](auto &deleted_vertices) { deleted_vertices.splice(deleted_vertices.end(), current_deleted_vertices); });
@@ -1263,6 +1294,11 @@ void InMemoryStorage::InMemoryAccessor::FastDiscardOfDeltas(std::unique_lock<std
     mem_storage->deleted_edges_.WithLock(
         [&](auto &deleted_edges) { deleted_edges.splice(deleted_edges.end(), current_deleted_edges); });
   }
+  if (!current_unsorted_vertices.empty()) {
+    mem_storage->unsorted_adjacency_vertices_.WithLock([&](auto &unsorted_vertices) {
+      unsorted_vertices.splice(unsorted_vertices.end(), current_unsorted_vertices);
+    });
+  }
 
   // STEP 4) hint to GC that indices need cleanup for performance reasons
   if (impact_tracker.impacts_vertex_indexes()) {
@@ -1374,6 +1410,7 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
                 auto it = std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link);
                 MG_ASSERT(it == vertex->in_edges.end(), "Invalid database state!");
                 vertex->in_edges.push_back(link);
+                AdjacencyAppended(vertex->in_edges_unsorted);
                 break;
               }
               case Delta::Action::ADD_OUT_EDGE: {
@@ -1382,6 +1419,7 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
                 auto it = std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link);
                 MG_ASSERT(it == vertex->out_edges.end(), "Invalid database state!");
                 vertex->out_edges.push_back(link);
+                AdjacencyAppended(vertex->out_edges_unsorted);
                 // Increment edge count. We only increment the count here because
                 // the information in `ADD_IN_EDGE` and `Edge/RECREATE_OBJECT` is
                 // redundant. Also, `Edge/RECREATE_OBJECT` isn't available when
@@ -1396,6 +1434,7 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
                 MG_ASSERT(it != vertex->in_edges.end(), "Invalid database state!");
                 std::swap(*it, *vertex->in_edges.rbegin());
                 vertex->in_edges.pop_back();
+                vertex->in_edges_unsorted = kAdjacencyUnsorted;
                 break;
               }
               case Delta::Action::REMOVE_OUT_EDGE: {
@@ -1405,6 +1444,7 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
                 MG_ASSERT(it != vertex->out_edges.end(), "Invalid database state!");
                 std::swap(*it, *vertex->out_edges.rbegin());
                 vertex->out_edges.pop_back();
+                vertex->out_edges_unsorted = kAdjacencyUnsorted;
                 // Decrement edge count. We only decrement the count here because
                 // the information in `REMOVE_IN_EDGE` and `Edge/DELETE_OBJECT` is
                 // redundant. Also, `Edge/DELETE_OBJECT` isn't available when edge
@@ -1642,6 +1682,22 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   return {};
 }
 
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::CreateHashIndex(
+    LabelId label, PropertyId property) {
+  MG_ASSERT(unique_guard_.owns_lock(), "Creating label-property index requires a unique access to the storage!");
+  auto *in_memory = static_cast<InMemoryStorage *>(storage_);
+  auto *mem_label_property_index =
+      static_cast<InMemoryLabelPropertyIndex *>(in_memory->indices_.label_property_index_.get());
+  if (!mem_label_property_index->CreateIndex(label, property, in_memory->vertices_.access(), std::nullopt)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  mem_label_property_index->CreateHashLookup(label, property);
+  transaction_.md_deltas.emplace_back(MetadataDelta::label_property_hash_index_create, label, property);
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ActiveLabelPropertyIndices);
+  return {};
+}
+
 utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::CreateIndex(
     EdgeTypeId edge_type, bool unique_access_needed) {
   if (unique_access_needed) {
@@ -1918,22 +1974,30 @@ Transaction InMemoryStorage::CreateTransaction(IsolationLevel isolation_level, S
   // `timestamp`) below.
   uint64_t transaction_id = 0;
   uint64_t start_timestamp = 0;
+  uint64_t last_commit_timestamp = 0;
   std::optional<PointIndexContext> point_index_context;
   {
     auto guard = std::lock_guard{engine_lock_};
     transaction_id = transaction_id_++;
     start_timestamp = timestamp_++;
+    // Commits publish their changes and update the last durable timestamp
+    // while holding the engine lock, so this is consistent with `start_timestamp`
+    last_commit_timestamp = repl_storage_state_.last_durable_timestamp_.load(std::memory_order_acquire);
     // IMPORTANT: this is retrieved while under the lock so that the index is consistant with the timestamp
     point_index_context = indices_.point_index_.CreatePointIndexContext();
   }
   DMG_ASSERT(point_index_context.has_value(), "Expected a value, even if got 0 point indexes");
-  return {transaction_id,
-          start_timestamp,
-          isolation_level,
-          storage_mode,
-          false,
-          !constraints_.empty(),
-          *std::move(point_index_context)};
+  Transaction transaction{transaction_id,
+                          start_timestamp,
+                          isolation_level,
+                          storage_mode,
+                          false,
+                          !constraints_.empty(),
+                          *std::move(point_index_context)};
+  if (storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL) {
+    transaction.last_commit_timestamp = last_commit_timestamp;
+  }
+  return transaction;
 }
 
 void InMemoryStorage::SetStorageMode(StorageMode new_storage_mode) {
@@ -1951,6 +2015,9 @@ void InMemoryStorage::SetStorageMode(StorageMode new_storage_mode) {
     }
 
     storage_mode_ = new_storage_mode;
+    // Analytical writes don't advance the last durable timestamp, so cached
+    // projections can't be told apart from the graph after switching back
+    graph_projection_cache_.Clear();
     FreeMemory(std::move(main_guard), false);
   }
 }
@@ -1990,6 +2057,12 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
     }
   }};
 
+  utils::Timer gc_timer;
+  utils::OnScopeExit gc_latency_measurer{[&gc_timer] {
+    memgraph::metrics::Measure(memgraph::metrics::GCLatency_us,
+                               std::chrono::duration_cast<std::chrono::microseconds>(gc_timer.Elapsed()).count());
+  }};
+
   // Only one gc run at a time
   auto gc_guard = std::unique_lock{gc_lock_, std::try_to_lock};
   if (!gc_guard.owns_lock()) {
@@ -2054,6 +2127,10 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   deleted_vertices_.WithLock([&](auto &deleted_vertices) { current_deleted_vertices.swap(deleted_vertices); });
   deleted_edges_.WithLock([&](auto &deleted_edges) { current_deleted_edges.swap(deleted_edges); });
 
+  std::list<Gid> current_unsorted_vertices{};
+  unsorted_adjacency_vertices_.WithLock(
+      [&](auto &unsorted_vertices) { current_unsorted_vertices.swap(unsorted_vertices); });
+
   auto const need_full_scan_vertices = gc_full_scan_vertices_delete_.exchange(false);
   auto const need_full_scan_edges = gc_full_scan_edges_delete_.exchange(false);
 
@@ -2125,6 +2202,9 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
             if (vertex->deleted) {
               DMG_ASSERT(delta.action == memgraph::storage::Delta::Action::RECREATE_OBJECT);
               current_deleted_vertices.push_back(vertex->gid);
+            } else {
+              // No transaction is changing the vertex anymore, so its edges can be ordered
+              SortAdjacency(*vertex);
             }
             break;
           }
@@ -2218,6 +2298,19 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
     });
   }
 
+  // Vertices whose deltas were discarded at commit still have their adjacency to sort
+  if (!current_unsorted_vertices.empty()) {
+    auto vertices_acc = vertices_.access();
+    for (auto gid : current_unsorted_vertices) {
+      auto vertex = vertices_acc.find(gid);
+      if (vertex == vertices_acc.end()) continue;
+      auto vertex_guard = std::unique_lock{vertex->lock};
+      // A vertex that is being changed again is sorted once its deltas are collected
+      if (vertex->delta != nullptr || vertex->deleted) continue;
+      SortAdjacency(*vertex);
+    }
+  }
+
   // Index cleanup runs can be expensive, we want to avoid high CPU usage when the GC doesn't have to clean up any
   // indexes.
   // - Correctness: we need to remove entries from indexes to avoid dangling raw pointers
@@ -2252,6 +2345,8 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
     if (index_cleanup_edge_needed || index_cleanup_edge_performance) {
       indices_.RemoveObsoleteEdgeEntries(oldest_active_start_timestamp, token);
     }
+    // Commits only add to the small layers of the point indices, merging them is left to the GC
+    indices_.point_index_.MergeLayers(engine_lock_);
   }
 
   {
@@ -2499,6 +2594,7 @@ bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t durab
         break;
       }
       case MetadataDelta::Action::LABEL_PROPERTY_INDEX_CREATE:
+      case MetadataDelta::Action::LABEL_PROPERTY_HASH_INDEX_CREATE:
       case MetadataDelta::Action::LABEL_PROPERTY_INDEX_DROP:
       case MetadataDelta::Action::EXISTENCE_CONSTRAINT_CREATE:
       case MetadataDelta::Action::EXISTENCE_CONSTRAINT_DROP:
@@ -2908,6 +3004,7 @@ void InMemoryStorage::Clear() {
   // Drop any pending GC work (committed_transactions_ is holding on to old deltas)
   deleted_vertices_->clear();
   deleted_edges_->clear();
+  unsorted_adjacency_vertices_->clear();
   garbage_undo_buffers_->clear();
   committed_transactions_->clear();
 
@@ -2930,6 +3027,9 @@ void InMemoryStorage::Clear() {
   repl_storage_state_.epoch_.SetEpoch(std::string(utils::UUID{}));
   repl_storage_state_.last_durable_timestamp_ = 0;
   repl_storage_state_.history.clear();
+
+  // Cached projections are keyed by commit timestamps which are now reused
+  graph_projection_cache_.Clear();
 }
 
 bool InMemoryStorage::InMemoryAccessor::PointIndexExists(LabelId label, PropertyId property) const {
@@ -2947,9 +3047,13 @@ IndicesInfo InMemoryStorage::InMemoryAccessor::ListAllIndices() const {
   auto &text_index = storage_->indices_.text_index_;
   auto &point_index = storage_->indices_.point_index_;
 
-  return {mem_label_index->ListIndices(),     mem_label_property_index->ListIndices(),
-          mem_edge_type_index->ListIndices(), mem_edge_type_property_index->ListIndices(),
-          text_index.ListIndices(),           point_index.ListIndices()};
+  return {mem_label_index->ListIndices(),
+          mem_label_property_index->ListIndices(),
+          mem_label_property_index->ListHashLookups(),
+          mem_edge_type_index->ListIndices(),
+          mem_edge_type_property_index->ListIndices(),
+          text_index.ListIndices(),
+          point_index.ListIndices()};
 }
 ConstraintsInfo InMemoryStorage::InMemoryAccessor::ListAllConstraints() const {
   const auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
@@ -3003,6 +3107,8 @@ void InMemoryStorage::InMemoryAccessor::DropGraph() {
   mem_storage->vertices_.clear();
   mem_storage->edges_.clear();
   mem_storage->edge_count_.store(0);
+  // The data is removed without deltas, so the commit timestamps no longer identify the graph state
+  mem_storage->graph_projection_cache_.Clear();
 
   memory::PurgeUnusedMemory();
 }
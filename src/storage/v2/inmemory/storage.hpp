@@ -28,6 +28,7 @@
 #include "replication/config.hpp"
 #include "storage/v2/delta_container.hpp"
 #include "storage/v2/inmemory/replication/recovery.hpp"
+#include "storage/v2/inmemory/replication/streamed_snapshot_load.hpp"
 #include "storage/v2/replication/enums.hpp"
 #include "storage/v2/replication/replication_storage_state.hpp"
 #include "storage/v2/replication/rpc.hpp"
@@ -285,6 +286,12 @@ class InMemoryStorage final : public Storage {
       return static_cast<InMemoryStorage *>(storage_)->indices_.label_property_index_->IndexExists(label, property);
     }
 
+    bool LabelPropertyHashIndexExists(LabelId label, PropertyId property) const override {
+      return static_cast<InMemoryLabelPropertyIndex *>(
+                 static_cast<InMemoryStorage *>(storage_)->indices_.label_property_index_.get())
+          ->HashLookupExists(label, property);
+    }
+
     bool EdgeTypeIndexExists(EdgeTypeId edge_type) const override {
       return static_cast<InMemoryStorage *>(storage_)->indices_.edge_type_index_->IndexExists(edge_type);
     }
@@ -335,6 +342,13 @@ class InMemoryStorage final : public Storage {
     /// @throw std::bad_alloc
     utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(LabelId label, PropertyId property) override;
 
+    /// Create a label-property index with a hash lookup for equality seeks.
+    /// Returns void if the index has been created.
+    /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+    /// * `IndexDefinitionError`: a label-property index on the same key already exists.
+    /// @throw std::bad_alloc
+    utils::BasicResult<StorageIndexDefinitionError, void> CreateHashIndex(LabelId label, PropertyId property) override;
+
     /// Create an index.
     /// Returns void if the index has been created.
     /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
@@ -458,7 +472,7 @@ class InMemoryStorage final : public Storage {
     /// in those cases this method is a light weight way to unlink and discard our deltas
     void FastDiscardOfDeltas(std::unique_lock<std::mutex> gc_guard);
     void GCRapidDeltaCleanup(std::list<Gid> &current_deleted_edges, std::list<Gid> &current_deleted_vertices,
-                             IndexPerformanceTracker &impact_tracker);
+                             std::list<Gid> &current_unsorted_vertices, IndexPerformanceTracker &impact_tracker);
     SalientConfig::Items config_;
   };
 
@@ -568,7 +582,7 @@ class InMemoryStorage final : public Storage {
   std::filesystem::path lock_file_path_;
   std::unique_ptr<utils::OutputFile> lock_file_handle_ = std::make_unique<utils::OutputFile>();
 
-  utils::Scheduler snapshot_runner_;
+  utils::Scheduler snapshot_runner_{utils::TaskPriority::NORMAL, /*io_heavy=*/true};
   utils::SpinLock snapshot_lock_;
 
   // Sequence number used to keep track of the chain of WALs.
@@ -582,13 +596,16 @@ class InMemoryStorage final : public Storage {
   // Global locker that is used for clients file locking
   utils::FileRetainer::FileLocker global_locker_;
 
+  // Snapshot a replica is loading while it's being received
+  utils::Synchronized<std::unique_ptr<StreamedSnapshotLoad>, std::mutex> streamed_snapshot_load_;
+
   // TODO: This isn't really a commit log, it doesn't even care if a
   // transaction commited or aborted. We could probably combine this with
   // `timestamp_` in a sensible unit, something like TransactionClock or
   // whatever.
   std::optional<CommitLog> commit_log_;
 
-  utils::Scheduler gc_runner_;
+  utils::Scheduler gc_runner_{utils::TaskPriority::HIGH};
   std::mutex gc_lock_;
 
   struct GCDeltas {
@@ -617,6 +634,10 @@ class InMemoryStorage final : public Storage {
   // storage.
   utils::Synchronized<std::list<Gid>, utils::SpinLock> deleted_edges_;
 
+  // Vertices whose adjacency lists grew past the unsorted tail limit in
+  // transactions whose deltas were discarded at commit, the GC sorts them.
+  utils::Synchronized<std::list<Gid>, utils::SpinLock> unsorted_adjacency_vertices_;
+
   std::atomic<bool> gc_index_cleanup_vertex_performance_ = false;
   std::atomic<bool> gc_index_cleanup_edge_performance_ = false;
 
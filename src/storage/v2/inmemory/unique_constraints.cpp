@@ -10,11 +10,14 @@
 // licenses/APL.txt.
 
 #include "storage/v2/inmemory/unique_constraints.hpp"
+#include <algorithm>
+#include <map>
 #include <memory>
 #include "storage/v2/constraints/constraint_violation.hpp"
 #include "storage/v2/constraints/utils.hpp"
 #include "storage/v2/durability/recovery_type.hpp"
 #include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
 #include "storage/v2/transaction.hpp"
 #include "utils/counter.hpp"
 #include "utils/logging.hpp"
@@ -439,40 +442,104 @@ bool InMemoryUniqueConstraints::ConstraintExists(LabelId label, const std::set<P
   return constraints_.find({label, properties}) != constraints_.end();
 }
 
-std::optional<ConstraintViolation> InMemoryUniqueConstraints::Validate(const Vertex &vertex, const Transaction &tx,
-                                                                       uint64_t commit_timestamp) const {
-  if (vertex.deleted) {
-    return std::nullopt;
+size_t InMemoryUniqueConstraints::CommitVersionStripe(LabelId label, const std::vector<PropertyValue> &values) {
+  auto seed = std::hash<LabelId>{}(label);
+  for (const auto &value : values) {
+    seed = detail::HashCombine(seed, HashPropertyValue(value));
   }
+  return seed % kCommitVersionStripes;
+}
 
-  for (const auto &label : vertex.labels) {
-    const auto &constraint = constraints_by_label_.find(label);
-    if (constraint == constraints_by_label_.end()) {
-      continue;
+bool InMemoryUniqueConstraints::HasConflict(utils::SkipList<Entry>::Accessor &acc, const Vertex &vertex,
+                                            const std::vector<PropertyValue> &values, LabelId label,
+                                            const std::set<PropertyId> &properties, const Transaction &tx,
+                                            uint64_t commit_timestamp) {
+  for (auto it = acc.find_equal_or_greater(values); it != acc.end(); ++it) {
+    if (values < it->values) {
+      break;
+    }
+
+    // The `vertex` that is going to be committed violates a unique constraint
+    // if it's different than a vertex indexed in the list of constraints and
+    // has the same label and property value as the last committed version of
+    // the vertex from the list.
+    if (&vertex != it->vertex &&
+        LastCommittedVersionHasLabelProperty(*it->vertex, label, properties, values, tx, commit_timestamp)) {
+      return true;
     }
+  }
+  return false;
+}
 
-    for (const auto &[properties, storage] : constraint->second) {
-      auto value_array = vertex.properties.ExtractPropertyValues(properties);
+std::vector<InMemoryUniqueConstraints::ValidationBatch> InMemoryUniqueConstraints::PrepareValidation(
+    std::span<Vertex const *const> vertices, const Transaction &tx) const {
+  std::map<std::pair<LabelId, const std::set<PropertyId> *>, ValidationBatch> batches;
+  for (const auto *vertex : vertices) {
+    // No need to take any locks here because we modified this vertex and no
+    // one else can touch it until we commit.
+    if (vertex->deleted) {
+      continue;
+    }
 
-      if (!value_array) {
+    for (const auto &label : vertex->labels) {
+      const auto &constraint = constraints_by_label_.find(label);
+      if (constraint == constraints_by_label_.end()) {
         continue;
       }
 
-      auto acc = storage->access();
-      auto it = acc.find_equal_or_greater(*value_array);
-      for (; it != acc.end(); ++it) {
-        if (*value_array < it->values) {
-          break;
+      for (const auto &[properties, storage] : constraint->second) {
+        auto value_array = vertex->properties.ExtractPropertyValues(properties);
+
+        if (!value_array) {
+          continue;
         }
 
-        // The `vertex` that is going to be committed violates a unique constraint
-        // if it's different than a vertex indexed in the list of constraints and
-        // has the same label and property value as the last committed version of
-        // the vertex from the list.
-        if (&vertex != it->vertex &&
-            LastCommittedVersionHasLabelProperty(*it->vertex, label, properties, *value_array, tx, commit_timestamp)) {
-          return ConstraintViolation{ConstraintViolation::Type::UNIQUE, label, properties};
+        auto [it, inserted] = batches.try_emplace({label, &properties});
+        if (inserted) {
+          it->second.label = label;
+          it->second.properties = &properties;
+          it->second.entries = storage;
         }
+        const auto stripe = CommitVersionStripe(label, *value_array);
+        it->second.items.push_back({std::move(*value_array), vertex, stripe, 0});
+      }
+    }
+  }
+
+  std::vector<ValidationBatch> result;
+  result.reserve(batches.size());
+  for (auto &[_, batch] : batches) {
+    std::sort(batch.items.begin(), batch.items.end(),
+              [](const auto &lhs, const auto &rhs) { return lhs.values < rhs.values; });
+
+    // Deltas of every committed transaction have a timestamp lower than any
+    // transaction id, so this checks against the latest committed versions
+    auto acc = batch.entries->access();
+    for (auto &item : batch.items) {
+      // Read before validating, a commit that isn't visible to the validation
+      // changes the version
+      item.version = commit_versions_[item.stripe].load(std::memory_order_acquire);
+      if (!batch.violated && HasConflict(acc, *item.vertex, item.values, batch.label, *batch.properties, tx,
+                                         kTransactionInitialId)) {
+        batch.violated = true;
+      }
+    }
+    result.push_back(std::move(batch));
+  }
+  return result;
+}
+
+std::optional<ConstraintViolation> InMemoryUniqueConstraints::ValidatePrepared(
+    const std::vector<ValidationBatch> &batches, const Transaction &tx, uint64_t commit_timestamp) const {
+  for (const auto &batch : batches) {
+    std::optional<utils::SkipList<Entry>::Accessor> acc;
+    for (const auto &item : batch.items) {
+      if (!batch.violated && commit_versions_[item.stripe].load(std::memory_order_acquire) == item.version) {
+        continue;
+      }
+      if (!acc) acc.emplace(batch.entries->access());
+      if (HasConflict(*acc, *item.vertex, item.values, batch.label, *batch.properties, tx, commit_timestamp)) {
+        return ConstraintViolation{ConstraintViolation::Type::UNIQUE, batch.label, *batch.properties};
       }
     }
   }
@@ -480,6 +547,14 @@ std::optional<ConstraintViolation> InMemoryUniqueConstraints::Validate(const Ver
   return std::nullopt;
 }
 
+void InMemoryUniqueConstraints::MarkCommitted(const std::vector<ValidationBatch> &batches) {
+  for (const auto &batch : batches) {
+    for (const auto &item : batch.items) {
+      commit_versions_[item.stripe].fetch_add(1, std::memory_order_release);
+    }
+  }
+}
+
 std::vector<std::pair<LabelId, std::set<PropertyId>>> InMemoryUniqueConstraints::ListConstraints() const {
   std::vector<std::pair<LabelId, std::set<PropertyId>>> ret;
   ret.reserve(constraints_.size());
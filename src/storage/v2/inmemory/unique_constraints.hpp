@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <optional>
 #include <span>
 #include <thread>
@@ -65,6 +67,24 @@ class InMemoryUniqueConstraints : public UniqueConstraints {
                                                        const LabelId &label, const std::set<PropertyId> &properties);
 
  public:
+  /// Vertices of a committing transaction that are validated against the same
+  /// constraint, sorted by their values.
+  struct ValidationBatch {
+    struct Item {
+      std::vector<PropertyValue> values;
+      const Vertex *vertex;
+      // Commit version of the values when they were validated
+      size_t stripe;
+      uint64_t version;
+    };
+
+    LabelId label;
+    const std::set<PropertyId> *properties;
+    utils::SkipList<Entry> *entries;
+    std::vector<Item> items;
+    bool violated{false};
+  };
+
   struct MultipleThreadsConstraintValidation {
     bool operator()(const utils::SkipList<Vertex>::Accessor &vertex_accessor,
                     utils::SkipList<Entry>::Accessor &constraint_accessor, const LabelId &label,
@@ -118,12 +138,26 @@ class InMemoryUniqueConstraints : public UniqueConstraints {
   void UpdateOnAddLabel(LabelId added_label, const Vertex &vertex_before_update,
                         uint64_t transaction_start_timestamp) override{};
 
-  /// Validates the given vertex against unique constraints before committing.
-  /// This method should be called while commit lock is active with
-  /// `commit_timestamp` being a potential commit timestamp of the transaction.
+  /// Groups the vertices by the constraints they are validated against and
+  /// validates them against everything committed so far. This method should
+  /// be called after `UpdateBeforeCommit` and before the commit lock is taken,
+  /// so that `ValidatePrepared` only has to recheck the values other
+  /// transactions committed to in the meantime.
   /// @throw std::bad_alloc
-  std::optional<ConstraintViolation> Validate(const Vertex &vertex, const Transaction &tx,
-                                              uint64_t commit_timestamp) const;
+  std::vector<ValidationBatch> PrepareValidation(std::span<Vertex const *const> vertices, const Transaction &tx) const;
+
+  /// Validates the prepared vertices before committing. Only vertices whose
+  /// values were committed to since they were prepared, and batches that were
+  /// found violated, are validated again. This method should be called while
+  /// commit lock is active with `commit_timestamp` being a potential commit
+  /// timestamp of the transaction.
+  std::optional<ConstraintViolation> ValidatePrepared(const std::vector<ValidationBatch> &batches,
+                                                      const Transaction &tx, uint64_t commit_timestamp) const;
+
+  /// Marks the values of the prepared vertices as committed to. This method
+  /// should be called while commit lock is active, once the transaction is
+  /// committed.
+  void MarkCommitted(const std::vector<ValidationBatch> &batches);
 
   std::vector<std::pair<LabelId, std::set<PropertyId>>> ListConstraints() const override;
 
@@ -138,8 +172,20 @@ class InMemoryUniqueConstraints : public UniqueConstraints {
       const std::optional<durability::ParallelizedSchemaCreationInfo> &);
 
  private:
+  static size_t CommitVersionStripe(LabelId label, const std::vector<PropertyValue> &values);
+
+  static bool HasConflict(utils::SkipList<Entry>::Accessor &acc, const Vertex &vertex,
+                          const std::vector<PropertyValue> &values, LabelId label,
+                          const std::set<PropertyId> &properties, const Transaction &tx, uint64_t commit_timestamp);
+
   std::map<std::pair<LabelId, std::set<PropertyId>>, utils::SkipList<Entry>> constraints_;
   std::map<LabelId, std::map<std::set<PropertyId>, utils::SkipList<Entry> *>> constraints_by_label_;
+
+  // Bumped whenever a transaction commits a vertex with label and values
+  // hashing to the stripe. Validation that happened before the commit lock is
+  // only repeated for values whose stripe changed since.
+  static constexpr size_t kCommitVersionStripes = 1024;
+  std::array<std::atomic<uint64_t>, kCommitVersionStripes> commit_versions_{};
 };
 
 }  // namespace memgraph::storage
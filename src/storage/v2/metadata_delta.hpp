@@ -28,6 +28,7 @@ struct MetadataDelta {
     LABEL_INDEX_STATS_SET,
     LABEL_INDEX_STATS_CLEAR,
     LABEL_PROPERTY_INDEX_CREATE,
+    LABEL_PROPERTY_HASH_INDEX_CREATE,
     LABEL_PROPERTY_INDEX_DROP,
     LABEL_PROPERTY_INDEX_STATS_SET,
     LABEL_PROPERTY_INDEX_STATS_CLEAR,
@@ -60,6 +61,8 @@ struct MetadataDelta {
   } label_index_stats_clear;
   static constexpr struct LabelPropertyIndexCreate {
   } label_property_index_create;
+  static constexpr struct LabelPropertyHashIndexCreate {
+  } label_property_hash_index_create;
   static constexpr struct PointIndexCreate {
   } point_index_create;
   static constexpr struct PointIndexDrop {
@@ -113,6 +116,9 @@ struct MetadataDelta {
   MetadataDelta(LabelPropertyIndexCreate /*tag*/, LabelId label, PropertyId property)
       : action(Action::LABEL_PROPERTY_INDEX_CREATE), label_property{label, property} {}
 
+  MetadataDelta(LabelPropertyHashIndexCreate /*tag*/, LabelId label, PropertyId property)
+      : action(Action::LABEL_PROPERTY_HASH_INDEX_CREATE), label_property{label, property} {}
+
   MetadataDelta(LabelPropertyIndexDrop /*tag*/, LabelId label, PropertyId property)
       : action(Action::LABEL_PROPERTY_INDEX_DROP), label_property{label, property} {}
 
@@ -185,6 +191,7 @@ struct MetadataDelta {
       case LABEL_INDEX_STATS_SET:
       case LABEL_INDEX_STATS_CLEAR:
       case LABEL_PROPERTY_INDEX_CREATE:
+      case LABEL_PROPERTY_HASH_INDEX_CREATE:
       case LABEL_PROPERTY_INDEX_DROP:
       case LABEL_PROPERTY_INDEX_STATS_SET:
       case LABEL_PROPERTY_INDEX_STATS_CLEAR:
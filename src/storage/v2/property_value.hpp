@@ -882,6 +882,53 @@ inline auto PropertyValueImpl<Alloc>::operator=(PropertyValueImpl &&other) noexc
   }
 }
 
+namespace detail {
+inline size_t HashCombine(size_t seed, size_t hash) {
+  return seed ^ (hash + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+}  // namespace detail
+
+// Must agree with `operator==` on `PropertyValue`, which considers integers
+// and doubles with the same numeric value equal. Types without a cheap
+// consistent hash only contribute their type.
+inline size_t HashPropertyValue(const PropertyValue &value) {
+  const auto type_hash = std::hash<int>{}(static_cast<int>(value.type()));
+  switch (value.type()) {
+    case PropertyValue::Type::Null:
+      return 0;
+    case PropertyValue::Type::Bool:
+      return detail::HashCombine(type_hash, std::hash<bool>{}(value.ValueBool()));
+    case PropertyValue::Type::Int:
+      return std::hash<double>{}(static_cast<double>(value.ValueInt()));
+    case PropertyValue::Type::Double:
+      return std::hash<double>{}(value.ValueDouble());
+    case PropertyValue::Type::String:
+      return detail::HashCombine(type_hash, std::hash<std::string_view>{}(value.ValueString()));
+    case PropertyValue::Type::List: {
+      auto seed = type_hash;
+      for (const auto &item : value.ValueList()) {
+        seed = detail::HashCombine(seed, HashPropertyValue(item));
+      }
+      return seed;
+    }
+    case PropertyValue::Type::Map: {
+      auto seed = type_hash;
+      for (const auto &[key, item] : value.ValueMap()) {
+        seed = detail::HashCombine(seed, std::hash<std::string_view>{}(key));
+        seed = detail::HashCombine(seed, HashPropertyValue(item));
+      }
+      return seed;
+    }
+    case PropertyValue::Type::TemporalData:
+      return detail::HashCombine(type_hash, std::hash<int64_t>{}(value.ValueTemporalData().microseconds));
+    case PropertyValue::Type::ZonedTemporalData:
+    case PropertyValue::Type::Enum:
+    case PropertyValue::Type::Point2d:
+    case PropertyValue::Type::Point3d:
+      return type_hash;
+  }
+}
+
 }  // namespace memgraph::storage
 namespace std {
 
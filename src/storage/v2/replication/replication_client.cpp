@@ -338,12 +338,16 @@ void ReplicationStorageClient::RecoverReplica(uint64_t replica_commit, memgraph:
                 [this, &replica_commit, mem_storage, &rpcClient,
                  main_uuid = main_uuid_](RecoverySnapshot const &snapshot) {
                   spdlog::debug("Sending the latest snapshot file: {} to {}", snapshot, client_.name_);
-                  auto response = TransferSnapshot(main_uuid, mem_storage->uuid(), rpcClient, snapshot);
+                  auto response = TransferSnapshot(main_uuid, mem_storage->uuid(), rpcClient, snapshot,
+                                                   mem_storage->config_.durability.streamed_snapshot_load);
+                  // The replica couldn't take the file, recovery is tried again later
+                  if (!response.success) throw rpc::GenericRpcFailedException();
                   replica_commit = response.current_commit_timestamp;
                 },
                 [this, &replica_commit, mem_storage, &rpcClient, main_uuid = main_uuid_](RecoveryWals const &wals) {
                   spdlog::debug("Sending the latest wal files to {}", client_.name_);
                   auto response = TransferWalFiles(main_uuid, mem_storage->uuid(), rpcClient, wals);
+                  if (!response.success) throw rpc::GenericRpcFailedException();
                   replica_commit = response.current_commit_timestamp;
                   spdlog::debug("Wal files successfully transferred to {}.", client_.name_);
                 },
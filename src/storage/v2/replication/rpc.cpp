@@ -73,6 +73,14 @@ void ForceResetStorageRes::Save(const ForceResetStorageRes &self, memgraph::slk:
 void ForceResetStorageRes::Load(ForceResetStorageRes *self, memgraph::slk::Reader *reader) {
   memgraph::slk::Load(self, reader);
 }
+void FileChunkReq::Save(const FileChunkReq &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self, builder);
+}
+void FileChunkReq::Load(FileChunkReq *self, memgraph::slk::Reader *reader) { memgraph::slk::Load(self, reader); }
+void FileChunkRes::Save(const FileChunkRes &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self, builder);
+}
+void FileChunkRes::Load(FileChunkRes *self, memgraph::slk::Reader *reader) { memgraph::slk::Load(self, reader); }
 }  // namespace storage::replication
 
 constexpr utils::TypeInfo storage::replication::AppendDeltasReq::kType{utils::TypeId::REP_APPEND_DELTAS_REQ,
@@ -117,6 +125,12 @@ constexpr utils::TypeInfo storage::replication::ForceResetStorageReq::kType{util
 constexpr utils::TypeInfo storage::replication::ForceResetStorageRes::kType{utils::TypeId::REP_FORCE_RESET_STORAGE_RES,
                                                                             "ForceResetStorageRes", nullptr};
 
+constexpr utils::TypeInfo storage::replication::FileChunkReq::kType{utils::TypeId::REP_FILE_CHUNK_REQ, "FileChunkReq",
+                                                                    nullptr};
+
+constexpr utils::TypeInfo storage::replication::FileChunkRes::kType{utils::TypeId::REP_FILE_CHUNK_RES, "FileChunkRes",
+                                                                    nullptr};
+
 // Autogenerated SLK serialization code
 namespace slk {
 // Serialize code for TimestampRes
@@ -299,6 +313,38 @@ void Load(memgraph::storage::replication::ForceResetStorageRes *self, memgraph::
   memgraph::slk::Load(&self->current_commit_timestamp, reader);
 }
 
+// Serialize code for FileChunkReq
+
+void Save(const memgraph::storage::replication::FileChunkReq &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self.main_uuid, builder);
+  memgraph::slk::Save(self.uuid, builder);
+  memgraph::slk::Save(self.filename, builder);
+  memgraph::slk::Save(self.file_size, builder);
+  memgraph::slk::Save(self.offset, builder);
+  memgraph::slk::Save(self.size, builder);
+}
+
+void Load(memgraph::storage::replication::FileChunkReq *self, memgraph::slk::Reader *reader) {
+  memgraph::slk::Load(&self->main_uuid, reader);
+  memgraph::slk::Load(&self->uuid, reader);
+  memgraph::slk::Load(&self->filename, reader);
+  memgraph::slk::Load(&self->file_size, reader);
+  memgraph::slk::Load(&self->offset, reader);
+  memgraph::slk::Load(&self->size, reader);
+}
+
+// Serialize code for FileChunkRes
+
+void Save(const memgraph::storage::replication::FileChunkRes &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self.success, builder);
+  memgraph::slk::Save(self.offset, builder);
+}
+
+void Load(memgraph::storage::replication::FileChunkRes *self, memgraph::slk::Reader *reader) {
+  memgraph::slk::Load(&self->success, reader);
+  memgraph::slk::Load(&self->offset, reader);
+}
+
 // Serialize SalientConfig
 
 void Save(const memgraph::storage::SalientConfig &self, memgraph::slk::Builder *builder) {
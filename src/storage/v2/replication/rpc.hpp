@@ -240,6 +240,48 @@ struct ForceResetStorageRes {
 
 using ForceResetStorageRpc = rpc::RequestResponse<ForceResetStorageReq, ForceResetStorageRes>;
 
+// Followed by `size` bytes of the file starting at `offset` and their checksum.
+// A chunk of size 0 only asks how much of the file the replica already has.
+struct FileChunkReq {
+  static const utils::TypeInfo kType;
+  static const utils::TypeInfo &GetTypeInfo() { return kType; }
+
+  static void Load(FileChunkReq *self, memgraph::slk::Reader *reader);
+  static void Save(const FileChunkReq &self, memgraph::slk::Builder *builder);
+  FileChunkReq() = default;
+  FileChunkReq(const utils::UUID &main_uuid, const utils::UUID &uuid, std::string filename, uint64_t file_size,
+               uint64_t offset, uint64_t size)
+      : main_uuid{main_uuid},
+        uuid{uuid},
+        filename{std::move(filename)},
+        file_size{file_size},
+        offset{offset},
+        size{size} {}
+
+  utils::UUID main_uuid;
+  utils::UUID uuid;
+  std::string filename;
+  uint64_t file_size;
+  uint64_t offset;
+  uint64_t size;
+};
+
+struct FileChunkRes {
+  static const utils::TypeInfo kType;
+  static const utils::TypeInfo &GetTypeInfo() { return kType; }
+
+  static void Load(FileChunkRes *self, memgraph::slk::Reader *reader);
+  static void Save(const FileChunkRes &self, memgraph::slk::Builder *builder);
+  FileChunkRes() = default;
+  FileChunkRes(bool success, uint64_t offset) : success(success), offset(offset) {}
+
+  bool success;
+  // How much of the file the replica has stored, the next chunk should start here
+  uint64_t offset;
+};
+
+using FileChunkRpc = rpc::RequestResponse<FileChunkReq, FileChunkRes>;
+
 }  // namespace memgraph::storage::replication
 
 // SLK serialization declarations
@@ -305,4 +347,12 @@ void Save(const memgraph::storage::replication::ForceResetStorageRes &self, memg
 
 void Load(memgraph::storage::replication::ForceResetStorageRes *self, memgraph::slk::Reader *reader);
 
+void Save(const memgraph::storage::replication::FileChunkReq &self, memgraph::slk::Builder *builder);
+
+void Load(memgraph::storage::replication::FileChunkReq *self, memgraph::slk::Reader *reader);
+
+void Save(const memgraph::storage::replication::FileChunkRes &self, memgraph::slk::Builder *builder);
+
+void Load(memgraph::storage::replication::FileChunkRes *self, memgraph::slk::Reader *reader);
+
 }  // namespace memgraph::slk
@@ -11,7 +11,64 @@
 
 #include "storage/v2/replication/serialization.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <zlib.h>
+
 namespace memgraph::storage::replication {
+
+namespace {
+// Read-only mapping of a part of a file. File data is copied from it straight
+// into the SLK segments instead of going through the file buffer and a stack
+// buffer first.
+class MappedFileRange {
+ public:
+  MappedFileRange(const std::filesystem::path &path, uint64_t offset, uint64_t size) {
+    if (size == 0) return;
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) return;
+    // The mapping has to start at a page boundary
+    static const auto page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    const auto aligned_offset = offset - (offset % page_size);
+    mapping_size_ = size + (offset - aligned_offset);
+    auto *mapping = mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(aligned_offset));
+    close(fd);
+    if (mapping == MAP_FAILED) return;
+    madvise(mapping, mapping_size_, MADV_SEQUENTIAL);
+    mapping_ = mapping;
+    data_ = static_cast<const uint8_t *>(mapping) + (offset - aligned_offset);
+  }
+
+  ~MappedFileRange() {
+    if (mapping_) munmap(mapping_, mapping_size_);
+  }
+
+  MappedFileRange(const MappedFileRange &) = delete;
+  MappedFileRange(MappedFileRange &&) = delete;
+  MappedFileRange &operator=(const MappedFileRange &) = delete;
+  MappedFileRange &operator=(MappedFileRange &&) = delete;
+
+  /// nullptr if the range couldn't be mapped
+  const uint8_t *data() const { return data_; }
+
+ private:
+  void *mapping_{nullptr};
+  size_t mapping_size_{0};
+  const uint8_t *data_{nullptr};
+};
+
+uint32_t InitialChecksum() { return crc32_z(0L, Z_NULL, 0); }
+
+uint32_t UpdateChecksum(uint32_t checksum, const uint8_t *data, size_t size) {
+  return crc32_z(checksum, data, size);
+}
+}  // namespace
+
+std::filesystem::path StagedFilePath(const std::filesystem::path &staging_directory, std::string_view filename) {
+  return staging_directory / (std::string{filename} + ".part");
+}
+
 ////// Encoder //////
 void Encoder::WriteMarker(durability::Marker marker) { slk::Save(marker, builder_); }
 
@@ -58,13 +115,36 @@ void Encoder::WritePropertyValue(const PropertyValue &value) {
 void Encoder::WriteBuffer(const uint8_t *buffer, const size_t buffer_size) { builder_->Save(buffer, buffer_size); }
 
 void Encoder::WriteFileData(utils::InputFile *file) {
-  auto file_size = file->GetSize();
+  const auto position = file->GetPosition();
+  WriteFileData(file, file->GetSize() - position, nullptr);
+}
+
+void Encoder::WriteFileData(const std::filesystem::path &path, uint64_t offset, uint64_t size) {
+  utils::InputFile file;
+  MG_ASSERT(file.Open(path), "Failed to open file {}", path);
+  MG_ASSERT(file.SetPosition(utils::InputFile::Position::SET, static_cast<ssize_t>(offset)),
+            "Failed to seek to {} in file {}", offset, path);
+  WriteFileData(&file, size, nullptr);
+  file.Close();
+}
+
+void Encoder::WriteFileData(utils::InputFile *file, uint64_t size, uint32_t *checksum) {
+  const auto position = file->GetPosition();
+  if (const MappedFileRange mapping(file->path(), position, size); mapping.data()) {
+    if (checksum) *checksum = UpdateChecksum(*checksum, mapping.data(), size);
+    WriteBuffer(mapping.data(), size);
+    file->SetPosition(utils::InputFile::Position::RELATIVE_TO_CURRENT, static_cast<ssize_t>(size));
+    return;
+  }
+
+  // The file couldn't be mapped, copy it through a buffer instead
   uint8_t buffer[utils::kFileBufferSize];
-  while (file_size > 0) {
-    const auto chunk_size = std::min(file_size, utils::kFileBufferSize);
+  while (size > 0) {
+    const auto chunk_size = std::min(size, utils::kFileBufferSize);
     file->Read(buffer, chunk_size);
+    if (checksum) *checksum = UpdateChecksum(*checksum, buffer, chunk_size);
     WriteBuffer(buffer, chunk_size);
-    file_size -= chunk_size;
+    size -= chunk_size;
   }
 }
 
@@ -76,10 +156,29 @@ void Encoder::WriteFile(const std::filesystem::path &path) {
   WriteString(filename);
   auto file_size = file.GetSize();
   WriteUint(file_size);
+  WriteBool(false);
   WriteFileData(&file);
   file.Close();
 }
 
+void Encoder::WriteStagedFile(const std::filesystem::path &path) {
+  MG_ASSERT(path.has_filename(), "Path does not have a filename!");
+  WriteString(path.filename().generic_string());
+  WriteUint(std::filesystem::file_size(path));
+  WriteBool(true);
+}
+
+void Encoder::WriteFileChunk(const std::filesystem::path &path, uint64_t offset, uint64_t size) {
+  utils::InputFile file;
+  MG_ASSERT(file.Open(path), "Failed to open file {}", path);
+  MG_ASSERT(file.SetPosition(utils::InputFile::Position::SET, static_cast<ssize_t>(offset)),
+            "Failed to seek to {} in file {}", offset, path);
+  auto checksum = InitialChecksum();
+  WriteFileData(&file, size, &checksum);
+  WriteUint(checksum);
+  file.Close();
+}
+
 ////// Decoder //////
 std::optional<durability::Marker> Decoder::ReadMarker() {
   durability::Marker marker;
@@ -168,10 +267,35 @@ std::optional<std::filesystem::path> Decoder::ReadFile(const std::filesystem::pa
   const auto filename = *maybe_filename + suffix;
   auto path = directory / filename;
 
-  file.Open(path, utils::OutputFile::Mode::OVERWRITE_EXISTING);
   std::optional<size_t> maybe_file_size = ReadUint();
   MG_ASSERT(maybe_file_size, "File size missing");
   auto file_size = *maybe_file_size;
+  const auto maybe_staged = ReadBool();
+  MG_ASSERT(maybe_staged, "File staging flag missing");
+  if (*maybe_staged) {
+    if (staging_directory_.empty()) {
+      spdlog::error("Received staged file {} without a staging directory", *maybe_filename);
+      return std::nullopt;
+    }
+    const auto staged_path = StagedFilePath(staging_directory_, *maybe_filename);
+    std::error_code error_code;  // For exception suppression.
+    if (std::filesystem::file_size(staged_path, error_code) != file_size || error_code) {
+      spdlog::error("Staged file {} is missing or incomplete", staged_path);
+      return std::nullopt;
+    }
+    if (!utils::RenamePath(staged_path, path)) {
+      // The staging directory can be on another file system
+      if (!std::filesystem::copy_file(staged_path, path, std::filesystem::copy_options::overwrite_existing,
+                                      error_code)) {
+        spdlog::error("Failed to move staged file {} to {}", staged_path, path);
+        return std::nullopt;
+      }
+      utils::DeleteFile(staged_path);
+    }
+    return std::move(path);
+  }
+
+  file.Open(path, utils::OutputFile::Mode::OVERWRITE_EXISTING);
   uint8_t buffer[utils::kFileBufferSize];
   while (file_size > 0) {
     const auto chunk_size = std::min(file_size, utils::kFileBufferSize);
@@ -182,4 +306,58 @@ std::optional<std::filesystem::path> Decoder::ReadFile(const std::filesystem::pa
   file.Close();
   return std::move(path);
 }
+
+void Decoder::SkipFile() {
+  MG_ASSERT(SkipString(), "Filename missing for the file");
+  const auto maybe_file_size = ReadUint();
+  MG_ASSERT(maybe_file_size, "File size missing");
+  const auto maybe_staged = ReadBool();
+  MG_ASSERT(maybe_staged, "File staging flag missing");
+  if (*maybe_staged) return;
+
+  auto file_size = *maybe_file_size;
+  uint8_t buffer[utils::kFileBufferSize];
+  while (file_size > 0) {
+    const auto chunk_size = std::min(file_size, utils::kFileBufferSize);
+    reader_->Load(buffer, chunk_size);
+    file_size -= chunk_size;
+  }
+}
+
+uint64_t Decoder::ReadFileChunk(const std::filesystem::path &path, uint64_t offset, uint64_t size) {
+  std::error_code error_code;  // For exception suppression.
+  uint64_t staged_size = std::filesystem::file_size(path, error_code);
+  if (error_code) staged_size = 0;
+
+  // Chunks that don't continue the staged file are still read out of the stream
+  const bool append = staged_size == offset;
+  utils::OutputFile file;
+  if (append) file.Open(path, utils::OutputFile::Mode::APPEND_TO_EXISTING);
+  auto checksum = InitialChecksum();
+  uint8_t buffer[utils::kFileBufferSize];
+  while (size > 0) {
+    const auto chunk_size = std::min(size, utils::kFileBufferSize);
+    reader_->Load(buffer, chunk_size);
+    checksum = UpdateChecksum(checksum, buffer, chunk_size);
+    if (append) file.Write(buffer, chunk_size);
+    size -= chunk_size;
+  }
+  const auto maybe_checksum = ReadUint();
+  MG_ASSERT(maybe_checksum, "Checksum missing for the file chunk");
+  if (!append) return staged_size;
+
+  file.Sync();
+  const auto new_size = file.GetSize();
+  file.Close();
+  if (*maybe_checksum != checksum) {
+    spdlog::warn("Checksum mismatch for the chunk at offset {} of {}, dropping the chunk", offset, path);
+    std::filesystem::resize_file(path, offset, error_code);
+    if (error_code) {
+      utils::DeleteFile(path);
+      return 0;
+    }
+    return offset;
+  }
+  return new_size;
+}
 }  // namespace memgraph::storage::replication
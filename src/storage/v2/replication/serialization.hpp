@@ -21,6 +21,20 @@
 
 namespace memgraph::storage::replication {
 
+/// Files larger than this are not sent inline with `SnapshotRpc`/`WalFilesRpc`.
+/// They are first staged on the replica through `FileChunkRpc`, one checksummed
+/// chunk at a time, so an interrupted transfer resumes from the last chunk the
+/// replica stored instead of starting over.
+inline constexpr uint64_t kFileChunkSize = 64ULL * 1024 * 1024;
+
+/// The end of a staged snapshot, starting with its indices section, is staged
+/// first under the snapshot's filename with this suffix. Everything before it
+/// can then be loaded on the replica while it's still being received.
+inline constexpr std::string_view kStagedTailSuffix{".tail"};
+
+/// Path of the partially received `filename` inside the staging directory.
+std::filesystem::path StagedFilePath(const std::filesystem::path &staging_directory, std::string_view filename);
+
 class Encoder final : public durability::BaseEncoder {
  public:
   explicit Encoder(slk::Builder *builder) : builder_(builder) {}
@@ -47,15 +61,32 @@ class Encoder final : public durability::BaseEncoder {
 
   void WriteFileData(utils::InputFile *file);
 
+  /// Writes `size` bytes of the file starting at `offset`. The data is copied
+  /// into the SLK segments straight from a read-only mapping of the file.
+  void WriteFileData(const std::filesystem::path &path, uint64_t offset, uint64_t size);
+
   void WriteFile(const std::filesystem::path &path);
 
+  /// Writes only the header of a file whose data was already staged on the
+  /// replica with `WriteFileChunk`.
+  void WriteStagedFile(const std::filesystem::path &path);
+
+  /// Writes `size` bytes of the file starting at `offset`, followed by their
+  /// CRC32.
+  void WriteFileChunk(const std::filesystem::path &path, uint64_t offset, uint64_t size);
+
  private:
+  // Writes `size` bytes from the current position of the file, updating the
+  // checksum if one is passed.
+  void WriteFileData(utils::InputFile *file, uint64_t size, uint32_t *checksum);
+
   slk::Builder *builder_;
 };
 
 class Decoder final : public durability::BaseDecoder {
  public:
-  explicit Decoder(slk::Reader *reader) : reader_(reader) {}
+  explicit Decoder(slk::Reader *reader, std::filesystem::path staging_directory = {})
+      : reader_(reader), staging_directory_(std::move(staging_directory)) {}
 
   std::optional<durability::Marker> ReadMarker() override;
 
@@ -79,14 +110,25 @@ class Decoder final : public durability::BaseDecoder {
 
   bool SkipPropertyValue() override;
 
-  /// Read the file and save it inside the specified directory.
+  /// Read the file and save it inside the specified directory. Staged files
+  /// are moved there from the staging directory.
   /// @param directory Directory which will contain the read file.
   /// @param suffix Suffix to be added to the received file's filename.
   /// @return If the read was successful, path to the read file.
   std::optional<std::filesystem::path> ReadFile(const std::filesystem::path &directory, const std::string &suffix = "");
 
+  /// Read the file like `ReadFile` without saving it.
+  void SkipFile();
+
+  /// Read a chunk written by `WriteFileChunk` and append it to the staged file
+  /// at `path`. The chunk is dropped if it doesn't start where the staged file
+  /// ends or if its checksum doesn't match.
+  /// @return Size of the staged file after the chunk was handled.
+  uint64_t ReadFileChunk(const std::filesystem::path &path, uint64_t offset, uint64_t size);
+
  private:
   slk::Reader *reader_;
+  std::filesystem::path staging_directory_;
 };
 
 }  // namespace memgraph::storage::replication
@@ -9,9 +9,11 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
 #include <mutex>
 #include <shared_mutex>
 #include <tuple>
+#include <unordered_map>
 
 #include "spdlog/spdlog.h"
 
@@ -29,6 +31,7 @@
 #include "utils/event_gauge.hpp"
 #include "utils/event_histogram.hpp"
 #include "utils/logging.hpp"
+#include "utils/memory_tracker.hpp"
 #include "utils/small_vector.hpp"
 #include "utils/variant_helpers.hpp"
 
@@ -156,6 +159,75 @@ void Storage::Accessor::AdvanceCommand() {
   transaction_.point_index_ctx_.AdvanceCommand(transaction_.point_index_change_collector_);
 }
 
+namespace {
+GraphProjection BuildGraphProjection(Storage::Accessor &accessor, const GraphProjectionSpec &spec, View view) {
+  GraphProjection projection;
+
+  // First pass assigns dense indices, so that edges can be stored by the index
+  // of their destination in the second pass.
+  std::vector<VertexAccessor> vertices;
+  std::unordered_map<Gid, size_t> dense_index;
+  for (auto vertex : accessor.Vertices(view)) {
+    if (!spec.labels.empty()) {
+      const auto has_any_label = std::ranges::any_of(spec.labels, [&](LabelId label) {
+        const auto has_label = vertex.HasLabel(label, view);
+        return has_label.HasValue() && *has_label;
+      });
+      if (!has_any_label) continue;
+    }
+    dense_index.emplace(vertex.Gid(), vertices.size());
+    projection.vertex_ids.push_back(vertex.Gid().AsInt());
+    vertices.push_back(vertex);
+  }
+
+  projection.offsets.reserve(vertices.size() + 1);
+  projection.offsets.push_back(0);
+  for (const auto &vertex : vertices) {
+    auto out_edges = vertex.OutEdges(view, spec.edge_types);
+    if (out_edges.HasValue()) {
+      for (const auto &edge : out_edges->edges) {
+        const auto target = dense_index.find(edge.ToVertex().Gid());
+        if (target == dense_index.end()) continue;
+        projection.targets.push_back(target->second);
+        projection.edge_ids.push_back(edge.Gid().AsInt());
+        projection.edge_types.push_back(edge.EdgeType());
+        if (spec.weight_property) {
+          const auto weight = edge.GetProperty(*spec.weight_property, view);
+          if (weight.HasValue() && weight->IsInt()) {
+            projection.weights.push_back(static_cast<double>(weight->ValueInt()));
+          } else if (weight.HasValue() && weight->IsDouble()) {
+            projection.weights.push_back(weight->ValueDouble());
+          } else {
+            projection.weights.push_back(1.0);
+          }
+        }
+      }
+    }
+    projection.offsets.push_back(projection.targets.size());
+  }
+  return projection;
+}
+}  // namespace
+
+std::shared_ptr<const GraphProjection> Storage::Accessor::Projection(const GraphProjectionSpec &spec, View view) {
+  auto build = [&] {
+    // Projections are as large as the part of the graph they cover, they have to respect the memory limit
+    utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+    return BuildGraphProjection(*this, spec, view);
+  };
+  // Only a snapshot isolated transaction without its own changes sees exactly
+  // the state identified by the last commit timestamp. Analytical writes don't
+  // advance that timestamp, so they never use the cache.
+  const bool cacheable = transaction_.storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL &&
+                         transaction_.last_commit_timestamp.has_value() &&
+                         transaction_.isolation_level == IsolationLevel::SNAPSHOT_ISOLATION &&
+                         transaction_.deltas.empty();
+  if (!cacheable) {
+    return std::make_shared<const GraphProjection>(build());
+  }
+  return storage_->graph_projection_cache_.GetOrBuild(spec, *transaction_.last_commit_timestamp, build);
+}
+
 Result<std::optional<VertexAccessor>> Storage::Accessor::DeleteVertex(VertexAccessor *vertex) {
   /// NOTE: Checking whether the vertex can be deleted must be done by loading edges from disk.
   /// Loading edges is done through VertexAccessor so we do it here.
@@ -510,6 +582,8 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
           auto const edge_gid = storage_->config_.salient.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
           return !set_for_erasure.contains(edge_gid);
         });
+    // Partitioning doesn't keep the relative order of the kept edges
+    (reverse_vertex_order ? vertex_ptr->in_edges_unsorted : vertex_ptr->out_edges_unsorted) = kAdjacencyUnsorted;
 
     // Creating deltas and erasing edge only at the end -> we might have incomplete state as
     // delta might cause OOM, so we don't remove edges from edges_attached_to_vertex
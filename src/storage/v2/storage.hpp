@@ -34,6 +34,7 @@
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/edges_iterable.hpp"
 #include "storage/v2/enum_store.hpp"
+#include "storage/v2/graph_projection.hpp"
 #include "storage/v2/indices/indices.hpp"
 #include "storage/v2/indices/point_index.hpp"
 #include "storage/v2/mvcc.hpp"
@@ -72,6 +73,8 @@ class EdgeAccessor;
 struct IndicesInfo {
   std::vector<LabelId> label;
   std::vector<std::pair<LabelId, PropertyId>> label_property;
+  // Subset of `label_property` which was created with a hash lookup
+  std::vector<std::pair<LabelId, PropertyId>> label_property_hash;
   std::vector<EdgeTypeId> edge_type;
   std::vector<std::pair<EdgeTypeId, PropertyId>> edge_type_property;
   std::vector<std::pair<std::string, LabelId>> text_indices;
@@ -283,6 +286,8 @@ class Storage {
 
     virtual bool LabelPropertyIndexExists(LabelId label, PropertyId property) const = 0;
 
+    virtual bool LabelPropertyHashIndexExists(LabelId label, PropertyId property) const = 0;
+
     virtual bool EdgeTypeIndexExists(EdgeTypeId edge_type) const = 0;
 
     virtual bool EdgeTypePropertyIndexExists(EdgeTypeId edge_type, PropertyId property) const = 0;
@@ -360,6 +365,11 @@ class Storage {
 
     virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(LabelId label, PropertyId property) = 0;
 
+    /// Creates a label-property index which additionally answers equality
+    /// lookups with a hash probe. It is dropped with `DropIndex(label, property)`.
+    virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateHashIndex(LabelId label,
+                                                                                  PropertyId property) = 0;
+
     virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(EdgeTypeId edge_type,
                                                                               bool unique_access_needed = true) = 0;
 
@@ -405,6 +415,11 @@ class Storage {
 
     virtual void DropGraph() = 0;
 
+    /// Returns a CSR projection of the graph visible to this transaction.
+    /// Projections are shared through the storage-wide cache when the
+    /// transaction's view of the graph is identified by a commit timestamp.
+    std::shared_ptr<const GraphProjection> Projection(const GraphProjectionSpec &spec, View view);
+
     auto GetTransaction() -> Transaction * { return std::addressof(transaction_); }
 
     auto GetEnumStoreUnique() -> EnumStore & {
@@ -607,6 +622,8 @@ class Storage {
   EnumStore enum_store_;
 
   SchemaInfo schema_info_;
+
+  GraphProjectionCache graph_projection_cache_;
 };
 
 }  // namespace memgraph::storage
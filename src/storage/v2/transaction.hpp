@@ -114,6 +114,11 @@ struct Transaction {
   // pointer must stay valid after the `Transaction` is moved into
   // `commited_transactions_` list for GC.
   std::unique_ptr<std::atomic<uint64_t>> commit_timestamp{};
+  // The commit timestamp of the last transaction committed before this one
+  // started. Together with snapshot isolation it identifies the state of the
+  // graph visible to the transaction, as long as it made no changes itself.
+  // Not set by storages that can't guarantee that.
+  std::optional<uint64_t> last_commit_timestamp{};
   uint64_t command_id{};
 
   delta_container deltas;
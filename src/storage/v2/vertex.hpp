@@ -12,7 +12,9 @@
 #pragma once
 
 #include <alloca.h>
+#include <algorithm>
 #include <boost/container_hash/hash_fwd.hpp>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <limits>
@@ -28,6 +30,9 @@
 
 namespace memgraph::storage {
 
+/// Unsorted tail length of adjacency lists whose order isn't known.
+inline constexpr uint8_t kAdjacencyUnsorted = std::numeric_limits<uint8_t>::max();
+
 struct Vertex {
   Vertex(Gid gid, Delta *delta) : gid(gid), deleted(false), delta(delta) {
     MG_ASSERT(delta == nullptr || delta->action == Delta::Action::DELETE_OBJECT ||
@@ -45,8 +50,11 @@ struct Vertex {
   PropertyStore properties;
   mutable utils::RWSpinLock lock;
   bool deleted;
+  // Number of edges appended after the part ordered with `AdjacentVertexLess`,
+  // `kAdjacencyUnsorted` when the edges aren't known to be ordered at all
+  uint8_t in_edges_unsorted{kAdjacencyUnsorted};
+  uint8_t out_edges_unsorted{kAdjacencyUnsorted};
   // uint8_t PAD;
-  // uint16_t PAD;
 
   Delta *delta;
 };
@@ -59,4 +67,63 @@ inline bool operator<(const Vertex &first, const Vertex &second) { return first.
 inline bool operator==(const Vertex &first, const Gid &second) { return first.gid == second; }
 inline bool operator<(const Vertex &first, const Gid &second) { return first.gid < second; }
 
+/// Orders adjacency entries by the address of the adjacent vertex, so that
+/// comparing doesn't have to touch the adjacent vertices.
+struct AdjacentVertexLess {
+  using Entry = std::tuple<EdgeTypeId, Vertex *, EdgeRef>;
+
+  bool operator()(const Entry &first, const Entry &second) const {
+    return std::less<const Vertex *>{}(std::get<1>(first), std::get<1>(second));
+  }
+  bool operator()(const Entry &first, const Vertex *second) const {
+    return std::less<const Vertex *>{}(std::get<1>(first), second);
+  }
+  bool operator()(const Vertex *first, const Entry &second) const {
+    return std::less<const Vertex *>{}(first, std::get<1>(second));
+  }
+};
+
+/// Smaller adjacency lists are cheaper to scan than to keep sorted.
+inline constexpr size_t kSortedAdjacencyMinDegree = 128;
+
+/// Longest unsorted tail that lookups scan instead of having it merged.
+inline constexpr uint8_t kAdjacencyMaxUnsortedTail = 64;
+
+/// Records an edge appended to an adjacency list, an overflowing count marks
+/// the list as unsorted.
+inline void AdjacencyAppended(uint8_t &unsorted) {
+  if (unsorted != kAdjacencyUnsorted) ++unsorted;
+}
+
+/// Whether `SortAdjacency` has anything to do for the vertex.
+inline bool NeedsAdjacencySort(const Vertex &vertex) {
+  auto needs_sort = [](const auto &edges, uint8_t unsorted) {
+    return unsorted > kAdjacencyMaxUnsortedTail && edges.size() >= kSortedAdjacencyMinDegree;
+  };
+  return needs_sort(vertex.in_edges, vertex.in_edges_unsorted) ||
+         needs_sort(vertex.out_edges, vertex.out_edges_unsorted);
+}
+
+/// Sorts the adjacency lists of a high degree vertex so that edges to a given
+/// vertex can be found with a binary search over the ordered part and a scan
+/// of the short unsorted tail. Tails longer than `kAdjacencyMaxUnsortedTail`
+/// are sorted and merged into the ordered part.
+/// The caller must hold the vertex lock exclusively, unless no other
+/// transaction can access the vertex.
+inline void SortAdjacency(Vertex &vertex) {
+  auto sort = [](auto &edges, uint8_t &unsorted) {
+    if (unsorted <= kAdjacencyMaxUnsortedTail || edges.size() < kSortedAdjacencyMinDegree) return;
+    if (unsorted == kAdjacencyUnsorted) {
+      std::sort(edges.begin(), edges.end(), AdjacentVertexLess{});
+    } else {
+      auto tail = edges.end() - unsorted;
+      std::sort(tail, edges.end(), AdjacentVertexLess{});
+      std::inplace_merge(edges.begin(), tail, edges.end(), AdjacentVertexLess{});
+    }
+    unsorted = 0;
+  };
+  sort(vertex.in_edges, vertex.in_edges_unsorted);
+  sort(vertex.out_edges, vertex.out_edges_unsorted);
+}
+
 }  // namespace memgraph::storage
@@ -1037,6 +1037,24 @@ int64_t VertexAccessor::HandleExpansionsWithEdgeTypes(edge_store &result_edges,
                                                       EdgeDirection direction) const {
   int64_t expanded_count = 0;
   const auto &edges = direction == EdgeDirection::IN ? vertex_->in_edges : vertex_->out_edges;
+  const auto unsorted = direction == EdgeDirection::IN ? vertex_->in_edges_unsorted : vertex_->out_edges_unsorted;
+  if (destination && unsorted != kAdjacencyUnsorted && !(hops_limit && hops_limit->IsUsed())) {
+    // Only the edges to the destination have to be looked at, they are found
+    // with a binary search of the ordered part and a scan of the unsorted tail
+    auto add_edge = [&](const auto &entry) {
+      const auto &[edge_type, vertex, edge] = entry;
+      expanded_count++;
+      if (!edge_types.empty() && std::find(edge_types.begin(), edge_types.end(), edge_type) == edge_types.end()) return;
+      result_edges.emplace_back(edge_type, vertex, edge);
+    };
+    const auto tail = edges.end() - unsorted;
+    const auto [first, last] = std::equal_range(edges.begin(), tail, destination->vertex_, AdjacentVertexLess{});
+    std::for_each(first, last, add_edge);
+    for (auto it = tail; it != edges.end(); ++it) {
+      if (std::get<1>(*it) == destination->vertex_) add_edge(*it);
+    }
+    return expanded_count;
+  }
   for (const auto &[edge_type, vertex, edge] : edges) {
     if (hops_limit && hops_limit->IsUsed()) {
       hops_limit->IncrementHopsCount(1);
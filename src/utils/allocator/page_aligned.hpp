@@ -15,9 +15,12 @@
 #include <cstddef>
 #include <new>
 
+#include "utils/allocator/page_pool.hpp"
+
 namespace memgraph::utils {
 
 // custom allocator, ensures all allocations are page aligned
+// blocks are recycled through the `PagePool` instead of going back to the global allocator
 template <typename T>
 struct PageAlignedAllocator {
   static constexpr std::size_t PAGE_SIZE = 4096;
@@ -28,18 +31,18 @@ struct PageAlignedAllocator {
   template <class U>
   explicit PageAlignedAllocator(const PageAlignedAllocator<U> &) noexcept {}
 
-  auto allocate(std::size_t n) -> T * {
-    auto size = std::max(n * sizeof(T), PAGE_SIZE);
-    // Round up to the nearest multiple of PAGE_SIZE
-    size = ((size + PAGE_SIZE - 1) / PAGE_SIZE) * PAGE_SIZE;
-    // we must use new/delete as it will correctly throw appropriate exception
-    void *ptr = operator new (size, std::align_val_t{PAGE_SIZE});
-    return static_cast<T *>(ptr);
-  }
+  auto allocate(std::size_t n) -> T * { return static_cast<T *>(PagePool::Global().Allocate(RoundUpToPages(n))); }
 
-  void deallocate(T *p, std::size_t) const noexcept { operator delete (p, std::align_val_t{PAGE_SIZE}); }
+  void deallocate(T *p, std::size_t n) const noexcept { PagePool::Global().Deallocate(p, RoundUpToPages(n)); }
 
   constexpr friend bool operator==(PageAlignedAllocator const &, PageAlignedAllocator const &) noexcept { return true; }
+
+ private:
+  static constexpr auto RoundUpToPages(std::size_t n) -> std::size_t {
+    auto size = std::max(n * sizeof(T), PAGE_SIZE);
+    // Round up to the nearest multiple of PAGE_SIZE
+    return ((size + PAGE_SIZE - 1) / PAGE_SIZE) * PAGE_SIZE;
+  }
 };
 
 }  // namespace memgraph::utils
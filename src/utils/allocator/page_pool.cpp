@@ -0,0 +1,162 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "utils/allocator/page_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <new>
+
+namespace memgraph::utils {
+
+namespace {
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<uint64_t> next_pool_id{0};
+
+// Trivially destructible, so it can still be read after the thread's cache is destroyed
+thread_local bool thread_cache_destroyed{false};
+}  // namespace
+
+struct PagePool::ThreadCache {
+  ThreadCache() = default;
+  ThreadCache(const ThreadCache &) = delete;
+  ThreadCache &operator=(const ThreadCache &) = delete;
+  ThreadCache(ThreadCache &&) = delete;
+  ThreadCache &operator=(ThreadCache &&) = delete;
+
+  ~ThreadCache() {
+    Release();
+    thread_cache_destroyed = true;
+  }
+
+  // The pool might be gone already, but the blocks are plain aligned allocations
+  void Release() noexcept {
+    for (std::size_t i = 0; i < kMaxPagesPerBlock; ++i) {
+      for (std::size_t j = 0; j < counts[i]; ++j) operator delete(blocks[i][j], std::align_val_t{PAGE_SIZE});
+      counts[i] = 0;
+    }
+  }
+
+  uint64_t pool_id{std::numeric_limits<uint64_t>::max()};
+  std::array<std::array<void *, kThreadCacheBlocks>, kMaxPagesPerBlock> blocks{};
+  std::array<std::size_t, kMaxPagesPerBlock> counts{};
+};
+
+PagePool::PagePool() : id_{next_pool_id.fetch_add(1, std::memory_order_relaxed)} {}
+
+PagePool::~PagePool() {
+  for (auto &size_class : size_classes_) {
+    auto *block = size_class.head;
+    while (block) {
+      auto *next = block->next;
+      operator delete(block, std::align_val_t{PAGE_SIZE});
+      block = next;
+    }
+  }
+}
+
+auto PagePool::FindSizeClass(std::size_t size) -> SizeClass * {
+#ifndef MG_MEMORY_PROFILE
+  if (size == 0 || size % PAGE_SIZE != 0 || size / PAGE_SIZE > kMaxPagesPerBlock) return nullptr;
+  return &size_classes_[(size / PAGE_SIZE) - 1];
+#else
+  // Recycled blocks would hide use-after-free from the memory profilers
+  return nullptr;
+#endif
+}
+
+auto PagePool::LocalCache() const -> ThreadCache * {
+  if (thread_cache_destroyed) return nullptr;
+  thread_local ThreadCache cache;
+  if (cache.pool_id != id_) {
+    cache.Release();
+    cache.pool_id = id_;
+  }
+  return &cache;
+}
+
+std::size_t PagePool::TakeShared(SizeClass *size_class, void **blocks, std::size_t count) {
+  auto guard = std::lock_guard{size_class->lock};
+  std::size_t taken = 0;
+  for (; taken < count && size_class->head; ++taken) {
+    blocks[taken] = size_class->head;
+    size_class->head = size_class->head->next;
+    --size_class->count;
+  }
+  return taken;
+}
+
+void PagePool::PutShared(SizeClass *size_class, void *const *blocks, std::size_t count, std::size_t size) noexcept {
+  std::size_t kept = 0;
+  {
+    auto guard = std::lock_guard{size_class->lock};
+    for (; kept < count && (size_class->count + 1) * size <= kMaxCachedBytesPerSize; ++kept) {
+      size_class->head = new (blocks[kept]) FreeBlock{size_class->head};
+      ++size_class->count;
+    }
+  }
+  for (; kept < count; ++kept) operator delete(blocks[kept], std::align_val_t{PAGE_SIZE});
+}
+
+void *PagePool::Allocate(std::size_t size) {
+  if (auto *size_class = FindSizeClass(size)) {
+    if (auto *cache = LocalCache()) {
+      auto &blocks = cache->blocks[(size / PAGE_SIZE) - 1];
+      auto &count = cache->counts[(size / PAGE_SIZE) - 1];
+      if (count == 0) count = TakeShared(size_class, blocks.data(), kBatchSize);
+      if (count > 0) return blocks[--count];
+    } else {
+      void *block = nullptr;
+      if (TakeShared(size_class, &block, 1) == 1) return block;
+    }
+  }
+  // we must use new/delete as it will correctly throw appropriate exception
+  return operator new(size, std::align_val_t{PAGE_SIZE});
+}
+
+void PagePool::Deallocate(void *ptr, std::size_t size) noexcept {
+  if (auto *size_class = FindSizeClass(size)) {
+    if (auto *cache = LocalCache()) {
+      auto &blocks = cache->blocks[(size / PAGE_SIZE) - 1];
+      auto &count = cache->counts[(size / PAGE_SIZE) - 1];
+      if (count == kThreadCacheBlocks) {
+        // Keep the most recently released blocks, they are the likeliest to still be in the CPU cache
+        PutShared(size_class, blocks.data(), kBatchSize, size);
+        std::copy(blocks.begin() + kBatchSize, blocks.end(), blocks.begin());
+        count -= kBatchSize;
+      }
+      blocks[count++] = ptr;
+    } else {
+      PutShared(size_class, &ptr, 1, size);
+    }
+    return;
+  }
+  operator delete(ptr, std::align_val_t{PAGE_SIZE});
+}
+
+std::size_t PagePool::CachedBlocks(std::size_t size) const {
+  auto *size_class = const_cast<PagePool *>(this)->FindSizeClass(size);
+  if (!size_class) return 0;
+  std::size_t local = 0;
+  if (auto *cache = LocalCache()) local = cache->counts[(size / PAGE_SIZE) - 1];
+  auto guard = std::lock_guard{size_class->lock};
+  return local + size_class->count;
+}
+
+PagePool &PagePool::Global() {
+  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+  static auto *pool = new PagePool;
+  return *pool;
+}
+
+}  // namespace memgraph::utils
@@ -0,0 +1,99 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "utils/spin_lock.hpp"
+
+namespace memgraph::utils {
+
+/// Recycles page aligned blocks between transactions.
+///
+/// Every write transaction allocates its delta slabs and the pages of its
+/// `PageSlabMemoryResource`, which are all released together once GC is done
+/// with the transaction's deltas. Instead of returning them to the global
+/// allocator, the released blocks are kept here and handed to the next
+/// transactions, so short transactions don't hit malloc/free at all.
+///
+/// Blocks of up to `kMaxPagesPerBlock` pages are cached, separately for each
+/// size, up to `kMaxCachedBytesPerSize` bytes per size in the shared lists.
+/// Anything else goes straight to the global allocator.
+///
+/// Every thread keeps up to `kThreadCacheBlocks` blocks of each size for
+/// itself and only exchanges them with the shared lists `kBatchSize` at a
+/// time, so most allocations and releases don't take the shared lock. A
+/// thread's blocks are freed when it exits or starts using another pool.
+class PagePool {
+ public:
+  static constexpr std::size_t PAGE_SIZE = 4096;
+  static constexpr std::size_t kMaxPagesPerBlock = 4;
+  static constexpr std::size_t kMaxCachedBytesPerSize = 8UL * 1024UL * 1024UL;
+  static constexpr std::size_t kBatchSize = 16;
+  static constexpr std::size_t kThreadCacheBlocks = 2 * kBatchSize;
+
+  PagePool();
+  PagePool(const PagePool &) = delete;
+  PagePool &operator=(const PagePool &) = delete;
+  PagePool(PagePool &&) = delete;
+  PagePool &operator=(PagePool &&) = delete;
+  ~PagePool();
+
+  /// Allocates a `PAGE_SIZE` aligned block of `size` bytes.
+  /// @throw std::bad_alloc
+  void *Allocate(std::size_t size);
+
+  /// Releases a block returned by `Allocate` with the same `size`.
+  void Deallocate(void *ptr, std::size_t size) noexcept;
+
+  /// Number of blocks of the given size which are ready to be reused by the
+  /// calling thread, in its own cache and in the shared lists.
+  std::size_t CachedBlocks(std::size_t size) const;
+
+  /// The pool shared by all storages. It is never destroyed, so blocks can be
+  /// released during static destruction.
+  static PagePool &Global();
+
+ private:
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  struct SizeClass {
+    mutable SpinLock lock;
+    FreeBlock *head{nullptr};
+    std::size_t count{0};
+  };
+
+  struct ThreadCache;
+
+  SizeClass *FindSizeClass(std::size_t size);
+
+  /// The calling thread's blocks of this pool, nullptr once the thread is
+  /// exiting and its cache is gone.
+  ThreadCache *LocalCache() const;
+
+  /// Moves up to `count` blocks from the shared list to `blocks`.
+  /// @return the number of blocks moved
+  static std::size_t TakeShared(SizeClass *size_class, void **blocks, std::size_t count);
+
+  /// Moves `count` blocks to the shared list, those over its limit are freed.
+  static void PutShared(SizeClass *size_class, void *const *blocks, std::size_t count, std::size_t size) noexcept;
+
+  // Tells apart the thread caches of this pool from those of a destroyed pool at the same address
+  const uint64_t id_;
+  std::array<SizeClass, kMaxPagesPerBlock> size_classes_;
+};
+
+}  // namespace memgraph::utils
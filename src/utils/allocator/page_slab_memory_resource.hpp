@@ -15,6 +15,8 @@
 #include <cstdlib>
 #include <memory_resource>
 
+#include "utils/allocator/page_pool.hpp"
+
 namespace memgraph::utils {
 
 /// This is a monotonic allocator which:
@@ -23,7 +25,8 @@ namespace memgraph::utils {
 /// - allocations smaller than a page use remaining space in current slab
 /// - allocations larger than a page get their own allocations
 /// - deallocation is a noop
-/// - all memory released on destruction
+/// - all memory released on destruction, the slab pages are returned to the
+///   `PagePool` so the next transaction can reuse them
 struct PageSlabMemoryResource : std::pmr::memory_resource {
   static constexpr std::size_t PAGE_SIZE = 4096;
   PageSlabMemoryResource() = default;
@@ -46,16 +49,22 @@ struct PageSlabMemoryResource : std::pmr::memory_resource {
     auto current = pages;
     while (current) {
       auto next = current->next;
-      operator delete(current, current->alignment);
+      if (current->pooled) {
+        PagePool::Global().Deallocate(current, PAGE_SIZE);
+      } else {
+        operator delete(current, current->alignment);
+      }
       current = next;
     }
   }
 
  private:
   struct header {
-    explicit header(header *next, std::align_val_t alignment) : next(next), alignment{alignment} {}
+    explicit header(header *next, std::align_val_t alignment, bool pooled = false)
+        : next(next), alignment{alignment}, pooled{pooled} {}
     header *next = nullptr;
     std::align_val_t alignment;
+    bool pooled = false;
   };
 
   constexpr static size_t alignSize(size_t size, size_t alignment) { return (size + alignment - 1) & ~(alignment - 1); }
@@ -74,8 +83,8 @@ struct PageSlabMemoryResource : std::pmr::memory_resource {
 
     // 2. can it fit in existing slab?
     if (!std::align(alignment, bytes, ptr, space)) {
-      auto *newmem = reinterpret_cast<header *>(operator new (PAGE_SIZE, std::align_val_t{PAGE_SIZE}));
-      pages = std::construct_at<header>(newmem, pages, std::align_val_t{PAGE_SIZE});
+      auto *newmem = reinterpret_cast<header *>(PagePool::Global().Allocate(PAGE_SIZE));
+      pages = std::construct_at<header>(newmem, pages, std::align_val_t{PAGE_SIZE}, true);
       ptr = reinterpret_cast<std::byte *>(pages) + sizeof(header);
       space = PAGE_SIZE - sizeof(header);
       std::align(alignment, bytes, ptr, space);
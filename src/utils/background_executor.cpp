@@ -0,0 +1,187 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "utils/background_executor.hpp"
+
+#include <algorithm>
+#include <random>
+
+#include "utils/logging.hpp"
+#include "utils/thread.hpp"
+
+namespace memgraph::utils {
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+BackgroundExecutor global_background_executor;
+
+BackgroundExecutor::~BackgroundExecutor() { Shutdown(); }
+
+void BackgroundExecutor::Start(size_t workers, size_t io_limit) {
+  DMG_ASSERT(workers > 0, "Background executor needs at least one worker.");
+  auto lk = std::unique_lock{mutex_};
+  MG_ASSERT(workers_.empty(), "Background executor already running.");
+  io_limit_ = std::max<size_t>(io_limit, 1);
+  workers_.reserve(workers + 1);
+  for (size_t i = 0; i < workers; ++i) {
+    workers_.emplace_back([this](std::stop_token token) { WorkerLoop(std::move(token), false); });
+  }
+  workers_.emplace_back([this](std::stop_token token) { WorkerLoop(std::move(token), true); });
+}
+
+void BackgroundExecutor::Shutdown() {
+  std::vector<std::jthread> workers;
+  {
+    auto lk = std::unique_lock{mutex_};
+    workers.swap(workers_);
+  }
+  for (auto &worker : workers) {
+    worker.request_stop();
+  }
+  // jthread destructors join
+}
+
+bool BackgroundExecutor::IsRunning() const {
+  auto lk = std::unique_lock{mutex_};
+  return !workers_.empty();
+}
+
+BackgroundExecutor::TaskId BackgroundExecutor::Schedule(std::string name, std::chrono::milliseconds period,
+                                                        std::function<void()> f, TaskOptions options,
+                                                        std::optional<Clock::time_point> start_time) {
+  DMG_ASSERT(period > std::chrono::milliseconds(0), "Period is invalid. Expected > 0, got {}.", period.count());
+  const auto now = Clock::now();
+  auto first_execution = now;
+  if (start_time) {
+    // Custom start time; execute as soon as possible if it already passed
+    first_execution = std::max(*start_time, now);
+  } else {
+    thread_local std::mt19937 gen{std::random_device{}()};
+    std::uniform_int_distribution<std::chrono::milliseconds::rep> dist(1, period.count());
+    first_execution += std::chrono::milliseconds(dist(gen));
+  }
+
+  TaskId id = 0;
+  {
+    auto lk = std::unique_lock{mutex_};
+    id = next_id_++;
+    tasks_.emplace(id, Task{.name = std::move(name),
+                            .period = period,
+                            .f = std::move(f),
+                            .options = options,
+                            .start_time = start_time,
+                            .next_execution = first_execution});
+    ++generation_;
+  }
+  work_cv_.notify_all();
+  return id;
+}
+
+void BackgroundExecutor::Pause(TaskId id) {
+  auto lk = std::unique_lock{mutex_};
+  auto it = tasks_.find(id);
+  if (it != tasks_.end()) it->second.paused = true;
+}
+
+void BackgroundExecutor::Resume(TaskId id) {
+  {
+    auto lk = std::unique_lock{mutex_};
+    auto it = tasks_.find(id);
+    if (it == tasks_.end()) return;
+    it->second.paused = false;
+    ++generation_;
+  }
+  work_cv_.notify_all();
+}
+
+void BackgroundExecutor::Cancel(TaskId id) {
+  std::function<void()> f;
+  {
+    auto lk = std::unique_lock{mutex_};
+    auto it = tasks_.find(id);
+    if (it == tasks_.end()) return;
+    done_cv_.wait(lk, [&] { return !it->second.running; });
+    f = std::move(it->second.f);
+    tasks_.erase(it);
+  }
+  // The function (and whatever it captured) is destroyed outside of the lock
+}
+
+size_t BackgroundExecutor::TasksNum() const {
+  auto lk = std::unique_lock{mutex_};
+  return tasks_.size();
+}
+
+BackgroundExecutor::Task *BackgroundExecutor::PickTask(Clock::time_point now, bool high_priority_only,
+                                                       std::optional<Clock::time_point> *wake_up) {
+  Task *best = nullptr;
+  for (auto &[_, task] : tasks_) {
+    if (task.running || task.paused) continue;
+    if (high_priority_only && task.options.priority != TaskPriority::HIGH) continue;
+    if (task.next_execution > now) {
+      if (!*wake_up || task.next_execution < **wake_up) *wake_up = task.next_execution;
+      continue;
+    }
+    // Due but blocked by the I/O limit; a finishing task will wake the workers
+    if (task.options.io_heavy && io_running_ >= io_limit_) continue;
+    if (!best || task.options.priority < best->options.priority ||
+        (task.options.priority == best->options.priority && task.next_execution < best->next_execution)) {
+      best = &task;
+    }
+  }
+  return best;
+}
+
+void BackgroundExecutor::Reschedule(Task &task, Clock::time_point now) {
+  if (task.start_time) {
+    // Align with the start time
+    while (*task.start_time <= now) *task.start_time += task.period;
+    task.next_execution = *task.start_time;
+    return;
+  }
+  task.next_execution += task.period;
+  if (task.next_execution < now) {
+    task.next_execution = now;
+  }
+}
+
+void BackgroundExecutor::WorkerLoop(std::stop_token token, bool high_priority_only) {
+  utils::ThreadSetName("background");
+  auto lk = std::unique_lock{mutex_};
+  while (!token.stop_requested()) {
+    std::optional<Clock::time_point> wake_up;
+    auto *task = PickTask(Clock::now(), high_priority_only, &wake_up);
+    if (!task) {
+      const auto generation = generation_;
+      auto changed = [&] { return generation_ != generation; };
+      if (wake_up) {
+        work_cv_.wait_until(lk, token, *wake_up, changed);
+      } else {
+        work_cv_.wait(lk, token, changed);
+      }
+      continue;
+    }
+
+    task->running = true;
+    if (task->options.io_heavy) ++io_running_;
+    lk.unlock();
+    // Cancel waits for `running` to be cleared, so the task stays valid here
+    task->f();
+    lk.lock();
+    task->running = false;
+    if (task->options.io_heavy) --io_running_;
+    Reschedule(*task, Clock::now());
+    ++generation_;
+    work_cv_.notify_all();
+    done_cv_.notify_all();
+  }
+}
+
+}  // namespace memgraph::utils
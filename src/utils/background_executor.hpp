@@ -0,0 +1,129 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace memgraph::utils {
+
+/// When several tasks are due at the same time, the one with the higher
+/// priority is run first.
+enum class TaskPriority : uint8_t { HIGH, NORMAL, LOW };
+
+/**
+ * Fixed pool of threads running the periodic background work (GC, snapshots,
+ * TTL...) of every database in the process, instead of a dedicated thread per
+ * task and database.
+ *
+ * Due tasks are run by priority and then by how long they have been waiting.
+ * Besides the shared workers, one more worker only runs high priority tasks
+ * (GC), so that long snapshot or TTL runs can't hold them up.
+ * At most `io_limit` I/O-heavy tasks run at the same time. The first execution
+ * of a task without a start time is spread randomly over its first period, so
+ * tasks registered together don't keep running in lockstep.
+ */
+class BackgroundExecutor {
+ public:
+  using TaskId = uint64_t;
+
+  struct TaskOptions {
+    TaskPriority priority{TaskPriority::NORMAL};
+    bool io_heavy{false};
+  };
+
+  BackgroundExecutor() = default;
+  ~BackgroundExecutor();
+
+  BackgroundExecutor(const BackgroundExecutor &) = delete;
+  BackgroundExecutor(BackgroundExecutor &&) = delete;
+  BackgroundExecutor &operator=(const BackgroundExecutor &) = delete;
+  BackgroundExecutor &operator=(BackgroundExecutor &&) = delete;
+
+  /// Starts `workers` shared workers and the worker reserved for high
+  /// priority tasks.
+  /// @throw std::system_error if a thread could not be started.
+  void Start(size_t workers, size_t io_limit);
+
+  /// Stops the workers after their current tasks finish. Registered tasks are
+  /// kept and never run again.
+  void Shutdown();
+
+  bool IsRunning() const;
+
+  /**
+   * Registers `f` to be run every `period`. If the task is still running when
+   * it should be run again, it is run again as soon as possible after it
+   * finishes. With a `start_time` executions are aligned to it instead.
+   * @throw std::bad_alloc
+   */
+  TaskId Schedule(std::string name, std::chrono::milliseconds period, std::function<void()> f, TaskOptions options,
+                  std::optional<std::chrono::system_clock::time_point> start_time = {});
+
+  void Pause(TaskId id);
+  void Resume(TaskId id);
+
+  /// Unregisters the task, waiting for its current execution to finish. Must
+  /// not be called from the task itself.
+  void Cancel(TaskId id);
+
+  size_t TasksNum() const;
+
+ private:
+  using Clock = std::chrono::system_clock;
+
+  struct Task {
+    std::string name;
+    std::chrono::milliseconds period;
+    std::function<void()> f;
+    TaskOptions options;
+    std::optional<Clock::time_point> start_time;
+    Clock::time_point next_execution;
+    bool paused{false};
+    bool running{false};
+  };
+
+  void WorkerLoop(std::stop_token token, bool high_priority_only);
+
+  // Returns the task to run now, or when the worker should check again if
+  // no task is due.
+  Task *PickTask(Clock::time_point now, bool high_priority_only, std::optional<Clock::time_point> *wake_up);
+
+  void Reschedule(Task &task, Clock::time_point now);
+
+  mutable std::mutex mutex_;
+  // Signals workers that a task was added, resumed or finished
+  std::condition_variable_any work_cv_;
+  // Signals `Cancel` that a task finished its execution
+  std::condition_variable_any done_cv_;
+  uint64_t generation_{0};
+  std::map<TaskId, Task> tasks_;
+  TaskId next_id_{0};
+  size_t io_limit_{1};
+  size_t io_running_{0};
+  std::vector<std::jthread> workers_;
+};
+
+/// Shared by all databases. Schedulers created with a priority run on it once
+/// it's started; until then they keep using a dedicated thread.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+extern BackgroundExecutor global_background_executor;
+
+}  // namespace memgraph::utils
@@ -0,0 +1,75 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace memgraph::utils {
+
+/**
+ * Approximate set of hashes. `MayContain` never returns false for an inserted
+ * hash, and returns true for about 1% of the others when the filter holds the
+ * number of elements it was sized for.
+ */
+class BloomFilter {
+ public:
+  /// Empty filter which contains nothing and can't be inserted into.
+  BloomFilter() = default;
+
+  explicit BloomFilter(size_t expected_elements)
+      : words_(std::bit_ceil(std::max<size_t>(expected_elements * kBitsPerElement, kWordBits)) / kWordBits) {}
+
+  void Insert(uint64_t hash) {
+    const auto [first, step] = Probes(hash);
+    for (uint64_t i = 0; i < kProbes; ++i) {
+      const auto bit = (first + i * step) & BitMask();
+      words_[bit / kWordBits] |= uint64_t{1} << (bit % kWordBits);
+    }
+  }
+
+  bool MayContain(uint64_t hash) const {
+    if (words_.empty()) return false;
+    const auto [first, step] = Probes(hash);
+    for (uint64_t i = 0; i < kProbes; ++i) {
+      const auto bit = (first + i * step) & BitMask();
+      if ((words_[bit / kWordBits] & (uint64_t{1} << (bit % kWordBits))) == 0) return false;
+    }
+    return true;
+  }
+
+ private:
+  static constexpr size_t kWordBits = 64;
+  static constexpr size_t kBitsPerElement = 10;
+  static constexpr uint64_t kProbes = 4;
+
+  uint64_t BitMask() const { return words_.size() * kWordBits - 1; }
+
+  // Probe positions are derived from the two halves of a remixed hash, since
+  // the given hashes can be weak (e.g. identity for integers).
+  static std::pair<uint64_t, uint64_t> Probes(uint64_t hash) {
+    hash ^= hash >> 33U;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33U;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33U;
+    return {hash & 0xffffffffULL, (hash >> 32U) | 1U};
+  }
+
+  std::vector<uint64_t> words_;
+};
+
+}  // namespace memgraph::utils
@@ -97,6 +97,8 @@
   M(SuccessfulQuery, Transaction, "Number of successful queries.")                                                   \
   M(UnreleasedDeltaObjects, Memory, "Total number of unreleased delta objects in memory.")                           \
                                                                                                                      \
+  M(WalBytesWritten, Durability, "Number of bytes written to WAL files.")                                            \
+                                                                                                                     \
   M(DeletedNodes, TTL, "Number of nodes deleted via TTL")                                                            \
   M(DeletedEdges, TTL, "Number of edges deleted via TTL")                                                            \
                                                                                                                      \
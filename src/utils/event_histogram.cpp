@@ -12,10 +12,11 @@
 #include "utils/event_histogram.hpp"
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define APPLY_FOR_HISTOGRAMS(M)                                                                    \
-  M(QueryExecutionLatency_us, Query, "Query execution latency in microseconds", 50, 90, 99)        \
-  M(SnapshotCreationLatency_us, Snapshot, "Snapshot creation latency in microseconds", 50, 90, 99) \
-  M(SnapshotRecoveryLatency_us, Snapshot, "Snapshot recovery latency in microseconds", 50, 90, 99)
+#define APPLY_FOR_HISTOGRAMS(M)                                                    \
+  M(QueryExecutionLatency_us, Query, "Query execution latency", 50, 90, 99)        \
+  M(SnapshotCreationLatency_us, Snapshot, "Snapshot creation latency", 50, 90, 99) \
+  M(SnapshotRecoveryLatency_us, Snapshot, "Snapshot recovery latency", 50, 90, 99) \
+  M(GCLatency_us, Memory, "Garbage collection latency", 50, 90, 99)
 
 namespace memgraph::metrics {
 
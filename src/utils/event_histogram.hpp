@@ -113,6 +113,27 @@ class Histogram {
     return percentile_yield;
   }
 
+  // Returns the number of measurements not greater than each of the (ascending)
+  // `bounds`, as needed for cumulative (Prometheus) histogram buckets.
+  // Measurements are attributed to bounds by their decompressed value, so the
+  // same ~1% precision loss applies.
+  std::vector<uint64_t> CumulativeCounts(const std::vector<uint64_t> &bounds) const {
+    std::vector<uint64_t> counts(bounds.size(), 0);
+    uint64_t scanned = 0;
+    size_t bound = 0;
+    for (int i = 0; i < kSampleLimit && bound < bounds.size(); i++) {
+      const auto decompressed = static_cast<uint64_t>(std::exp(static_cast<double>(i) / kPrecision) - 1.0);
+      while (bound < bounds.size() && decompressed > bounds[bound]) {
+        counts[bound++] = scanned;
+      }
+      scanned += samples_[i];
+    }
+    while (bound < bounds.size()) {
+      counts[bound++] = scanned;
+    }
+    return counts;
+  }
+
   uint64_t Percentile(double percentile) const {
     MG_ASSERT(percentile <= 100.0, "percentiles must not exceed 100.0");
     MG_ASSERT(percentile >= 0.0, "percentiles must be greater than or equal to 0.0");
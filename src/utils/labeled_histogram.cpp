@@ -0,0 +1,128 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "utils/labeled_histogram.hpp"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+namespace memgraph::metrics {
+
+namespace {
+std::atomic<uint64_t> next_histogram_id{0};
+}  // namespace
+
+const std::vector<uint64_t> &LatencyBucketBounds() {
+  static const std::vector<uint64_t> bounds{100,       250,       500,       1'000,      2'500,      5'000,
+                                            10'000,    25'000,    50'000,    100'000,    250'000,    500'000,
+                                            1'000'000, 2'500'000, 5'000'000, 10'000'000, 30'000'000, 60'000'000};
+  return bounds;
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+LabeledHistogram global_query_latency_histogram(LatencyBucketBounds());
+
+void MeasureQueryLatency(std::string_view db, std::string_view query_type, uint64_t microseconds) {
+  global_query_latency_histogram.Measure(db, query_type, microseconds);
+}
+
+LabeledHistogram::LabeledHistogram(std::vector<uint64_t> bounds, size_t max_series)
+    : bounds_(std::move(bounds)),
+      max_series_(max_series),
+      id_(next_histogram_id.fetch_add(1, std::memory_order_relaxed)) {}
+
+LabeledHistogram::Shard &LabeledHistogram::LocalShard() {
+  struct CachedShard {
+    uint64_t histogram_id;
+    Shard *shard;
+  };
+  thread_local std::vector<CachedShard> cached;
+  for (const auto &[histogram_id, shard] : cached) {
+    if (histogram_id == id_) return *shard;
+  }
+
+  auto guard = std::lock_guard{shards_lock_};
+  auto *shard = shards_.emplace_back(std::make_unique<Shard>()).get();
+  cached.push_back({id_, shard});
+  return *shard;
+}
+
+bool LabeledHistogram::Admit(std::string_view first_label, std::string_view second_label) {
+  auto guard = std::lock_guard{shards_lock_};
+  auto first_it = admitted_.find(first_label);
+  if (first_it != admitted_.end() && first_it->second.contains(second_label)) return true;
+  if (admitted_count_ == max_series_) return false;
+  ++admitted_count_;
+  if (first_it == admitted_.end()) first_it = admitted_.try_emplace(std::string{first_label}).first;
+  first_it->second.emplace(second_label);
+  return true;
+}
+
+void LabeledHistogram::Measure(std::string_view first_label, std::string_view second_label, uint64_t value) {
+  const auto bucket = std::lower_bound(bounds_.begin(), bounds_.end(), value) - bounds_.begin();
+  auto &shard = LocalShard();
+  auto guard = std::unique_lock{shard.lock};
+
+  auto first_it = shard.series.find(first_label);
+  if (first_it == shard.series.end() || !first_it->second.contains(second_label)) {
+    // Only this thread adds series to its shard, so the shard can be unlocked
+    // while admitting, which locks the shards the other way round
+    guard.unlock();
+    if (!Admit(first_label, second_label)) first_label = second_label = kOverflowLabel;
+    guard.lock();
+    first_it = shard.series.find(first_label);
+  }
+  if (first_it == shard.series.end()) first_it = shard.series.try_emplace(std::string{first_label}).first;
+  auto second_it = first_it->second.find(second_label);
+  if (second_it == first_it->second.end()) {
+    second_it = first_it->second.try_emplace(std::string{second_label}).first;
+    second_it->second.counts.resize(bounds_.size() + 1, 0);
+  }
+
+  ++second_it->second.counts[bucket];
+  second_it->second.sum += value;
+}
+
+std::vector<LabeledHistogram::Series> LabeledHistogram::Collect() const {
+  std::map<std::pair<std::string, std::string>, Buckets> merged;
+  {
+    auto guard = std::lock_guard{shards_lock_};
+    for (const auto &shard : shards_) {
+      auto shard_guard = std::lock_guard{shard->lock};
+      for (const auto &[first_label, by_second_label] : shard->series) {
+        for (const auto &[second_label, buckets] : by_second_label) {
+          auto &target = merged[{first_label, second_label}];
+          target.counts.resize(bounds_.size() + 1, 0);
+          for (size_t i = 0; i < buckets.counts.size(); ++i) target.counts[i] += buckets.counts[i];
+          target.sum += buckets.sum;
+        }
+      }
+    }
+  }
+
+  std::vector<Series> result;
+  result.reserve(merged.size());
+  for (auto &[labels, buckets] : merged) {
+    uint64_t total = 0;
+    for (auto &count : buckets.counts) {
+      total += count;
+      count = total;
+    }
+    result.push_back(Series{.first_label = labels.first,
+                            .second_label = labels.second,
+                            .cumulative_counts = std::move(buckets.counts),
+                            .sum = buckets.sum});
+  }
+  return result;
+}
+
+}  // namespace memgraph::metrics
@@ -0,0 +1,114 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "utils/spin_lock.hpp"
+
+namespace memgraph::metrics {
+
+// A histogram with fixed (Prometheus style) bucket bounds which is partitioned
+// by the values of two labels, e.g. the database name and the query type.
+//
+// Every thread measures into its own shard, so a measurement only takes a
+// spin lock nobody else is contending for (except a concurrent Collect).
+// Shards are merged when the histogram is collected.
+//
+// Label values can come from users (e.g. database names), so the number of
+// series is capped. Measurements with labels past the cap are counted in a
+// single series labeled with `kOverflowLabel`.
+class LabeledHistogram {
+ public:
+  static constexpr std::string_view kOverflowLabel = "_overflow";
+  static constexpr size_t kDefaultMaxSeries = 1024;
+
+  struct Series {
+    std::string first_label;
+    std::string second_label;
+    // Number of measurements not greater than each bound, followed by the total count (the +Inf bucket).
+    std::vector<uint64_t> cumulative_counts;
+    uint64_t sum{0};
+  };
+
+  // `bounds` have to be sorted in ascending order.
+  explicit LabeledHistogram(std::vector<uint64_t> bounds, size_t max_series = kDefaultMaxSeries);
+
+  LabeledHistogram(const LabeledHistogram &) = delete;
+  LabeledHistogram(LabeledHistogram &&) = delete;
+  LabeledHistogram &operator=(const LabeledHistogram &) = delete;
+  LabeledHistogram &operator=(LabeledHistogram &&) = delete;
+  ~LabeledHistogram() = default;
+
+  void Measure(std::string_view first_label, std::string_view second_label, uint64_t value);
+
+  // Returns the merged series sorted by their labels.
+  std::vector<Series> Collect() const;
+
+  const std::vector<uint64_t> &Bounds() const { return bounds_; }
+
+ private:
+  struct StringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view value) const { return std::hash<std::string_view>{}(value); }
+  };
+
+  template <typename TValue>
+  using StringMap = std::unordered_map<std::string, TValue, StringHash, std::equal_to<>>;
+  using StringSet = std::unordered_set<std::string, StringHash, std::equal_to<>>;
+
+  struct Buckets {
+    std::vector<uint64_t> counts;
+    uint64_t sum{0};
+  };
+
+  struct Shard {
+    utils::SpinLock lock;
+    StringMap<StringMap<Buckets>> series;
+  };
+
+  Shard &LocalShard();
+
+  // Whether a series with these labels fits under the cap. Series are admitted
+  // for all shards, so that the cap holds for the merged series.
+  bool Admit(std::string_view first_label, std::string_view second_label);
+
+  std::vector<uint64_t> bounds_;
+  size_t max_series_;
+  // Used to tell apart a thread's cached shard of this histogram from one of a destroyed histogram.
+  const uint64_t id_;
+  mutable std::mutex shards_lock_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  // Protected by `shards_lock_`.
+  StringMap<StringSet> admitted_;
+  size_t admitted_count_{0};
+};
+
+// Bucket bounds (in microseconds) used for latency histograms, from 100us to a minute.
+const std::vector<uint64_t> &LatencyBucketBounds();
+
+// Latency of finished queries in microseconds, labeled with the database name and the query type.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+extern LabeledHistogram global_query_latency_histogram;
+
+void MeasureQueryLatency(std::string_view db, std::string_view query_type, uint64_t microseconds);
+
+}  // namespace memgraph::metrics
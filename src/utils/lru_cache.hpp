@@ -49,6 +49,14 @@ class LRUCache {
     item_map.clear();
   };
   std::size_t size() { return item_map.size(); };
+  /// Calls the function with each key and value, from the most to the least
+  /// recently used one, without affecting their order.
+  template <typename TFunc>
+  void for_each(TFunc &&func) const {
+    for (const auto &[key, val] : item_list) {
+      func(key, val);
+    }
+  }
 
  private:
   void try_clean() {
@@ -75,6 +75,13 @@ void QueryMemoryTracker::TryCreateProcTracker(int64_t procedure_id, size_t limit
   it->second.SetHardLimit(static_cast<int64_t>(limit));
 }
 
+std::optional<int64_t> QueryMemoryTracker::Peak() const {
+  if (!query_tracker_.has_value()) {
+    return std::nullopt;
+  }
+  return query_tracker_->Peak();
+}
+
 void QueryMemoryTracker::InitializeQueryTracker() { query_tracker_.emplace(); }
 
 }  // namespace memgraph::utils
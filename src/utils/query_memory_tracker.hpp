@@ -61,6 +61,9 @@ class QueryMemoryTracker {
   // Stop procedure tracking
   void StopProcTracking();
 
+  // Peak memory of the query, if the query is tracked
+  std::optional<int64_t> Peak() const;
+
  private:
   static constexpr int64_t NO_PROCEDURE{-1};
   void InitializeQueryTracker();
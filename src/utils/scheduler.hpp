@@ -16,8 +16,11 @@
 #include <condition_variable>
 #include <ctime>
 #include <functional>
+#include <optional>
 #include <thread>
+#include <utility>
 
+#include "utils/background_executor.hpp"
 #include "utils/logging.hpp"
 #include "utils/thread.hpp"
 
@@ -29,6 +32,13 @@ namespace memgraph::utils {
 class Scheduler {
  public:
   Scheduler() = default;
+
+  /**
+   * The function is run on `global_background_executor` if it's started when
+   * `Run` is called, otherwise on a dedicated thread.
+   */
+  explicit Scheduler(TaskPriority priority, bool io_heavy = false)
+      : shared_options_{BackgroundExecutor::TaskOptions{.priority = priority, .io_heavy = io_heavy}} {}
   /**
    * @param pause - Duration between two function executions. If function is
    * still running when it should be ran again, it will run right after it
@@ -45,6 +55,14 @@ class Scheduler {
     DMG_ASSERT(!IsRunning(), "Thread already running.");
     DMG_ASSERT(pause > std::chrono::seconds(0), "Pause is invalid. Expected > 0, got {}.", pause.count());
 
+    if (shared_options_ && global_background_executor.IsRunning()) {
+      auto lk = std::unique_lock{mutex_};
+      shared_task_ = global_background_executor.Schedule(
+          service_name, std::chrono::duration_cast<std::chrono::milliseconds>(pause), f, *shared_options_, start_time);
+      if (is_paused_) global_background_executor.Pause(*shared_task_);
+      return;
+    }
+
     thread_ = std::jthread([this, pause, f, service_name, start_time](std::stop_token token) mutable {
       auto find_first_execution = [&]() {
         if (start_time) {              // Custom start time; execute as soon as possible
@@ -98,6 +116,7 @@ class Scheduler {
     {
       auto lk = std::unique_lock{mutex_};
       is_paused_ = false;
+      if (shared_task_) global_background_executor.Resume(*shared_task_);
     }
     condition_variable_.notify_one();
   }
@@ -106,12 +125,23 @@ class Scheduler {
   void Pause() {
     auto lk = std::unique_lock{mutex_};
     is_paused_ = true;
+    if (shared_task_) global_background_executor.Pause(*shared_task_);
   }
 
   // Concurrent threads may request stopping the scheduler. In that case only one of them will
   // actually stop the scheduler, the other one won't. We need to know which one is the successful
   // one so that we don't try to join thread concurrently since this could cause undefined behavior.
   void Stop() {
+    std::optional<BackgroundExecutor::TaskId> shared_task;
+    {
+      auto lk = std::unique_lock{mutex_};
+      shared_task = std::exchange(shared_task_, std::nullopt);
+      if (shared_task) is_paused_ = false;
+    }
+    if (shared_task) {
+      global_background_executor.Cancel(*shared_task);
+      return;
+    }
     if (thread_.request_stop()) {
       {
         auto lk = std::unique_lock{mutex_};
@@ -125,6 +155,10 @@ class Scheduler {
   // Checking stop_possible() is necessary because otherwise calling IsRunning
   // on a non-started Scheduler would return true.
   bool IsRunning() {
+    {
+      auto lk = std::unique_lock{mutex_};
+      if (shared_task_) return true;
+    }
     std::stop_token token = thread_.get_stop_token();
     return token.stop_possible() && !token.stop_requested();
   }
@@ -152,6 +186,17 @@ class Scheduler {
    * Thread which runs function.
    */
   std::jthread thread_;
+
+  /**
+   * Set if the function may run on the shared background executor.
+   */
+  std::optional<BackgroundExecutor::TaskOptions> shared_options_;
+
+  /**
+   * Task registered on the shared background executor, if used. Protected by
+   * `mutex_`.
+   */
+  std::optional<BackgroundExecutor::TaskId> shared_task_;
 };
 
 }  // namespace memgraph::utils
@@ -79,6 +79,8 @@ enum class TypeId : uint64_t {
   ROLLUP_APPLY,
   PERIODIC_COMMIT,
   PERIODIC_SUBQUERY,
+  JOIN_KEY_FILTER,
+  INTERSECT_EXPAND,
 
   // Replication
   // NOTE: these NEED to be stable in the 2000+ range (see rpc version)
@@ -112,6 +114,8 @@ enum class TypeId : uint64_t {
   REP_TRY_SET_MAIN_UUID_RES,
   REP_FORCE_RESET_STORAGE_REQ,
   REP_FORCE_RESET_STORAGE_RES,
+  REP_FILE_CHUNK_REQ,
+  REP_FILE_CHUNK_RES,
 
   // Coordinator
   COORD_FAILOVER_REQ,
@@ -0,0 +1,56 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <array>
+#include <new>
+
+#include <benchmark/benchmark.h>
+
+#include "utils/allocator/page_pool.hpp"
+
+using memgraph::utils::PagePool;
+
+// A short transaction allocates a handful of pages for its deltas and frees them on commit
+constexpr auto kPagesPerTransaction = 64;
+
+template <typename TAllocate, typename TDeallocate>
+void RunTransactions(benchmark::State &state, TAllocate allocate, TDeallocate deallocate) {
+  const auto size = state.range(0) * PagePool::PAGE_SIZE;
+  std::array<void *, kPagesPerTransaction> pages{};
+  for (auto _ : state) {
+    for (auto &page : pages) {
+      page = allocate(size);
+      // Touch the page like the first delta written to it would
+      *static_cast<char *>(page) = 1;
+    }
+    benchmark::DoNotOptimize(pages.data());
+    for (auto *page : pages) deallocate(page, size);
+  }
+  state.SetItemsProcessed(state.iterations() * kPagesPerTransaction);
+}
+
+static void BM_PagePool(benchmark::State &state) {
+  auto &pool = PagePool::Global();
+  RunTransactions(
+      state, [&](auto size) { return pool.Allocate(size); },
+      [&](auto *ptr, auto size) { pool.Deallocate(ptr, size); });
+}
+
+static void BM_AlignedNew(benchmark::State &state) {
+  RunTransactions(
+      state, [](auto size) { return operator new(size, std::align_val_t{PagePool::PAGE_SIZE}); },
+      [](auto *ptr, auto /*size*/) { operator delete(ptr, std::align_val_t{PagePool::PAGE_SIZE}); });
+}
+
+BENCHMARK(BM_PagePool)->Arg(1)->Arg(4)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_AlignedNew)->Arg(1)->Arg(4)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -39,8 +39,14 @@ startup_config_dict = {
         "200",
         "Interval (in milliseconds) used for flushing the audit log buffer.",
     ),
-    "audit_buffer_size": ("100000", "100000", "Maximum number of items in the audit log buffer."),
+    "audit_buffer_size": ("100000", "100000", "Maximum number of items in the audit log buffer of each thread."),
     "audit_enabled": ("false", "false", "Set to true to enable audit logging."),
+    "audit_log_format": (
+        "text",
+        "text",
+        "Format of the audit log. Options [text, binary]. Binary logs are more compact and cheaper to write; convert "
+        "them to the text format with mg_audit_convert.",
+    ),
     "auth_user_or_role_name_regex": (
         "[a-zA-Z0-9_.+-@]+",
         "[a-zA-Z0-9_.+-@]+",
@@ -183,6 +189,18 @@ startup_config_dict = {
     ),
     "storage_gc_cycle_sec": ("30", "30", "Storage garbage collector interval (in seconds)."),
     "storage_python_gc_cycle_sec": ("180", "180", "Storage python full garbage collection interval (in seconds)."),
+    "storage_background_workers": (
+        "0",
+        "0",
+        "Number of threads shared by the background tasks (GC, snapshots, TTL) of all databases. When 0, each task of "
+        "each database runs on its own thread.",
+    ),
+    "storage_background_io_limit": (
+        "1",
+        "1",
+        "Maximum number of I/O-heavy background tasks (snapshots) running at the same time when "
+        "storage_background_workers is set.",
+    ),
     "storage_items_per_batch": (
         "1000000",
         "1000000",
@@ -235,6 +253,11 @@ startup_config_dict = {
     ),
     "query_cost_planner": ("true", "true", "Use the cost-estimating query planner."),
     "query_plan_cache_max_size": ("1000", "1000", "Maximum number of query plans to cache."),
+    "query_stats_sample_rate": (
+        "100",
+        "100",
+        "Collect per-operator runtime statistics of cached query plans for one in every N executions. 0 disables the collection.",
+    ),
     "query_vertex_count_to_expand_existing": (
         "10",
         "10",
@@ -274,5 +297,16 @@ startup_config_dict = {
         "Experimental features to be used, comma-separated. Options [text-search, high-availability]",
     ),
     "query_log_directory": ("", "", "Path to directory where the query logs should be stored."),
+    "slow_query_log_threshold_ms": (
+        "0",
+        "0",
+        "Queries which take longer than this (in milliseconds) are written to the slow query log together with their plan and resource usage. Value of 0 disables the slow query log.",
+    ),
+    "slow_query_log_file_size_kib": (
+        "10240",
+        "10240",
+        "Maximum size (in kibibytes) of a slow query log file before it is rotated.",
+    ),
+    "slow_query_log_file_count": ("5", "5", "Number of rotated slow query log files which are kept."),
     "schema_info_enabled": ("false", "false", "Set to true to enable run-time schema info tracking."),
 }
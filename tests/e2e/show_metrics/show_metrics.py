@@ -17,6 +17,7 @@ from common import memgraph
 
 def test_all_show_metrics_info_values_are_present(memgraph):
     expected_metrics = [
+        {"name": "WalBytesWritten", "type": "Durability", "metric type": "Counter"},
         {"name": "AverageDegree", "type": "General", "metric type": "Gauge"},
         {"name": "EdgeCount", "type": "General", "metric type": "Gauge"},
         {"name": "VertexCount", "type": "General", "metric type": "Gauge"},
@@ -28,6 +29,9 @@ def test_all_show_metrics_info_values_are_present(memgraph):
         {"name": "DiskUsage", "type": "Memory", "metric type": "Gauge"},
         {"name": "MemoryRes", "type": "Memory", "metric type": "Gauge"},
         {"name": "PeakMemoryRes", "type": "Memory", "metric type": "Gauge"},
+        {"name": "GCLatency_us_50p", "type": "Memory", "metric type": "Histogram"},
+        {"name": "GCLatency_us_90p", "type": "Memory", "metric type": "Histogram"},
+        {"name": "GCLatency_us_99p", "type": "Memory", "metric type": "Histogram"},
         {"name": "AccumulateOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "AggregateOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "ApplyOperator", "type": "Operator", "metric type": "Counter"},
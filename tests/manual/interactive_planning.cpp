@@ -282,6 +282,11 @@ class InteractiveDbAccessor {
     return label_property_index_.at(key);
   }
 
+  bool LabelPropertyHashIndexExists(memgraph::storage::LabelId /*label_id*/,
+                                    memgraph::storage::PropertyId /*property_id*/) {
+    return false;
+  }
+
   bool EdgeTypeIndexExists(memgraph::storage::EdgeTypeId edge_type_id) { return true; }
 
   bool EdgeTypePropertyIndexExists(memgraph::storage::EdgeTypeId edge_type_id,
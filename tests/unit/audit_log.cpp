@@ -0,0 +1,161 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Licensed as a Memgraph Enterprise file under the Memgraph Enterprise
+// License (the "License"); by using this file, you agree to be bound by the terms of the License, and you may not use
+// this file except in compliance with the License. You may obtain a copy of the License at https://memgraph.com/legal.
+//
+//
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "audit/log.hpp"
+#include "audit/record.hpp"
+
+namespace {
+std::string ReadFile(const std::filesystem::path &path) {
+  std::ifstream file(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+}  // namespace
+
+TEST(AuditRecord, EncodeDecode) {
+  memgraph::communication::bolt::map_t params{{"name", memgraph::communication::bolt::Value("Alice")},
+                                              {"age", memgraph::communication::bolt::Value(int64_t{42})}};
+  std::string encoded;
+  memgraph::audit::EncodeRecord(&encoded, 1'700'000'000'123'456, "127.0.0.1:7687", "user",
+                                "MATCH (n {name: $name}) RETURN n;", params, "memgraph");
+
+  ASSERT_EQ(memgraph::audit::NextRecordSize(encoded), encoded.size());
+  ASSERT_FALSE(memgraph::audit::NextRecordSize(std::string_view{encoded}.substr(0, encoded.size() - 1)));
+
+  auto record = memgraph::audit::DecodeRecord(encoded);
+  ASSERT_TRUE(record);
+  ASSERT_EQ(record->timestamp, 1'700'000'000'123'456);
+  ASSERT_EQ(record->address, "127.0.0.1:7687");
+  ASSERT_EQ(record->username, "user");
+  ASSERT_EQ(record->query, "MATCH (n {name: $name}) RETURN n;");
+  ASSERT_EQ(record->params.size(), 2);
+  ASSERT_EQ(record->params.at("name").ValueString(), "Alice");
+  ASSERT_EQ(record->params.at("age").ValueInt(), 42);
+  ASSERT_EQ(record->db, "memgraph");
+
+  std::string line;
+  memgraph::audit::AppendTextRecord(&line, *record);
+  ASSERT_EQ(line,
+            "1700000000.123456,127.0.0.1:7687,user,memgraph,\"MATCH (n {name: $name}) RETURN n;\","
+            "\"{\\\"age\\\":42,\\\"name\\\":\\\"Alice\\\"}\"\n");
+}
+
+TEST(AuditLog, BinaryLogFromManyThreads) {
+  const auto directory = std::filesystem::temp_directory_path() / "MG_tests_unit_audit_log";
+  std::filesystem::remove_all(directory);
+  constexpr int kThreads = 8;
+  constexpr int kRecordsPerThread = 1000;
+  {
+    // Large enough that every thread gets the largest buffer
+    memgraph::audit::Log log{directory, INT32_MAX, 10, memgraph::audit::Log::Format::BINARY};
+    ASSERT_GE(memgraph::audit::Log::ThreadBufferSize(INT32_MAX), kRecordsPerThread);
+    log.Start();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreads; ++i) {
+      threads.emplace_back([&log, i] {
+        for (int j = 0; j < kRecordsPerThread; ++j) {
+          log.Record("", std::to_string(i), std::to_string(j), {}, "memgraph");
+        }
+      });
+    }
+    for (auto &thread : threads) thread.join();
+  }
+
+  const auto data = ReadFile(directory / "audit.bin");
+  std::vector<int> next_per_thread(kThreads, 0);
+  std::string_view remaining{data};
+  while (!remaining.empty()) {
+    const auto size = memgraph::audit::NextRecordSize(remaining);
+    ASSERT_TRUE(size);
+    auto record = memgraph::audit::DecodeRecord(remaining.substr(0, *size));
+    ASSERT_TRUE(record);
+    // Entries of a single thread keep their order.
+    auto &next = next_per_thread[std::stoi(record->username)];
+    ASSERT_EQ(std::stoi(record->query), next);
+    ++next;
+    remaining.remove_prefix(*size);
+  }
+  for (auto next : next_per_thread) ASSERT_EQ(next, kRecordsPerThread);
+  std::filesystem::remove_all(directory);
+}
+
+TEST(AuditLog, FullBufferKeepsEveryEntry) {
+  const auto directory = std::filesystem::temp_directory_path() / "MG_tests_unit_audit_log_full";
+  std::filesystem::remove_all(directory);
+  const auto thread_buffer_size = memgraph::audit::Log::ThreadBufferSize(10);
+  {
+    // The flush interval is long enough that nothing is drained while recording.
+    memgraph::audit::Log log{directory, 10, 60'000};
+    log.Start();
+    for (uint64_t i = 0; i < thread_buffer_size + 100; ++i) {
+      log.Record("", "", std::to_string(i), {}, "memgraph");
+    }
+  }
+
+  const auto data = ReadFile(directory / "audit.log");
+  ASSERT_EQ(static_cast<uint64_t>(std::count(data.begin(), data.end(), '\n')), thread_buffer_size + 100);
+  // Entries that didn't fit into the buffer come after the buffered ones
+  std::string::size_type previous = 0;
+  for (uint64_t i = 0; i < thread_buffer_size + 100; ++i) {
+    const auto position = data.find("\"" + std::to_string(i) + "\"");
+    ASSERT_NE(position, std::string::npos);
+    ASSERT_GE(position, previous);
+    previous = position;
+  }
+  std::filesystem::remove_all(directory);
+}
+
+TEST(AuditLog, ThreadBufferSizeIsBounded) {
+  const auto smallest = memgraph::audit::Log::ThreadBufferSize(1);
+  const auto largest = memgraph::audit::Log::ThreadBufferSize(INT32_MAX);
+  ASSERT_GT(smallest, 0);
+  ASSERT_LE(smallest, memgraph::audit::Log::ThreadBufferSize(100'000));
+  ASSERT_LE(memgraph::audit::Log::ThreadBufferSize(100'000), largest);
+  // Idle threads don't each hold on to a buffer of the whole size
+  ASSERT_LT(largest, 100'000);
+}
+
+TEST(AuditLog, EntriesOfExitedThreadsAreKept) {
+  const auto directory = std::filesystem::temp_directory_path() / "MG_tests_unit_audit_log_exited";
+  std::filesystem::remove_all(directory);
+  constexpr int kThreads = 50;
+  {
+    memgraph::audit::Log log{directory, 100'000, 10, memgraph::audit::Log::Format::BINARY};
+    log.Start();
+    // Buffers of exited threads are freed by the flushes in between
+    for (int i = 0; i < kThreads; ++i) {
+      std::thread{[&log, i] { log.Record("", std::to_string(i), "", {}, "memgraph"); }}.join();
+      if (i % 10 == 0) std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+  }
+
+  const auto data = ReadFile(directory / "audit.bin");
+  std::vector<bool> recorded(kThreads, false);
+  std::string_view remaining{data};
+  while (!remaining.empty()) {
+    const auto size = memgraph::audit::NextRecordSize(remaining);
+    ASSERT_TRUE(size);
+    auto record = memgraph::audit::DecodeRecord(remaining.substr(0, *size));
+    ASSERT_TRUE(record);
+    recorded[std::stoi(record->username)] = true;
+    remaining.remove_prefix(*size);
+  }
+  ASSERT_TRUE(std::ranges::all_of(recorded, [](bool thread_recorded) { return thread_recorded; }));
+  std::filesystem::remove_all(directory);
+}
@@ -366,6 +366,51 @@ TEST_F(AuthWithStorage, UserRoleLinkUnlink) {
   }
 }
 
+TEST_F(AuthWithStorage, CachedUsersAndRolesFollowUpdates) {
+  ASSERT_FALSE(auth->GetUser("user"));
+  ASSERT_FALSE(auth->GetRole("role"));
+  {
+    auto user = auth->AddUser("user");
+    ASSERT_TRUE(user);
+    auto role = auth->AddRole("role");
+    ASSERT_TRUE(role);
+    user->SetRole(*role);
+    auth->SaveUser(*user);
+  }
+
+  // Warm up the cache
+  ASSERT_TRUE(auth->GetUser("User"));
+  ASSERT_TRUE(auth->GetRole("ROLE"));
+
+  {
+    auto role = auth->GetRole("role");
+    ASSERT_TRUE(role);
+    role->permissions().Grant(Permission::MATCH);
+    auth->SaveRole(*role);
+  }
+
+  {
+    auto role = auth->GetRole("role");
+    ASSERT_TRUE(role);
+    ASSERT_EQ(role->permissions().Has(Permission::MATCH), PermissionLevel::GRANT);
+    auto user = auth->GetUser("user");
+    ASSERT_TRUE(user);
+    ASSERT_NE(user->role(), nullptr);
+    ASSERT_EQ(user->role()->permissions().Has(Permission::MATCH), PermissionLevel::GRANT);
+  }
+
+  ASSERT_TRUE(auth->RemoveRole("role"));
+  ASSERT_FALSE(auth->GetRole("role"));
+  {
+    auto user = auth->GetUser("user");
+    ASSERT_TRUE(user);
+    ASSERT_EQ(user->role(), nullptr);
+  }
+
+  ASSERT_TRUE(auth->RemoveUser("user"));
+  ASSERT_FALSE(auth->GetUser("user"));
+}
+
 TEST_F(AuthWithStorage, UserPasswordCreation) {
   {
     auto user = auth->AddUser("test");
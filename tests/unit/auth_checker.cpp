@@ -229,6 +229,26 @@ TYPED_TEST(FineGrainedAuthCheckerFixture, GrantAndDenySpecificEdgeTypes) {
   ASSERT_FALSE(auth_checker.Has(this->r4, memgraph::query::AuthQuery::FineGrainedPrivilege::READ));
 }
 
+TYPED_TEST(FineGrainedAuthCheckerFixture, LabelCreatedAfterChecker) {
+  memgraph::auth::User user{"test"};
+  user.fine_grained_access_handler().label_permissions().Grant("*", memgraph::auth::FineGrainedPermission::READ);
+  user.fine_grained_access_handler().label_permissions().Grant("l4", memgraph::auth::FineGrainedPermission::NOTHING);
+  memgraph::glue::FineGrainedAuthChecker auth_checker{user, &this->dba};
+
+  ASSERT_TRUE(
+      auth_checker.Has(this->v2, memgraph::storage::View::NEW, memgraph::query::AuthQuery::FineGrainedPrivilege::READ));
+
+  ASSERT_TRUE(this->v2.AddLabel(this->dba.NameToLabel("l4")).HasValue());
+  this->dba.AdvanceCommand();
+
+  ASSERT_FALSE(
+      auth_checker.Has(this->v2, memgraph::storage::View::NEW, memgraph::query::AuthQuery::FineGrainedPrivilege::READ));
+  ASSERT_TRUE(
+      auth_checker.Has(this->v1, memgraph::storage::View::NEW, memgraph::query::AuthQuery::FineGrainedPrivilege::READ));
+  ASSERT_FALSE(auth_checker.Has(std::vector{this->dba.NameToLabel("l4")},
+                                memgraph::query::AuthQuery::FineGrainedPrivilege::READ));
+}
+
 TEST(AuthChecker, Generate) {
   std::filesystem::path auth_dir{std::filesystem::temp_directory_path() / "MG_auth_checker"};
   memgraph::utils::OnScopeExit clean([&]() {
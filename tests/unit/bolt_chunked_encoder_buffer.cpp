@@ -109,3 +109,48 @@ TEST_F(BoltChunkedEncoderBuffer, OneAndAHalfOfMaxChunk) {
   VerifyChunkOfTestData(output, kChunkMaxDataSize);
   VerifyChunkOfTestData(output + kChunkWholeSize, kTestDataSize - kChunkMaxDataSize, kChunkMaxDataSize);
 }
+
+TEST_F(BoltChunkedEncoderBuffer, CoalescesSmallChunks) {
+  int size = 100;
+  int count = 10;
+
+  // initialize tested buffer
+  TestOutputStream output_stream;
+  BufferT buffer(output_stream);
+
+  // write messages which are followed by more data
+  for (int i = 0; i < count; ++i) {
+    buffer.Write(test_data + i * size, size);
+    buffer.Flush(true);
+  }
+  ASSERT_EQ(output_stream.write_calls, 0);
+
+  // the last flush sends all of the pending chunks at once
+  buffer.Flush();
+  ASSERT_EQ(output_stream.write_calls, 1);
+
+  auto *data = output_stream.output.data();
+  for (int i = 0; i < count; ++i) {
+    VerifyChunkOfTestData(data + i * (kChunkHeaderSize + size), size, i * size);
+  }
+  VerifyChunkOfTestData(data + count * (kChunkHeaderSize + size), 0);
+}
+
+TEST_F(BoltChunkedEncoderBuffer, ClearKeepsFinishedChunks) {
+  int size = 100;
+
+  // initialize tested buffer
+  TestOutputStream output_stream;
+  BufferT buffer(output_stream);
+
+  buffer.Write(test_data, size);
+  buffer.Flush(true);
+  buffer.Write(test_data + size, size);
+  buffer.Clear();
+  buffer.Flush();
+
+  auto *data = output_stream.output.data();
+  ASSERT_EQ(output_stream.output.size(), 2 * kChunkHeaderSize + size);
+  VerifyChunkOfTestData(data, size);
+  VerifyChunkOfTestData(data + kChunkHeaderSize + size, 0);
+}
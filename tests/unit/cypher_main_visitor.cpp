@@ -1807,6 +1807,24 @@ TEST_P(CypherMainVisitorTest, CreateIndex) {
   EXPECT_EQ(index_query->label_, ast_generator.Label("mirko"));
   std::vector<PropertyIx> expected_properties{ast_generator.Prop("slavko")};
   EXPECT_EQ(index_query->properties_, expected_properties);
+  EXPECT_FALSE(index_query->using_hash_);
+}
+
+TEST_P(CypherMainVisitorTest, CreateHashIndex) {
+  auto &ast_generator = *GetParam();
+  auto *index_query =
+      dynamic_cast<IndexQuery *>(ast_generator.ParseQuery("Create InDeX oN :mirko(slavko) UsInG hAsH"));
+  ASSERT_TRUE(index_query);
+  EXPECT_EQ(index_query->action_, IndexQuery::Action::CREATE);
+  EXPECT_EQ(index_query->label_, ast_generator.Label("mirko"));
+  std::vector<PropertyIx> expected_properties{ast_generator.Prop("slavko")};
+  EXPECT_EQ(index_query->properties_, expected_properties);
+  EXPECT_TRUE(index_query->using_hash_);
+}
+
+TEST_P(CypherMainVisitorTest, CreateHashIndexWithoutProperty) {
+  auto &ast_generator = *GetParam();
+  EXPECT_THROW(ast_generator.ParseQuery("CREATE INDEX ON :mirko USING HASH"), SyntaxException);
 }
 
 TEST_P(CypherMainVisitorTest, DropIndex) {
@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <filesystem>
+#include <fstream>
 
 #include "communication/bolt/v1/value.hpp"
 #include "communication/result_stream_faker.hpp"
@@ -22,12 +23,14 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "interpreter_faker.hpp"
+#include "json/json.hpp"
 #include "query/auth_checker.hpp"
 #include "query/config.hpp"
 #include "query/exceptions.hpp"
 #include "query/interpreter.hpp"
 #include "query/interpreter_context.hpp"
 #include "query/metadata.hpp"
+#include "query/slow_query_log.hpp"
 #include "query/stream.hpp"
 #include "query/typed_value.hpp"
 #include "query_common.hpp"
@@ -38,6 +41,7 @@
 #include "storage/v2/storage_mode.hpp"
 #include "utils/logging.hpp"
 #include "utils/lru_cache.hpp"
+#include "utils/on_scope_exit.hpp"
 #include "utils/synchronized.hpp"
 
 namespace {
@@ -157,6 +161,50 @@ TYPED_TEST(InterpreterTest, MultiplePulls) {
   }
 }
 
+TYPED_TEST(InterpreterTest, PrefetchedPulls) {
+  {
+    auto [stream, qid] = this->Prepare("UNWIND [1,2,3,4,5,6] as n RETURN n");
+    this->Pull(&stream, 2);
+    ASSERT_TRUE(stream.GetSummary().at("has_more").ValueBool());
+    this->default_interpreter.interpreter.Prefetch(2);
+    // Prefetching twice doesn't skip results.
+    this->default_interpreter.interpreter.Prefetch(2);
+    this->Pull(&stream, 3);
+    ASSERT_TRUE(stream.GetSummary().at("has_more").ValueBool());
+    ASSERT_EQ(stream.GetResults().size(), 5U);
+    this->default_interpreter.interpreter.Prefetch(2);
+    this->Pull(&stream, 1);
+    ASSERT_FALSE(stream.GetSummary().at("has_more").ValueBool());
+    ASSERT_EQ(stream.GetResults().size(), 6U);
+    for (int i = 0; i < 6; ++i) {
+      ASSERT_EQ(stream.GetResults()[i][0].ValueInt(), i + 1);
+    }
+    // Nothing to prefetch once the query has no more results.
+    this->default_interpreter.interpreter.Prefetch(2);
+  }
+  {
+    // An error while prefetching is thrown by the next pull, after the results
+    // prefetched before it, and aborts the query like any failed pull.
+    auto [stream, qid] = this->Prepare("UNWIND [1, 2, 0] AS x RETURN 2 / x");
+    this->Pull(&stream, 1);
+    ASSERT_TRUE(stream.GetSummary().at("has_more").ValueBool());
+    this->default_interpreter.interpreter.Prefetch(2);
+    ASSERT_THROW(this->Pull(&stream, 1), memgraph::query::QueryRuntimeException);
+    ASSERT_EQ(stream.GetResults().size(), 2U);
+    auto after_error = this->Interpret("RETURN 1");
+    ASSERT_EQ(after_error.GetResults().size(), 1U);
+  }
+  {
+    // Write queries aren't pulled ahead of the client.
+    auto [stream, qid] = this->Prepare("UNWIND [1,2,3] as n CREATE (:Node {n: n}) RETURN n");
+    this->Pull(&stream, 1);
+    this->default_interpreter.interpreter.Prefetch(2);
+    this->Pull(&stream);
+    ASSERT_FALSE(stream.GetSummary().at("has_more").ValueBool());
+    ASSERT_EQ(stream.GetResults().size(), 3U);
+  }
+}
+
 // Run query with different ast twice to see if query executes correctly when
 // ast is read from cache.
 TYPED_TEST(InterpreterTest, AstCache) {
@@ -871,6 +919,70 @@ TYPED_TEST(InterpreterTest, ProfileQueryWithParams) {
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
 }
 
+TYPED_TEST(InterpreterTest, QueryStatsOfSampledExecutions) {
+  const auto sample_rate = FLAGS_query_stats_sample_rate;
+  memgraph::utils::OnScopeExit restore_sample_rate{[sample_rate] { FLAGS_query_stats_sample_rate = sample_rate; }};
+  FLAGS_query_stats_sample_rate = 0;
+  this->Interpret("MATCH (n) RETURN *;");
+  EXPECT_TRUE(this->Interpret("SHOW QUERY STATS;").GetResults().empty());
+
+  FLAGS_query_stats_sample_rate = 1;
+  this->Interpret("CREATE ();");
+  this->Interpret("MATCH (n) RETURN *;");
+  this->Interpret("MATCH (n) RETURN *;");
+  auto stream = this->Interpret("SHOW QUERY STATS;");
+  std::vector<std::string> expected_header{"query",       "executions",    "sampled executions", "operator",
+                                           "actual hits", "relative time", "absolute time"};
+  EXPECT_EQ(stream.GetHeader(), expected_header);
+
+  std::vector<std::vector<memgraph::communication::bolt::Value>> match_rows;
+  for (const auto &row : stream.GetResults()) {
+    ASSERT_EQ(row.size(), 7U);
+    if (row[0].ValueString().starts_with("MATCH")) match_rows.push_back(row);
+  }
+  std::vector<std::string> expected_operators{"* Produce {n}", "* ScanAll (n)", "* Once"};
+  ASSERT_EQ(match_rows.size(), expected_operators.size());
+  for (size_t i = 0; i < match_rows.size(); ++i) {
+    EXPECT_EQ(match_rows[i][1].ValueInt(), 3);
+    EXPECT_EQ(match_rows[i][2].ValueInt(), 2);
+    EXPECT_EQ(match_rows[i][3].ValueString(), expected_operators[i]);
+  }
+  // Produce is pulled once for the created node and once when exhausted.
+  EXPECT_EQ(match_rows[0][4].ValueInt(), 2);
+}
+
+TYPED_TEST(InterpreterTest, SlowQueryLog) {
+  const auto log_file = this->data_directory / "slow_queries.log";
+  {
+    memgraph::query::SlowQueryLog slow_query_log{log_file, std::chrono::microseconds(0), 1024 * 1024, 1};
+    this->interpreter_context.slow_query_log = &slow_query_log;
+    memgraph::utils::OnScopeExit reset_log{[this] { this->interpreter_context.slow_query_log = nullptr; }};
+    this->Interpret("CREATE (:Node);");
+    this->Interpret("MATCH (n:Node) RETURN n;");
+    ASSERT_THROW(this->Interpret("UNWIND [1, 0] AS x RETURN 1 / x;"), memgraph::query::QueryRuntimeException);
+  }
+
+  std::ifstream log{log_file};
+  std::vector<nlohmann::json> entries;
+  for (std::string line; std::getline(log, line);) {
+    entries.push_back(nlohmann::json::parse(line));
+  }
+  ASSERT_EQ(entries.size(), 3U);
+  const auto &match = entries[1];
+  EXPECT_TRUE(match["error"].is_null());
+  EXPECT_NE(match["query"].get<std::string>().find("MATCH (n:Node)"), std::string::npos);
+  EXPECT_EQ(match["results"], 1);
+  EXPECT_TRUE(match["parsing_time"].is_number());
+  EXPECT_TRUE(match["planning_time"].is_number());
+  EXPECT_TRUE(match["execution_time"].is_number());
+  EXPECT_NE(match["plan"].get<std::string>().find("Produce"), std::string::npos);
+
+  // Failed queries are logged with their error
+  const auto &failed = entries[2];
+  EXPECT_NE(failed["query"].get<std::string>().find("UNWIND"), std::string::npos);
+  EXPECT_TRUE(failed["error"].is_string());
+}
+
 TYPED_TEST(InterpreterTest, ProfileQueryWithLiterals) {
   EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 0U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 0U);
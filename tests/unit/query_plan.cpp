@@ -308,7 +308,8 @@ TYPED_TEST(TestPlanner, MatchMultiPatternWithHashJoin) {
                    RETURN("a", "b", "c", "d")));
 
   std::list<BaseOpChecker *> left_indexed_join_ops{new ExpectScanAll(), new ExpectFilter(), new ExpectExpand()};
-  std::list<BaseOpChecker *> right_indexed_join_ops{new ExpectScanAll(), new ExpectFilter(), new ExpectExpand()};
+  std::list<BaseOpChecker *> right_indexed_join_ops{new ExpectScanAll(), new ExpectFilter(), new ExpectJoinKeyFilter(),
+                                                     new ExpectExpand()};
 
   auto symbol_table = memgraph::query::MakeSymbolTable(query);
   auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
@@ -333,7 +334,8 @@ TYPED_TEST(TestPlanner, MatchMultiPatternWithAsymmetricHashJoin) {
       RETURN("a", "b", "c", "d")));
 
   std::list<BaseOpChecker *> left_indexed_join_ops{new ExpectScanAll(), new ExpectFilter(), new ExpectExpand()};
-  std::list<BaseOpChecker *> right_indexed_join_ops{new ExpectScanAll(), new ExpectFilter(), new ExpectExpand()};
+  std::list<BaseOpChecker *> right_indexed_join_ops{new ExpectScanAll(), new ExpectFilter(), new ExpectJoinKeyFilter(),
+                                                     new ExpectExpand()};
 
   auto symbol_table = memgraph::query::MakeSymbolTable(query);
   auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
@@ -392,6 +394,18 @@ TYPED_TEST(TestPlanner, MatchMultiPatternSameExpandStart) {
                        ExpectEdgeUniquenessFilter(), ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, MatchTriangle) {
+  // Test MATCH (a) -[r]-> (b) -[s]-> (c) -[t]-> (a) RETURN a
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("a"), EDGE("r", Direction::OUT), NODE("b"),
+                                                 EDGE("s", Direction::OUT), NODE("c"), EDGE("t", Direction::OUT),
+                                                 NODE("a"))),
+                                   RETURN("a")));
+  // The expansion closing the cycle is merged with the one binding (c), and
+  // the uniqueness filter between them ends up above.
+  CheckPlan<TypeParam>(query, this->storage, ExpectScanAll(), ExpectExpand(), ExpectIntersectExpand(),
+                       ExpectEdgeUniquenessFilter(), ExpectEdgeUniquenessFilter(), ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, MultiMatch) {
   // Test MATCH (n) -[r]- (m) MATCH (j) -[e]- (i) -[f]- (h) RETURN n
   FakeDbAccessor dba;
@@ -1629,6 +1643,28 @@ TYPED_TEST(TestPlanner, BestPropertyIndexed) {
             ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, HashPropertyIndexedEquality) {
+  // Test MATCH (n :label) WHERE n.property = 1 AND n.hashed = 42 RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto property = dba.Property("property");
+  // The hash index is preferred for an equality unless the other index is
+  // at least 10x smaller.
+  dba.SetIndexCount(label, property, 5);
+  auto hashed = PROPERTY_PAIR(dba, "hashed");
+  dba.SetIndexCount(label, hashed.second, 8);
+  dba.SetHashIndex(label, hashed.second);
+  auto lit_42 = LITERAL(42);
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n", "label"))),
+      WHERE(AND(EQ(PROPERTY_LOOKUP(dba, "n", property), LITERAL(1)), EQ(PROPERTY_LOOKUP(dba, "n", hashed), lit_42))),
+      RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabelPropertyValue(label, hashed, lit_42), ExpectFilter(),
+            ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, MultiPropertyIndexScan) {
   // Test MATCH (n :label1), (m :label2) WHERE n.prop1 = 1 AND m.prop2 = 2
   //      RETURN n, m
@@ -12,6 +12,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <climits>
+#include <set>
 #include <utility>
 
 #include "query/frontend/ast/ast.hpp"
@@ -74,6 +75,7 @@ class PlanChecker : public virtual HierarchicalLogicalOperatorVisitor {
   PRE_VISIT(ScanAllByEdgeId);
   PRE_VISIT(ScanAllById);
   PRE_VISIT(Expand);
+  PRE_VISIT(IntersectExpand);
   PRE_VISIT(ExpandVariable);
   PRE_VISIT(ConstructNamedPath);
   PRE_VISIT(EmptyResult);
@@ -84,6 +86,7 @@ class PlanChecker : public virtual HierarchicalLogicalOperatorVisitor {
   PRE_VISIT(RemoveProperty);
   PRE_VISIT(RemoveLabels);
   PRE_VISIT(EdgeUniquenessFilter);
+  PRE_VISIT(JoinKeyFilter);
   PRE_VISIT(Accumulate);
   PRE_VISIT(Aggregate);
   PRE_VISIT(Skip);
@@ -196,6 +199,7 @@ using ExpectScanAllByEdgeType = OpChecker<ScanAllByEdgeType>;
 using ExpectScanAllByEdgeId = OpChecker<ScanAllByEdgeId>;
 using ExpectScanAllById = OpChecker<ScanAllById>;
 using ExpectExpand = OpChecker<Expand>;
+using ExpectIntersectExpand = OpChecker<IntersectExpand>;
 using ExpectConstructNamedPath = OpChecker<ConstructNamedPath>;
 using ExpectProduce = OpChecker<Produce>;
 using ExpectEmptyResult = OpChecker<EmptyResult>;
@@ -205,6 +209,7 @@ using ExpectSetLabels = OpChecker<SetLabels>;
 using ExpectRemoveProperty = OpChecker<RemoveProperty>;
 using ExpectRemoveLabels = OpChecker<RemoveLabels>;
 using ExpectEdgeUniquenessFilter = OpChecker<EdgeUniquenessFilter>;
+using ExpectJoinKeyFilter = OpChecker<JoinKeyFilter>;
 using ExpectSkip = OpChecker<Skip>;
 using ExpectLimit = OpChecker<Limit>;
 using ExpectOrderBy = OpChecker<OrderBy>;
@@ -729,6 +734,10 @@ class FakeDbAccessor {
     return false;
   }
 
+  bool LabelPropertyHashIndexExists(memgraph::storage::LabelId label, memgraph::storage::PropertyId property) const {
+    return label_property_hash_index_.contains({label, property});
+  }
+
   bool EdgeTypeIndexExists(memgraph::storage::EdgeTypeId edge_type) const {
     return edge_type_index_.find(edge_type) != edge_type_index_.end();
   }
@@ -764,6 +773,10 @@ class FakeDbAccessor {
     label_property_index_.emplace_back(label, property, count);
   }
 
+  void SetHashIndex(memgraph::storage::LabelId label, memgraph::storage::PropertyId property) {
+    label_property_hash_index_.emplace(label, property);
+  }
+
   void SetIndexCount(memgraph::storage::EdgeTypeId edge_type, int64_t count) { edge_type_index_[edge_type] = count; }
 
   void SetIndexCount(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property, int64_t count) {
@@ -822,6 +835,7 @@ class FakeDbAccessor {
 
   std::unordered_map<memgraph::storage::LabelId, int64_t> label_index_;
   std::vector<std::tuple<memgraph::storage::LabelId, memgraph::storage::PropertyId, int64_t>> label_property_index_;
+  std::set<std::pair<memgraph::storage::LabelId, memgraph::storage::PropertyId>> label_property_hash_index_;
   std::unordered_map<memgraph::storage::EdgeTypeId, int64_t> edge_type_index_;
   std::vector<std::tuple<memgraph::storage::EdgeTypeId, memgraph::storage::PropertyId, int64_t>>
       edge_type_property_index_;
@@ -487,6 +487,74 @@ TYPED_TEST(QueryPlan, CartesianThreeWay) {
   }
 }
 
+TYPED_TEST(QueryPlan, HashJoinWithJoinKeyFilter) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto left_prop = PROPERTY_PAIR(dba, "left");
+  auto right_prop = PROPERTY_PAIR(dba, "right");
+  auto add_vertex = [&dba](memgraph::storage::PropertyId property, std::optional<int> value) {
+    auto vertex = dba.InsertVertex();
+    if (value) MG_ASSERT(vertex.SetProperty(property, memgraph::storage::PropertyValue(*value)).HasValue());
+    return vertex;
+  };
+
+  // Left keys are 1 and 2, right keys are 2, 3 and 2; every vertex without
+  // the property has a null key
+  std::vector<memgraph::query::VertexAccessor> vertices{
+      add_vertex(left_prop.second, 1),  add_vertex(left_prop.second, 2),  add_vertex(right_prop.second, 2),
+      add_vertex(right_prop.second, 3), add_vertex(right_prop.second, 2), add_vertex(right_prop.second, std::nullopt)};
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto m = MakeScanAll(this->storage, symbol_table, "m");
+  auto *left_key = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), left_prop);
+  auto *right_key = PROPERTY_LOOKUP(dba, IDENT("m")->MapTo(m.sym_), right_prop);
+  auto return_n = NEXPR("n", IDENT("n")->MapTo(n.sym_))->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+  auto return_m = NEXPR("m", IDENT("m")->MapTo(m.sym_))->MapTo(symbol_table.CreateSymbol("named_expression_2", true));
+  auto key_filter = std::make_shared<JoinKeyFilter>(m.op_, m.sym_, right_key);
+
+  auto collect_vertices = [](const std::vector<std::vector<TypedValue>> &results) {
+    std::vector<std::vector<memgraph::query::VertexAccessor>> rows;
+    for (const auto &row : results) {
+      auto &row_vertices = rows.emplace_back();
+      for (const auto &value : row) row_vertices.push_back(value.ValueVertex());
+    }
+    return rows;
+  };
+
+  {
+    // Rows are passed through until the join publishes its keys
+    auto produce = MakeProduce(key_filter, return_m);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    EXPECT_EQ(PullAll(*produce, &context), 6);
+  }
+  {
+    // Null keys and keys which aren't in the filter are dropped
+    memgraph::utils::BloomFilter left_keys(2);
+    left_keys.Insert(TypedValue::Hash{}(TypedValue(1)));
+    left_keys.Insert(TypedValue::Hash{}(TypedValue(2)));
+    auto produce = MakeProduce(key_filter, return_m);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    context.join_key_filters[right_key] = &left_keys;
+    auto results = collect_vertices(CollectProduce(*produce, &context));
+    EXPECT_EQ(results, (std::vector<std::vector<memgraph::query::VertexAccessor>>{{vertices[2]}, {vertices[4]}}));
+  }
+
+  // The filter doesn't change the result of the join
+  auto join = [&](std::shared_ptr<LogicalOperator> right_op) {
+    auto hash_join = std::make_shared<HashJoin>(n.op_, std::vector<Symbol>{n.sym_}, right_op,
+                                                std::vector<Symbol>{m.sym_}, EQ(left_key, right_key));
+    auto produce = MakeProduce(hash_join, return_n, return_m);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    return collect_vertices(CollectProduce(*produce, &context));
+  };
+  const auto expected =
+      std::vector<std::vector<memgraph::query::VertexAccessor>>{{vertices[1], vertices[2]}, {vertices[1], vertices[4]}};
+  EXPECT_EQ(join(m.op_), expected);
+  EXPECT_EQ(join(key_filter), expected);
+}
+
 template <typename StorageType>
 class ExpandFixture : public testing::Test {
  protected:
@@ -1122,6 +1190,59 @@ TYPED_TEST(QueryPlanExpandVariable, EdgeUniquenessTwoVariableExpansions) {
   EXPECT_EQ(test_expand(0, EdgeAtom::Direction::OUT, 2, 2, true), (map_int{{2, 5 * 8}}));
 }
 
+TYPED_TEST(QueryPlanExpandVariable, EdgeUniquenessLongPaths) {
+  // Paths around the ring get long enough for edge-uniqueness to be checked
+  // through a set of edges instead of scanning the path
+  constexpr int kRingSize = 20;
+  this->labels.push_back(this->dba.NameToLabel("ring"));
+  const int layer = static_cast<int>(this->labels.size()) - 1;
+  const auto edge_type = this->dba.NameToEdgeType("ring_edge");
+  std::vector<memgraph::query::VertexAccessor> ring;
+  for (int i = 0; i < kRingSize; ++i) {
+    ring.push_back(this->dba.InsertVertex());
+    ASSERT_TRUE(ring.back().AddLabel(this->labels.back()).HasValue());
+  }
+  for (int i = 0; i < kRingSize; ++i) {
+    ASSERT_TRUE(this->dba.InsertEdge(&ring[i], &ring[(i + 1) % kRingSize], edge_type).HasValue());
+  }
+  this->dba.AdvanceCommand();
+
+  auto test_expand = [&](EdgeAtom::Direction direction, bool reverse) {
+    auto e = this->Edge("r", direction);
+    return this->GetEdgeListSizes(
+        this->template AddMatch<ExpandVariable>(nullptr, "n", layer, direction, {edge_type}, this->nullopt,
+                                                this->nullopt, e, "m", memgraph::storage::View::OLD, reverse),
+        e);
+  };
+
+  map_int out_paths;
+  map_int both_paths;
+  for (int length = 1; length <= kRingSize; ++length) {
+    out_paths[length] = kRingSize;
+    both_paths[length] = 2 * kRingSize;
+  }
+  for (int reverse = 0; reverse < 2; ++reverse) {
+    EXPECT_EQ(test_expand(EdgeAtom::Direction::OUT, reverse), out_paths);
+    EXPECT_EQ(test_expand(EdgeAtom::Direction::BOTH, reverse), both_paths);
+  }
+
+  auto test_filter = [&](size_t length) {
+    auto e0 = this->Edge("r0", EdgeAtom::Direction::OUT);
+    auto last_op = this->template AddMatch<Expand>(nullptr, "n0", layer, EdgeAtom::Direction::OUT, {edge_type},
+                                                   this->nullopt, this->nullopt, e0, "m0",
+                                                   memgraph::storage::View::OLD);
+    auto e1 = this->Edge("r1", EdgeAtom::Direction::OUT);
+    last_op = this->template AddMatch<ExpandVariable>(last_op, "n1", layer, EdgeAtom::Direction::OUT, {edge_type},
+                                                      length, length, e1, "m1", memgraph::storage::View::OLD);
+    last_op = std::make_shared<EdgeUniquenessFilter>(last_op, e1, std::vector<Symbol>{e0});
+    return this->GetEdgeListSizes(last_op, e1);
+  };
+
+  // Only the edge into the start of the path is left out of it
+  EXPECT_EQ(test_filter(kRingSize - 1), (map_int{{kRingSize - 1, kRingSize}}));
+  EXPECT_EQ(test_filter(kRingSize), (map_int{}));
+}
+
 #ifdef MG_ENTERPRISE
 TYPED_TEST(QueryPlanExpandVariable, FineGrainedEdgeUniquenessTwoVariableExpansions) {
   auto test_expand = [&](int layer, EdgeAtom::Direction direction, std::optional<size_t> lower,
@@ -2135,6 +2256,34 @@ TYPED_TEST(QueryPlanExpandWeightedShortestPath, NegativeUpperBound) {
   EXPECT_THROW(this->ExpandWShortest(EdgeAtom::Direction::BOTH, -1, LITERAL(true)), QueryRuntimeException);
 }
 
+TYPED_TEST(QueryPlanExpandWeightedShortestPath, MixedNumericWeights) {
+  // Integer weights are compared with the double ones: [0]-[2]-[5] costs 3.0 + 1, [0]-[5] costs 5
+  auto new_vertex = this->dba.InsertVertex();
+  ASSERT_TRUE(new_vertex.SetProperty(this->prop.second, memgraph::storage::PropertyValue(5)).HasValue());
+  auto short_edge = this->dba.InsertEdge(&this->v[2], &new_vertex, this->edge_type);
+  ASSERT_TRUE(short_edge.HasValue());
+  ASSERT_TRUE(short_edge->SetProperty(this->prop.second, memgraph::storage::PropertyValue(1)).HasValue());
+  auto long_edge = this->dba.InsertEdge(&this->v[0], &new_vertex, this->edge_type);
+  ASSERT_TRUE(long_edge.HasValue());
+  ASSERT_TRUE(long_edge->SetProperty(this->prop.second, memgraph::storage::PropertyValue(5)).HasValue());
+  this->dba.AdvanceCommand();
+
+  auto results = this->ExpandWShortest(EdgeAtom::Direction::OUT, 1000, LITERAL(true));
+  ASSERT_EQ(results.size(), 5);
+  EXPECT_EQ(this->GetProp(results[0].vertex), 2);
+  EXPECT_EQ(results[0].total_weight, 3);
+  EXPECT_EQ(this->GetProp(results[1].vertex), 5);
+  EXPECT_EQ(results[1].total_weight, 4);
+  ASSERT_EQ(results[1].path.size(), 2);
+  EXPECT_EQ(this->GetProp(results[1].path[1]), 1);
+  EXPECT_EQ(this->GetProp(results[2].vertex), 1);
+  EXPECT_EQ(results[2].total_weight, 5);
+  EXPECT_EQ(this->GetProp(results[3].vertex), 3);
+  EXPECT_EQ(results[3].total_weight, 6);
+  EXPECT_EQ(this->GetProp(results[4].vertex), 4);
+  EXPECT_EQ(results[4].total_weight, 9);
+}
+
 #if MG_ENTERPRISE
 TYPED_TEST(QueryPlanExpandWeightedShortestPath, FineGrainedFiltering) {
   // All edge_types and labels allowed
@@ -2892,6 +3041,58 @@ TYPED_TEST(QueryPlan, ExpandBothCycleEdgeCase) {
   EXPECT_EQ(1, PullAll(*r_.op_, &context));
 }
 
+TYPED_TEST(QueryPlan, IntersectExpand) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  // make a cycle (v0)->(v1)->(v2)->(v0) with a parallel edge (v2)->(v0), and
+  // an edge (v1)->(v3) to a node with a loop, which only closes cycles of loops
+  std::vector<memgraph::query::VertexAccessor> vertices;
+  for (int i = 0; i < 4; ++i) vertices.push_back(dba.InsertVertex());
+  auto edge_type = dba.NameToEdgeType("Edge");
+  for (auto [from, to] : std::vector<std::pair<int, int>>{{0, 1}, {1, 2}, {2, 0}, {2, 0}, {1, 3}, {3, 3}}) {
+    ASSERT_TRUE(dba.InsertEdge(&vertices[from], &vertices[to], edge_type).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+
+  // MATCH (a)-[r]-(b)-[s]-(c)-[t]-(a), closing the cycle with an Expand to the
+  // existing node and with an IntersectExpand
+  auto count_cycles = [&](EdgeAtom::Direction first, EdgeAtom::Direction second, EdgeAtom::Direction third) {
+    auto a = MakeScanAll(this->storage, symbol_table, "a");
+    auto r_b = MakeExpand(this->storage, symbol_table, a.op_, a.sym_, "r", first, {}, "b", false,
+                          memgraph::storage::View::OLD);
+    auto s_c = MakeExpand(this->storage, symbol_table, r_b.op_, r_b.node_sym_, "s", second, {}, "c", false,
+                          memgraph::storage::View::OLD);
+    auto t_sym = symbol_table.CreateSymbol("t", true);
+    auto t_a = std::make_shared<Expand>(s_c.op_, s_c.node_sym_, a.sym_, t_sym, third,
+                                        std::vector<memgraph::storage::EdgeTypeId>{}, true,
+                                        memgraph::storage::View::OLD);
+    // The closing expansion is done from (a)
+    auto reversed = third;
+    if (third != EdgeAtom::Direction::BOTH) {
+      reversed = third == EdgeAtom::Direction::IN ? EdgeAtom::Direction::OUT : EdgeAtom::Direction::IN;
+    }
+    auto intersect = std::make_shared<IntersectExpand>(
+        r_b.op_, r_b.node_sym_, ExpandCommon{s_c.node_sym_, s_c.edge_sym_, second, {}, false}, a.sym_,
+        ExpandCommon{s_c.node_sym_, t_sym, reversed, {}, true}, memgraph::storage::View::OLD);
+
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    auto expected = PullAll(*t_a, &context);
+    EXPECT_EQ(PullAll(*intersect, &context), expected);
+    return expected;
+  };
+
+  EXPECT_EQ(count_cycles(EdgeAtom::Direction::OUT, EdgeAtom::Direction::OUT, EdgeAtom::Direction::OUT), 7);
+  const auto directions = {EdgeAtom::Direction::IN, EdgeAtom::Direction::OUT, EdgeAtom::Direction::BOTH};
+  for (auto first : directions) {
+    for (auto second : directions) {
+      for (auto third : directions) count_cycles(first, second, third);
+    }
+  }
+}
+
 TYPED_TEST(QueryPlan, EdgeFilter) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
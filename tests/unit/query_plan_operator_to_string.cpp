@@ -172,6 +172,24 @@ TYPED_TEST(OperatorToStringTest, Expand) {
   EXPECT_EQ(last_op->ToString(), expected_string);
 }
 
+TYPED_TEST(OperatorToStringTest, IntersectExpand) {
+  auto node1_sym = this->GetSymbol("node1");
+  auto node2_sym = this->GetSymbol("node2");
+  std::shared_ptr<LogicalOperator> last_op = std::make_shared<ScanAll>(nullptr, node1_sym);
+  last_op = std::make_shared<IntersectExpand>(
+      last_op, node1_sym,
+      ExpandCommon{node2_sym, this->GetSymbol("edge1"), EdgeAtom::Direction::OUT,
+                   std::vector<memgraph::storage::EdgeTypeId>{this->dba.NameToEdgeType("EdgeType1")}, false},
+      this->GetSymbol("node3"),
+      ExpandCommon{node2_sym, this->GetSymbol("edge2"), EdgeAtom::Direction::OUT,
+                   std::vector<memgraph::storage::EdgeTypeId>{this->dba.NameToEdgeType("EdgeType2")}, true},
+      memgraph::storage::View::OLD);
+  last_op->dba_ = &this->dba;
+
+  std::string expected_string{"IntersectExpand (node1)-[edge1:EdgeType1]->(node2)<-[edge2:EdgeType2]-(node3)"};
+  EXPECT_EQ(last_op->ToString(), expected_string);
+}
+
 TYPED_TEST(OperatorToStringTest, ExpandVariable) {
   auto node1_sym = this->GetSymbol("node1");
   std::shared_ptr<LogicalOperator> last_op = std::make_shared<ScanAll>(nullptr, node1_sym);
@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <iterator>
 #include <list>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -32,6 +33,7 @@
 #include "storage_test_utils.hpp"
 #include "test_utils.hpp"
 #include "utils/memory.hpp"
+#include "utils/on_scope_exit.hpp"
 #include "utils/variant_helpers.hpp"
 
 using memgraph::replication_coordination_glue::ReplicationRole;
@@ -302,6 +304,121 @@ TYPED_TEST(MgpGraphTest, VerticesIterator) {
   }
 }
 
+TYPED_TEST(MgpGraphTest, VerticesIteratorNextBatch) {
+  constexpr auto kVertexCount = 5;
+  std::vector<memgraph::storage::Gid> vertex_ids;
+  {
+    auto accessor = this->CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    const auto label = accessor.NameToLabel("Label");
+    const auto property = accessor.NameToProperty("score");
+    for (auto i = 0; i < kVertexCount; ++i) {
+      auto vertex = accessor.InsertVertex();
+      vertex_ids.push_back(vertex.Gid());
+      if (i % 2 == 0) {
+        ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+        ASSERT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue(i)).HasValue());
+      }
+    }
+    ASSERT_FALSE(accessor.Commit().HasError());
+  }
+  mgp_graph graph = this->CreateGraph(memgraph::storage::View::OLD);
+  MgpVerticesIteratorPtr vertices_iter{
+      EXPECT_MGP_NO_ERROR(mgp_vertices_iterator *, mgp_graph_iter_vertices, &graph, &this->memory)};
+  ASSERT_NE(vertices_iter, nullptr);
+
+  constexpr size_t kCapacity = 2;
+  std::array<int64_t, kCapacity> ids{};
+  std::array<int, kCapacity> has_labels{};
+  std::array<double, kCapacity> property_values{};
+  std::array<int, kCapacity> property_present{};
+  const char *label_names[] = {"Label"};
+  const char *property_names[] = {"score"};
+  mgp_vertex_batch batch{.capacity = kCapacity,
+                         .ids = ids.data(),
+                         .labels_count = 1,
+                         .label_names = label_names,
+                         .has_labels = has_labels.data(),
+                         .properties_count = 1,
+                         .property_names = property_names,
+                         .property_values = property_values.data(),
+                         .property_present = property_present.data()};
+
+  std::vector<int64_t> read_ids;
+  for (auto count = EXPECT_MGP_NO_ERROR(size_t, mgp_vertices_iterator_next_batch, vertices_iter.get(), &batch);
+       count != 0; count = EXPECT_MGP_NO_ERROR(size_t, mgp_vertices_iterator_next_batch, vertices_iter.get(), &batch)) {
+    ASSERT_LE(count, kCapacity);
+    for (size_t i = 0; i < count; ++i) {
+      const auto index = read_ids.size();
+      read_ids.push_back(ids[i]);
+      EXPECT_EQ(has_labels[i] != 0, index % 2 == 0);
+      EXPECT_EQ(property_present[i] != 0, index % 2 == 0);
+      if (property_present[i] != 0) {
+        EXPECT_DOUBLE_EQ(property_values[i], static_cast<double>(index));
+      }
+    }
+  }
+  ASSERT_EQ(read_ids.size(), kVertexCount);
+  for (size_t i = 0; i < vertex_ids.size(); ++i) {
+    EXPECT_EQ(read_ids[i], vertex_ids[i].AsInt());
+  }
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(mgp_vertex *, mgp_vertices_iterator_get, vertices_iter.get()), nullptr);
+
+  batch.capacity = 0;
+  size_t count{0};
+  EXPECT_EQ(mgp_vertices_iterator_next_batch(vertices_iter.get(), &batch, &count),
+            mgp_error::MGP_ERROR_INVALID_ARGUMENT);
+}
+
+TYPED_TEST(MgpGraphTest, ExportCsr) {
+  std::array<memgraph::storage::Gid, 3> vertex_ids{};
+  {
+    auto accessor = this->CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    for (auto &vertex_id : vertex_ids) {
+      vertex_id = accessor.InsertVertex().Gid();
+    }
+    auto first = accessor.FindVertex(vertex_ids[0], memgraph::storage::View::NEW);
+    auto second = accessor.FindVertex(vertex_ids[1], memgraph::storage::View::NEW);
+    auto third = accessor.FindVertex(vertex_ids[2], memgraph::storage::View::NEW);
+    const auto edge_type = accessor.NameToEdgeType("EDGE");
+    auto weighted = accessor.InsertEdge(&first.value(), &second.value(), edge_type);
+    ASSERT_TRUE(weighted.HasValue());
+    ASSERT_TRUE(
+        weighted->SetProperty(accessor.NameToProperty("weight"), memgraph::storage::PropertyValue(2.5)).HasValue());
+    ASSERT_TRUE(accessor.InsertEdge(&first.value(), &third.value(), edge_type).HasValue());
+    ASSERT_TRUE(accessor.InsertEdge(&third.value(), &second.value(), edge_type).HasValue());
+    ASSERT_FALSE(accessor.Commit().HasError());
+  }
+  mgp_graph graph = this->CreateGraph(memgraph::storage::View::OLD);
+  auto *csr = EXPECT_MGP_NO_ERROR(mgp_graph_csr *, mgp_graph_export_csr, &graph, "weight", &this->memory);
+  ASSERT_NE(csr, nullptr);
+  memgraph::utils::OnScopeExit destroy_csr([csr] { mgp_graph_csr_destroy(csr); });
+
+  ASSERT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_graph_csr_vertex_count, csr), 3);
+  ASSERT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_graph_csr_edge_count, csr), 3);
+  const auto *ids = EXPECT_MGP_NO_ERROR(const int64_t *, mgp_graph_csr_vertex_ids, csr);
+  const auto *offsets = EXPECT_MGP_NO_ERROR(const size_t *, mgp_graph_csr_offsets, csr);
+  const auto *targets = EXPECT_MGP_NO_ERROR(const size_t *, mgp_graph_csr_targets, csr);
+  const auto *weights = EXPECT_MGP_NO_ERROR(const double *, mgp_graph_csr_weights, csr);
+  ASSERT_NE(weights, nullptr);
+
+  std::map<std::pair<int64_t, int64_t>, double> edges;
+  for (size_t i = 0; i < 3; ++i) {
+    for (auto e = offsets[i]; e < offsets[i + 1]; ++e) {
+      edges.emplace(std::make_pair(ids[i], ids[targets[e]]), weights[e]);
+    }
+  }
+  const std::map<std::pair<int64_t, int64_t>, double> expected{
+      {{vertex_ids[0].AsInt(), vertex_ids[1].AsInt()}, 2.5},
+      {{vertex_ids[0].AsInt(), vertex_ids[2].AsInt()}, 1.0},
+      {{vertex_ids[2].AsInt(), vertex_ids[1].AsInt()}, 1.0}};
+  EXPECT_EQ(edges, expected);
+
+  auto *unweighted = EXPECT_MGP_NO_ERROR(mgp_graph_csr *, mgp_graph_export_csr, &graph, nullptr, &this->memory);
+  ASSERT_NE(unweighted, nullptr);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(const double *, mgp_graph_csr_weights, unweighted), nullptr);
+  mgp_graph_csr_destroy(unweighted);
+}
+
 TYPED_TEST(MgpGraphTest, VertexIsMutable) {
   auto graph = this->CreateGraph(memgraph::storage::View::NEW);
   MgpVertexPtr vertex{EXPECT_MGP_NO_ERROR(mgp_vertex *, mgp_graph_create_vertex, &graph, &this->memory)};
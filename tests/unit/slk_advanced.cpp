@@ -11,6 +11,10 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
 #include "coordination/coordinator_communication_config.hpp"
 #include "coordination/coordinator_slk.hpp"
 #include "io/network/endpoint.hpp"
@@ -18,6 +22,7 @@
 #include "replication_coordination_glue/mode.hpp"
 #include "slk_common.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/replication/serialization.hpp"
 #include "storage/v2/replication/slk.hpp"
 #include "storage/v2/temporal.hpp"
 #include "utils/temporal.hpp"
@@ -166,3 +171,126 @@ TEST(SlkAdvanced, ReplicationClientConfigs) {
 
   ASSERT_EQ(original, decoded);
 }
+
+namespace {
+class SlkFiles : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    Clear();
+    std::filesystem::create_directories(source_);
+    std::filesystem::create_directories(staging_);
+    std::filesystem::create_directories(destination_);
+    // Larger than the file buffer so the data is sent in several pieces
+    data_.resize(300 * 1024);
+    for (size_t i = 0; i < data_.size(); ++i) data_[i] = static_cast<char>(i * 7 + i / 13);
+    std::ofstream{file_, std::ios::binary}.write(data_.data(), static_cast<std::streamsize>(data_.size()));
+  }
+
+  void TearDown() override { Clear(); }
+
+  void Clear() {
+    if (std::filesystem::exists(root_)) std::filesystem::remove_all(root_);
+  }
+
+  static std::string Contents(const std::filesystem::path &path) {
+    std::ifstream in{path, std::ios::binary};
+    return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+  }
+
+  uint64_t SendChunk(uint64_t offset, uint64_t size) {
+    memgraph::slk::Loopback loopback;
+    memgraph::storage::replication::Encoder encoder(loopback.GetBuilder());
+    encoder.WriteFileChunk(file_, offset, size);
+    memgraph::storage::replication::Decoder decoder(loopback.GetReader());
+    return decoder.ReadFileChunk(staged_, offset, size);
+  }
+
+  std::filesystem::path root_{std::filesystem::temp_directory_path() / "MG_tests_unit_slk_advanced_files"};
+  std::filesystem::path source_{root_ / "source"};
+  std::filesystem::path staging_{root_ / "staging"};
+  std::filesystem::path destination_{root_ / "destination"};
+  std::filesystem::path file_{source_ / "snapshot"};
+  std::filesystem::path staged_{memgraph::storage::replication::StagedFilePath(staging_, "snapshot")};
+  std::string data_;
+};
+}  // namespace
+
+TEST_F(SlkFiles, InlineFile) {
+  memgraph::slk::Loopback loopback;
+  memgraph::storage::replication::Encoder encoder(loopback.GetBuilder());
+  encoder.WriteFile(file_);
+
+  memgraph::storage::replication::Decoder decoder(loopback.GetReader());
+  const auto path = decoder.ReadFile(destination_);
+  ASSERT_TRUE(path);
+  ASSERT_EQ(*path, destination_ / "snapshot");
+  ASSERT_EQ(Contents(*path), data_);
+}
+
+TEST_F(SlkFiles, StagedFileResumes) {
+  const uint64_t chunk = 100 * 1024;
+  ASSERT_EQ(SendChunk(0, chunk), chunk);
+
+  // A chunk which doesn't continue the staged file is dropped
+  ASSERT_EQ(SendChunk(2 * chunk, chunk), chunk);
+  ASSERT_EQ(SendChunk(0, chunk), chunk);
+
+  // Resume where the replica stopped
+  ASSERT_EQ(SendChunk(chunk, chunk), 2 * chunk);
+  ASSERT_EQ(SendChunk(2 * chunk, data_.size() - 2 * chunk), data_.size());
+
+  memgraph::slk::Loopback loopback;
+  memgraph::storage::replication::Encoder encoder(loopback.GetBuilder());
+  encoder.WriteStagedFile(file_);
+  memgraph::storage::replication::Decoder decoder(loopback.GetReader(), staging_);
+  const auto path = decoder.ReadFile(destination_);
+  ASSERT_TRUE(path);
+  ASSERT_EQ(Contents(*path), data_);
+  ASSERT_FALSE(std::filesystem::exists(staged_));
+}
+
+TEST_F(SlkFiles, CorruptedChunkIsDropped) {
+  const uint64_t chunk = 100 * 1024;
+  ASSERT_EQ(SendChunk(0, chunk), chunk);
+
+  {
+    memgraph::slk::Loopback loopback;
+    memgraph::storage::replication::Encoder encoder(loopback.GetBuilder());
+    encoder.WriteBuffer(reinterpret_cast<const uint8_t *>(data_.data()) + chunk, chunk);
+    encoder.WriteUint(0);  // Wrong checksum
+    memgraph::storage::replication::Decoder decoder(loopback.GetReader());
+    ASSERT_EQ(decoder.ReadFileChunk(staged_, chunk, chunk), chunk);
+  }
+  ASSERT_EQ(std::filesystem::file_size(staged_), chunk);
+
+  ASSERT_EQ(SendChunk(chunk, data_.size() - chunk), data_.size());
+  ASSERT_EQ(Contents(staged_), data_);
+}
+
+TEST_F(SlkFiles, IncompleteStagedFile) {
+  ASSERT_EQ(SendChunk(0, 1024), 1024);
+
+  memgraph::slk::Loopback loopback;
+  memgraph::storage::replication::Encoder encoder(loopback.GetBuilder());
+  encoder.WriteStagedFile(file_);
+  memgraph::storage::replication::Decoder decoder(loopback.GetReader(), staging_);
+  ASSERT_FALSE(decoder.ReadFile(destination_));
+}
+
+TEST_F(SlkFiles, SkippedFilesAreReadOut) {
+  ASSERT_EQ(SendChunk(0, 1024), 1024);
+
+  memgraph::slk::Loopback loopback;
+  memgraph::storage::replication::Encoder encoder(loopback.GetBuilder());
+  encoder.WriteStagedFile(file_);
+  encoder.WriteFile(file_);
+  encoder.WriteStagedFile(file_);
+  encoder.WriteUint(42);
+  memgraph::storage::replication::Decoder decoder(loopback.GetReader(), staging_);
+  ASSERT_FALSE(decoder.ReadFile(destination_));
+  // The files following the one that couldn't be received
+  decoder.SkipFile();
+  decoder.SkipFile();
+  ASSERT_EQ(decoder.ReadUint(), 42);
+  ASSERT_FALSE(std::filesystem::exists(destination_ / "snapshot"));
+}
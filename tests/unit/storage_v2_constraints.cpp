@@ -11,9 +11,13 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <atomic>
 #include <filesystem>
+#include <set>
+#include <thread>
 #include <type_traits>
 #include <variant>
+#include <vector>
 
 #include "dbms/database.hpp"
 #include "storage/v2/constraints/constraints.hpp"
@@ -1264,6 +1268,51 @@ TYPED_TEST(ConstraintsTest, UniqueConstraintsClearOldData) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(ConstraintsTest, UniqueConstraintsConcurrentCommits) {
+  // Vertices are validated before the commit takes the engine lock, commits
+  // of the same value from other transactions in the meantime still have to
+  // be caught.
+
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    {
+      auto unique_acc = this->db_acc_->get()->UniqueAccess();
+      auto res = unique_acc->CreateUniqueConstraint(this->label1, {this->prop1});
+      ASSERT_TRUE(res.HasValue());
+      ASSERT_EQ(res.GetValue(), UniqueConstraints::CreationStatus::SUCCESS);
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+
+    constexpr int kThreads = 8;
+    constexpr int kValues = 200;
+    std::atomic<int> committed{0};
+    {
+      std::vector<std::jthread> threads;
+      for (int i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&] {
+          for (int value = 0; value < kValues; ++value) {
+            auto acc = this->storage->Access();
+            auto vertex = acc->CreateVertex();
+            if (vertex.AddLabel(this->label1).HasError() ||
+                vertex.SetProperty(this->prop1, PropertyValue(value)).HasError()) {
+              continue;
+            }
+            if (!acc->Commit().HasError()) ++committed;
+          }
+        });
+      }
+    }
+    EXPECT_EQ(committed, kValues);
+
+    auto acc = this->storage->Access();
+    std::set<int64_t> values;
+    for (auto vertex : acc->Vertices(View::OLD)) {
+      values.insert(vertex.GetProperty(this->prop1, View::OLD)->ValueInt());
+    }
+    EXPECT_EQ(values.size(), static_cast<size_t>(kValues));
+  }
+}
+
 TYPED_TEST(ConstraintsTest, TypeConstraints) {
   if (std::is_same_v<TypeParam, memgraph::storage::DiskStorage>) {
     GTEST_SKIP() << "Type constraints not implemented for on-disk";
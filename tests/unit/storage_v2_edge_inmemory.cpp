@@ -13,6 +13,8 @@
 #include <gtest/gtest.h>
 
 #include <limits>
+#include <utility>
+#include <vector>
 
 #include "storage/v2/inmemory/storage.hpp"
 #include "storage/v2/storage.hpp"
@@ -5414,3 +5416,144 @@ TEST(StorageWithProperties, EdgeNonexistentPropertyAPI) {
 
   ASSERT_FALSE(acc->Commit().HasError());
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(StorageEdgeTest, EdgesToDestinationOfHighDegreeVertex) {
+  std::unique_ptr<memgraph::storage::Storage> store(
+      new memgraph::storage::InMemoryStorage({.salient = {.items = {.properties_on_edges = GetParam()}}}));
+  const auto num_neighbours = 3 * memgraph::storage::kSortedAdjacencyMinDegree;
+  memgraph::storage::Gid gid_hub = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  std::vector<memgraph::storage::Gid> gid_neighbours;
+  const auto et1 = store->NameToEdgeType("et1");
+  const auto et2 = store->NameToEdgeType("et2");
+
+  // The hub has edges of both types to every third neighbour and of one type
+  // to the others, and an edge from each neighbour
+  {
+    auto acc = store->Access();
+    auto hub = acc->CreateVertex();
+    gid_hub = hub.Gid();
+    for (size_t i = 0; i < num_neighbours; ++i) {
+      auto neighbour = acc->CreateVertex();
+      gid_neighbours.push_back(neighbour.Gid());
+      ASSERT_TRUE(acc->CreateEdge(&hub, &neighbour, et1).HasValue());
+      if (i % 3 == 0) ASSERT_TRUE(acc->CreateEdge(&hub, &neighbour, et2).HasValue());
+      ASSERT_TRUE(acc->CreateEdge(&neighbour, &hub, et1).HasValue());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  auto check_edges = [&](auto *acc, memgraph::storage::View view, auto expected_out) {
+    auto hub = acc->FindVertex(gid_hub, view);
+    ASSERT_TRUE(hub);
+    for (size_t i = 0; i < num_neighbours; ++i) {
+      auto neighbour = acc->FindVertex(gid_neighbours[i], view);
+      ASSERT_TRUE(neighbour);
+      const auto [num_et1, num_et2] = expected_out(i);
+      auto out_edges = hub->OutEdges(view, {}, &*neighbour);
+      ASSERT_TRUE(out_edges.HasValue());
+      ASSERT_EQ(out_edges->edges.size(), num_et1 + num_et2);
+      for (const auto &edge : out_edges->edges) {
+        ASSERT_EQ(edge.ToVertex(), *neighbour);
+      }
+      ASSERT_EQ(hub->OutEdges(view, {et2}, &*neighbour)->edges.size(), num_et2);
+      auto in_edges = hub->InEdges(view, {et1}, &*neighbour);
+      ASSERT_TRUE(in_edges.HasValue());
+      ASSERT_EQ(in_edges->edges.size(), 1);
+      ASSERT_EQ(in_edges->edges[0].FromVertex(), *neighbour);
+    }
+  };
+  auto initial_out = [](size_t i) { return std::pair<size_t, size_t>{1, i % 3 == 0 ? 1 : 0}; };
+  auto changed_out = [](size_t i) { return std::pair<size_t, size_t>{i % 5 == 0 ? 0 : 1, i % 3 == 0 ? 2 : 0}; };
+
+  {
+    auto acc = store->Access();
+    check_edges(acc.get(), memgraph::storage::View::OLD, initial_out);
+  }
+
+  // Delete and add some edges of the hub
+  {
+    auto acc = store->Access();
+    auto hub = acc->FindVertex(gid_hub, memgraph::storage::View::OLD);
+    ASSERT_TRUE(hub);
+    for (size_t i = 0; i < num_neighbours; ++i) {
+      auto neighbour = acc->FindVertex(gid_neighbours[i], memgraph::storage::View::OLD);
+      ASSERT_TRUE(neighbour);
+      if (i % 5 == 0) {
+        auto edges = hub->OutEdges(memgraph::storage::View::OLD, {et1}, &*neighbour)->edges;
+        ASSERT_EQ(edges.size(), 1);
+        ASSERT_TRUE(acc->DeleteEdge(&edges[0]).HasValue());
+      }
+      if (i % 3 == 0) ASSERT_TRUE(acc->CreateEdge(&*hub, &*neighbour, et2).HasValue());
+    }
+    check_edges(acc.get(), memgraph::storage::View::OLD, initial_out);
+    check_edges(acc.get(), memgraph::storage::View::NEW, changed_out);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  {
+    auto acc = store->Access();
+    check_edges(acc.get(), memgraph::storage::View::OLD, changed_out);
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(StorageEdgeTest, EdgesToDestinationWithUnsortedTail) {
+  std::unique_ptr<memgraph::storage::Storage> store(
+      new memgraph::storage::InMemoryStorage({.salient = {.items = {.properties_on_edges = GetParam()}}}));
+  const auto et = store->NameToEdgeType("et");
+  memgraph::storage::Gid gid_hub = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  std::vector<memgraph::storage::Gid> gid_neighbours;
+
+  // Adds an edge from the hub to `count` new neighbours
+  auto add_neighbours = [&](size_t count) {
+    auto acc = store->Access();
+    auto hub = gid_neighbours.empty() ? acc->CreateVertex() : *acc->FindVertex(gid_hub, memgraph::storage::View::OLD);
+    gid_hub = hub.Gid();
+    for (size_t i = 0; i < count; ++i) {
+      auto neighbour = acc->CreateVertex();
+      gid_neighbours.push_back(neighbour.Gid());
+      ASSERT_TRUE(acc->CreateEdge(&hub, &neighbour, et).HasValue());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  };
+  auto unsorted_tail = [&]() {
+    auto acc = store->Access();
+    return acc->FindVertex(gid_hub, memgraph::storage::View::OLD)->vertex_->out_edges_unsorted;
+  };
+  auto check_edges = [&]() {
+    auto acc = store->Access();
+    auto hub = acc->FindVertex(gid_hub, memgraph::storage::View::OLD);
+    ASSERT_TRUE(hub);
+    for (const auto gid : gid_neighbours) {
+      auto neighbour = acc->FindVertex(gid, memgraph::storage::View::OLD);
+      ASSERT_TRUE(neighbour);
+      auto out_edges = hub->OutEdges(memgraph::storage::View::OLD, {}, &*neighbour);
+      ASSERT_TRUE(out_edges.HasValue());
+      ASSERT_EQ(out_edges->edges.size(), 1);
+      ASSERT_EQ(out_edges->edges[0].ToVertex(), *neighbour);
+    }
+  };
+
+  // Commits don't sort, the GC does
+  add_neighbours(2 * memgraph::storage::kSortedAdjacencyMinDegree);
+  ASSERT_EQ(unsorted_tail(), memgraph::storage::kAdjacencyUnsorted);
+  check_edges();
+  store->FreeMemory();
+  ASSERT_EQ(unsorted_tail(), 0);
+  check_edges();
+
+  // A short tail is left for the lookups to scan
+  add_neighbours(memgraph::storage::kAdjacencyMaxUnsortedTail);
+  store->FreeMemory();
+  ASSERT_EQ(unsorted_tail(), memgraph::storage::kAdjacencyMaxUnsortedTail);
+  check_edges();
+
+  // A longer one is merged
+  add_neighbours(1);
+  ASSERT_EQ(unsorted_tail(), memgraph::storage::kAdjacencyMaxUnsortedTail + 1);
+  check_edges();
+  store->FreeMemory();
+  ASSERT_EQ(unsorted_tail(), 0);
+  check_edges();
+}
@@ -0,0 +1,199 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "storage/v2/graph_projection.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/storage.hpp"
+
+using memgraph::storage::GraphProjection;
+using memgraph::storage::GraphProjectionCache;
+using memgraph::storage::GraphProjectionSpec;
+using memgraph::storage::View;
+
+class GraphProjectionTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto acc = storage_->Access();
+    label_ = acc->NameToLabel("Account");
+    edge_type_ = acc->NameToEdgeType("TRANSFER");
+    weight_ = acc->NameToProperty("amount");
+    auto first = acc->CreateVertex();
+    auto second = acc->CreateVertex();
+    auto unlabeled = acc->CreateVertex();
+    ASSERT_TRUE(first.AddLabel(label_).HasValue());
+    ASSERT_TRUE(second.AddLabel(label_).HasValue());
+    auto edge = acc->CreateEdge(&first, &second, edge_type_);
+    ASSERT_TRUE(edge.HasValue());
+    ASSERT_TRUE(edge->SetProperty(weight_, memgraph::storage::PropertyValue(3)).HasValue());
+    ASSERT_TRUE(acc->CreateEdge(&second, &unlabeled, edge_type_).HasValue());
+    ASSERT_TRUE(acc->CreateEdge(&first, &second, acc->NameToEdgeType("OTHER")).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  std::unique_ptr<memgraph::storage::Storage> storage_{new memgraph::storage::InMemoryStorage(
+      {.salient = {.items = {.properties_on_edges = true}}})};
+  memgraph::storage::LabelId label_;
+  memgraph::storage::EdgeTypeId edge_type_;
+  memgraph::storage::PropertyId weight_;
+};
+
+TEST_F(GraphProjectionTest, BuildsFilteredProjection) {
+  auto acc = storage_->Access();
+  const auto projection = acc->Projection({.labels = {label_}, .edge_types = {edge_type_}, .weight_property = weight_},
+                                          View::OLD);
+  ASSERT_EQ(projection->VertexCount(), 2);
+  ASSERT_EQ(projection->EdgeCount(), 1);
+  EXPECT_THAT(projection->offsets, ::testing::ElementsAre(0, 1, 1));
+  EXPECT_THAT(projection->targets, ::testing::ElementsAre(1));
+  EXPECT_THAT(projection->weights, ::testing::ElementsAre(3.0));
+  EXPECT_THAT(projection->edge_types, ::testing::ElementsAre(edge_type_));
+
+  const auto full = acc->Projection({}, View::OLD);
+  EXPECT_EQ(full->VertexCount(), 3);
+  EXPECT_EQ(full->EdgeCount(), 3);
+  EXPECT_TRUE(full->weights.empty());
+}
+
+TEST_F(GraphProjectionTest, ReusesProjectionUntilCommit) {
+  const GraphProjectionSpec spec{.labels = {label_}};
+  std::shared_ptr<const GraphProjection> first;
+  {
+    auto acc = storage_->Access();
+    first = acc->Projection(spec, View::OLD);
+  }
+  {
+    auto acc = storage_->Access();
+    EXPECT_EQ(acc->Projection(spec, View::OLD), first);
+    // A transaction with its own changes doesn't use the cache.
+    auto vertex = acc->CreateVertex();
+    ASSERT_TRUE(vertex.AddLabel(label_).HasValue());
+    const auto own = acc->Projection(spec, View::NEW);
+    EXPECT_NE(own, first);
+    EXPECT_EQ(own->VertexCount(), 3);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage_->Access();
+    const auto after_commit = acc->Projection(spec, View::OLD);
+    EXPECT_NE(after_commit, first);
+    EXPECT_EQ(after_commit->VertexCount(), 3);
+  }
+}
+
+TEST(GraphProjectionCacheTest, EvictsLeastRecentlyUsed) {
+  GraphProjectionCache cache(2);
+  size_t builds = 0;
+  auto build = [&builds] {
+    ++builds;
+    return GraphProjection{};
+  };
+  const GraphProjectionSpec spec{};
+  const auto at_one = cache.GetOrBuild(spec, 1, build);
+  EXPECT_EQ(cache.GetOrBuild(spec, 1, build), at_one);
+  EXPECT_EQ(builds, 1);
+
+  // A newer timestamp replaces the older projection of the same spec.
+  cache.GetOrBuild(spec, 2, build);
+  EXPECT_EQ(cache.Size(), 1);
+
+  const GraphProjectionSpec other{.edge_types = {memgraph::storage::EdgeTypeId::FromUint(0)}};
+  const GraphProjectionSpec another{.edge_types = {memgraph::storage::EdgeTypeId::FromUint(1)}};
+  cache.GetOrBuild(other, 2, build);
+  cache.GetOrBuild(another, 2, build);
+  EXPECT_EQ(cache.Size(), 2);
+  EXPECT_EQ(builds, 4);
+
+  cache.Clear();
+  EXPECT_EQ(cache.Size(), 0);
+}
+
+TEST(GraphProjectionCacheTest, EvictsOverTheByteLimit) {
+  auto projection_of = [](size_t vertex_count) {
+    return [vertex_count] {
+      GraphProjection projection;
+      projection.vertex_ids.resize(vertex_count);
+      return projection;
+    };
+  };
+  GraphProjectionCache cache(4, 100 * sizeof(int64_t));
+  const GraphProjectionSpec spec{};
+  const GraphProjectionSpec other{.edge_types = {memgraph::storage::EdgeTypeId::FromUint(0)}};
+
+  cache.GetOrBuild(spec, 1, projection_of(60));
+  EXPECT_EQ(cache.MemoryUsage(), 60 * sizeof(int64_t));
+  // Both don't fit, the least recently used one goes
+  cache.GetOrBuild(other, 1, projection_of(60));
+  EXPECT_EQ(cache.Size(), 1);
+  EXPECT_EQ(cache.MemoryUsage(), 60 * sizeof(int64_t));
+
+  // Projections over the limit aren't cached at all
+  const auto huge = cache.GetOrBuild(spec, 2, projection_of(200));
+  EXPECT_EQ(huge->VertexCount(), 200);
+  EXPECT_EQ(cache.Size(), 1);
+
+  cache.Clear();
+  EXPECT_EQ(cache.MemoryUsage(), 0);
+}
+
+TEST_F(GraphProjectionTest, PeriodicCommitRefreshesTheProjection) {
+  const GraphProjectionSpec spec{.labels = {label_}};
+  auto acc = storage_->Access();
+  const auto before = acc->Projection(spec, View::OLD);
+  auto vertex = acc->CreateVertex();
+  ASSERT_TRUE(vertex.AddLabel(label_).HasValue());
+  ASSERT_FALSE(acc->PeriodicCommit().HasError());
+
+  // The new transaction sees the periodically committed vertex
+  const auto after = acc->Projection(spec, View::OLD);
+  EXPECT_NE(after, before);
+  EXPECT_EQ(after->VertexCount(), 3);
+  ASSERT_FALSE(acc->Commit().HasError());
+}
+
+TEST_F(GraphProjectionTest, AnalyticalWritesInvalidateProjections) {
+  auto *mem_storage = static_cast<memgraph::storage::InMemoryStorage *>(storage_.get());
+  const GraphProjectionSpec spec{.labels = {label_}};
+  std::shared_ptr<const GraphProjection> transactional;
+  {
+    auto acc = storage_->Access();
+    transactional = acc->Projection(spec, View::OLD);
+    EXPECT_EQ(transactional->VertexCount(), 2);
+  }
+
+  mem_storage->SetStorageMode(memgraph::storage::StorageMode::IN_MEMORY_ANALYTICAL);
+  {
+    auto acc = storage_->Access();
+    EXPECT_EQ(acc->Projection(spec, View::OLD)->VertexCount(), 2);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage_->Access();
+    auto vertex = acc->CreateVertex();
+    ASSERT_TRUE(vertex.AddLabel(label_).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage_->Access();
+    EXPECT_EQ(acc->Projection(spec, View::OLD)->VertexCount(), 3);
+  }
+
+  // The last durable timestamp is still the one of the cached projection
+  mem_storage->SetStorageMode(memgraph::storage::StorageMode::IN_MEMORY_TRANSACTIONAL);
+  {
+    auto acc = storage_->Access();
+    const auto projection = acc->Projection(spec, View::OLD);
+    EXPECT_NE(projection, transactional);
+    EXPECT_EQ(projection->VertexCount(), 3);
+  }
+}
@@ -28,6 +28,7 @@ using namespace memgraph::storage;
 using testing::IsEmpty;
 using testing::Types;
 using testing::UnorderedElementsAre;
+using testing::UnorderedElementsAreArray;
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define ASSERT_NO_ERROR(result) ASSERT_FALSE((result).HasError())
@@ -1326,6 +1327,144 @@ TYPED_TEST(IndexTest, LabelPropertyIndexRemoveAndAddIndexedLabel) {
   }
 }
 
+TYPED_TEST(IndexTest, LabelPropertyHashIndexEquality) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    {
+      auto unique_acc = this->storage->UniqueAccess();
+      EXPECT_FALSE(unique_acc->CreateHashIndex(this->label1, this->prop_val).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+    {
+      auto unique_acc = this->storage->UniqueAccess();
+      EXPECT_TRUE(unique_acc->CreateHashIndex(this->label1, this->prop_val).HasError());
+      EXPECT_TRUE(unique_acc->LabelPropertyIndexExists(this->label1, this->prop_val));
+      EXPECT_TRUE(unique_acc->LabelPropertyHashIndexExists(this->label1, this->prop_val));
+      EXPECT_THAT(unique_acc->ListAllIndices().label_property_hash,
+                  UnorderedElementsAre(std::make_pair(this->label1, this->prop_val)));
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+
+    {
+      auto acc = this->storage->Access();
+      for (int i = 0; i < 10; ++i) {
+        auto vertex = this->CreateVertex(acc.get());
+        ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+        ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, i % 2 ? PropertyValue(i / 2) : PropertyValue(i / 2.0)));
+      }
+      EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, this->prop_val, PropertyValue(2), View::OLD), View::OLD),
+                  IsEmpty());
+      EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, this->prop_val, PropertyValue(2), View::NEW), View::NEW),
+                  UnorderedElementsAre(4, 5));
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+
+    {
+      // Integers and doubles with the same value are found by the same lookup.
+      auto acc = this->storage->Access();
+      for (int i = 0; i < 5; ++i) {
+        EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, this->prop_val, PropertyValue(i), View::OLD)),
+                    UnorderedElementsAre(2 * i, 2 * i + 1));
+        EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, this->prop_val, PropertyValue(i + 0.0), View::OLD)),
+                    UnorderedElementsAre(2 * i, 2 * i + 1));
+        EXPECT_EQ(acc->ApproximateVertexCount(this->label1, this->prop_val, PropertyValue(i)), 2);
+      }
+      EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, this->prop_val, PropertyValue(7), View::OLD)), IsEmpty());
+      // Range lookups keep using the skip list.
+      EXPECT_THAT(
+          this->GetIds(acc->Vertices(this->label1, this->prop_val, memgraph::utils::MakeBoundInclusive(PropertyValue(1)),
+                                     memgraph::utils::MakeBoundExclusive(PropertyValue(3)), View::OLD)),
+          UnorderedElementsAre(2, 3, 4, 5));
+    }
+
+    {
+      // Aborted changes must not be visible through the hash lookup.
+      auto acc = this->storage->Access();
+      for (auto vertex : acc->Vertices(View::OLD)) {
+        ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(100)));
+      }
+      EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, this->prop_val, PropertyValue(100), View::NEW), View::NEW),
+                  UnorderedElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+      acc->Abort();
+    }
+    this->storage->FreeMemory({}, false);
+
+    {
+      auto acc = this->storage->Access();
+      EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, this->prop_val, PropertyValue(100), View::OLD)), IsEmpty());
+      EXPECT_EQ(acc->ApproximateVertexCount(this->label1, this->prop_val, PropertyValue(100)), 0);
+      for (auto vertex : acc->Vertices(View::OLD)) {
+        ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(50)));
+      }
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+    this->storage->FreeMemory({}, false);
+
+    {
+      // Old values are dropped from the hash lookup once GC removes them from the index.
+      auto acc = this->storage->Access();
+      EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, this->prop_val, PropertyValue(50), View::OLD)),
+                  UnorderedElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+      EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, this->prop_val, PropertyValue(0), View::OLD)), IsEmpty());
+      EXPECT_EQ(acc->ApproximateVertexCount(this->label1, this->prop_val, PropertyValue(0)), 0);
+    }
+
+    {
+      auto unique_acc = this->storage->UniqueAccess();
+      EXPECT_FALSE(unique_acc->DropIndex(this->label1, this->prop_val).HasError());
+      EXPECT_FALSE(unique_acc->LabelPropertyHashIndexExists(this->label1, this->prop_val));
+      EXPECT_THAT(unique_acc->ListAllIndices().label_property_hash, IsEmpty());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+  }
+}
+
+TYPED_TEST(IndexTest, LabelPropertyHashIndexLargeBucket) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    {
+      auto unique_acc = this->storage->UniqueAccess();
+      EXPECT_FALSE(unique_acc->CreateHashIndex(this->label1, this->prop_val).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+
+    // Enough vertices with the same value to turn the bucket into a skip list
+    constexpr int kVertices = 200;
+    std::vector<int64_t> all_ids;
+    std::vector<int64_t> even_ids;
+    {
+      auto acc = this->storage->Access();
+      for (int i = 0; i < kVertices; ++i) {
+        auto vertex = this->CreateVertex(acc.get());
+        ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+        ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(1)));
+        all_ids.push_back(i);
+        if (i % 2 == 0) even_ids.push_back(i);
+      }
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+
+    {
+      auto acc = this->storage->Access();
+      EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, this->prop_val, PropertyValue(1), View::OLD)),
+                  UnorderedElementsAreArray(all_ids));
+      EXPECT_EQ(acc->ApproximateVertexCount(this->label1, this->prop_val, PropertyValue(1)), kVertices);
+      for (auto vertex : acc->Vertices(View::OLD)) {
+        if (vertex.GetProperty(this->prop_id, View::OLD)->ValueInt() % 2 == 0) continue;
+        ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(2)));
+      }
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+    this->storage->FreeMemory({}, false);
+
+    {
+      auto acc = this->storage->Access();
+      EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, this->prop_val, PropertyValue(1), View::OLD)),
+                  UnorderedElementsAreArray(even_ids));
+      EXPECT_EQ(acc->ApproximateVertexCount(this->label1, this->prop_val, PropertyValue(1)), kVertices / 2);
+      EXPECT_EQ(acc->ApproximateVertexCount(this->label1, this->prop_val, PropertyValue(2)), kVertices / 2);
+    }
+  }
+}
+
 TYPED_TEST(IndexTest, LabelPropertyIndexClearOldDataFromDisk) {
   if constexpr ((std::is_same_v<TypeParam, memgraph::storage::DiskStorage>)) {
     auto *disk_label_property_index =
@@ -0,0 +1,248 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <set>
+#include <vector>
+
+#include "storage/v2/indices/point_index.hpp"
+#include "storage/v2/indices/point_index_expensive_header.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/vertex.hpp"
+
+using memgraph::storage::CoordinateReferenceSystem;
+using memgraph::storage::Gid;
+using memgraph::storage::IndexPointCartesian2d;
+using memgraph::storage::Point2d;
+using memgraph::storage::PropertyValue;
+using memgraph::storage::Vertex;
+using testing::UnorderedElementsAre;
+
+using Index = memgraph::storage::LayeredIndex<IndexPointCartesian2d>;
+using Entry = memgraph::storage::Entry<IndexPointCartesian2d>;
+
+class LayeredPointIndexTest : public ::testing::Test {
+ protected:
+  Vertex const *NewVertex() { return &vertices_.emplace_back(Gid::FromUint(vertices_.size()), nullptr); }
+
+  static IndexPointCartesian2d At(double x, double y) {
+    return IndexPointCartesian2d{Point2d{CoordinateReferenceSystem::Cartesian_2d, x, y}};
+  }
+
+  // Vertices with an entry inside of the box [min, max] x [min, max]
+  static std::vector<Vertex const *> Lookup(Index const &index, double min, double max) {
+    using point_type = IndexPointCartesian2d::point_type;
+    auto const region = bgi::covered_by(bg::model::box<point_type>{point_type{min, min}, point_type{max, max}});
+    auto it = memgraph::storage::LayeredQueryIterator<IndexPointCartesian2d>{
+        index.base->qbegin(region), index.base->qend(), index.delta->qbegin(region), index.masked.get()};
+    auto const end = memgraph::storage::LayeredQueryIterator<IndexPointCartesian2d>{
+        index.base->qend(), index.base->qend(), index.delta->qend(), index.masked.get()};
+    auto result = std::vector<Vertex const *>{};
+    for (; it != end; ++it) result.push_back(it->vertex());
+    return result;
+  }
+
+  // Base with one vertex at (i, i) for each i in [0, n)
+  Index BulkLoad(size_t n) {
+    auto entries = std::vector<Entry>{};
+    for (size_t i = 0; i < n; ++i) {
+      entries.emplace_back(At(static_cast<double>(i), static_cast<double>(i)), NewVertex());
+    }
+    return Index::BulkLoad(entries);
+  }
+
+  std::deque<Vertex> vertices_;
+};
+
+TEST_F(LayeredPointIndexTest, BulkLoad) {
+  const auto index = BulkLoad(10);
+  EXPECT_EQ(index.EntryCount(), 10);
+  EXPECT_EQ(index.base->size(), 10);
+  EXPECT_TRUE(index.delta->empty());
+  EXPECT_THAT(Lookup(index, 0, 2), UnorderedElementsAre(&vertices_[0], &vertices_[1], &vertices_[2]));
+  EXPECT_TRUE(Lookup(index, 20, 30).empty());
+}
+
+TEST_F(LayeredPointIndexTest, LookupsCoverBaseAndDelta) {
+  const auto index = BulkLoad(10);
+  auto const *added = NewVertex();
+  // Moved away, removed from the index and added
+  const auto updated = index.Update({&vertices_[1], &vertices_[2], added},
+                                    {{&vertices_[1], At(100, 100)}, {added, At(3.5, 3.5)}});
+
+  EXPECT_EQ(updated.base, index.base);
+  EXPECT_EQ(updated.delta->size(), 2);
+  EXPECT_EQ(updated.masked->size(), 2);
+  EXPECT_EQ(updated.EntryCount(), 10);
+  EXPECT_THAT(Lookup(updated, 0, 4), UnorderedElementsAre(&vertices_[0], &vertices_[3], &vertices_[4], added));
+  EXPECT_THAT(Lookup(updated, 99, 101), UnorderedElementsAre(&vertices_[1]));
+
+  // Changing a vertex of the delta again replaces its entry
+  const auto again = updated.Update({added}, {{added, At(50, 50)}});
+  EXPECT_EQ(again.EntryCount(), 10);
+  EXPECT_THAT(Lookup(again, 0, 4), UnorderedElementsAre(&vertices_[0], &vertices_[3], &vertices_[4]));
+  EXPECT_THAT(Lookup(again, 49, 51), UnorderedElementsAre(added));
+
+  // Older versions are unaffected
+  EXPECT_EQ(index.EntryCount(), 10);
+  EXPECT_THAT(Lookup(index, 0, 2), UnorderedElementsAre(&vertices_[0], &vertices_[1], &vertices_[2]));
+}
+
+TEST_F(LayeredPointIndexTest, OnlyEntriesOfBaseAreMasked) {
+  const auto index = BulkLoad(1);
+  // None of these vertices has an entry in this index, e.g. because they lost
+  // their point or changed the coordinate reference system
+  const auto unrelated = index.Update({NewVertex(), NewVertex(), NewVertex()}, {});
+  EXPECT_TRUE(unrelated.masked->empty());
+  EXPECT_EQ(unrelated.EntryCount(), 1);
+
+  // Removing the only entry must not be skipped as a change of an empty index
+  const auto removed = unrelated.Update({&vertices_[0]}, {});
+  EXPECT_EQ(removed.EntryCount(), 0);
+  EXPECT_TRUE(Lookup(removed, 0, 10).empty());
+}
+
+TEST_F(LayeredPointIndexTest, ChangesOfOtherIndicesKeepTheLayers) {
+  const auto index = BulkLoad(2);
+  const auto updated = index.Update({&vertices_[0]}, {{&vertices_[0], At(10, 10)}});
+  // The vertex now has a point of another coordinate reference system
+  const auto unrelated = updated.Update({NewVertex()}, {});
+  EXPECT_EQ(unrelated.delta, updated.delta);
+  EXPECT_EQ(unrelated.masked, updated.masked);
+}
+
+TEST_F(LayeredPointIndexTest, CommitsOnlyGrowTheDelta) {
+  const auto index = BulkLoad(10);
+  auto changed_vertices = Index::masked_t{&vertices_[0]};
+  auto changed_values = Index::changed_values_t{};
+  for (size_t i = 0; i <= Index::MaxDeltaSize(index.base->size()); ++i) {
+    auto const *vertex = NewVertex();
+    changed_vertices.insert(vertex);
+    changed_values.emplace(vertex, At(1000, 1000));
+  }
+  const auto updated = index.Update(changed_vertices, changed_values);
+  EXPECT_EQ(updated.base, index.base);
+  EXPECT_TRUE(updated.NeedsMerge());
+
+  const auto merged = updated.Merge();
+  EXPECT_NE(merged.base, index.base);
+  EXPECT_TRUE(merged.delta->empty());
+  EXPECT_TRUE(merged.masked->empty());
+  EXPECT_FALSE(merged.NeedsMerge());
+  EXPECT_EQ(merged.EntryCount(), 9 + changed_values.size());
+  EXPECT_EQ(merged.base->size(), merged.EntryCount());
+  EXPECT_THAT(Lookup(merged, 0, 1), UnorderedElementsAre(&vertices_[1]));
+  EXPECT_EQ(Lookup(merged, 999, 1001).size(), changed_values.size());
+
+  // The merged base masks its own entries again
+  const auto removed = merged.Update({&vertices_[1]}, {});
+  EXPECT_EQ(removed.EntryCount(), merged.EntryCount() - 1);
+  EXPECT_TRUE(Lookup(removed, 0, 1).empty());
+}
+
+TEST_F(LayeredPointIndexTest, RebasesCommitsOntoTheMergedIndex) {
+  const auto index = BulkLoad(10);
+  auto const *added = NewVertex();
+  const auto updated = index.Update({&vertices_[0], &vertices_[1], added},
+                                    {{&vertices_[0], At(100, 100)}, {added, At(200, 200)}});
+  const auto merged = updated.Merge();
+
+  // Committed while the layers were being merged
+  const auto later = updated.Update({&vertices_[0], &vertices_[2]}, {{&vertices_[2], At(300, 300)}});
+  const auto rebased = later.Rebase(updated, merged);
+  EXPECT_EQ(rebased.base, merged.base);
+  EXPECT_EQ(rebased.delta->size(), 1);
+  EXPECT_EQ(rebased.masked->size(), 2);
+  EXPECT_EQ(rebased.EntryCount(), later.EntryCount());
+  EXPECT_THAT(Lookup(rebased, 0, 1000), UnorderedElementsAre(&vertices_[2], &vertices_[3], &vertices_[4],
+                                                             &vertices_[5], &vertices_[6], &vertices_[7],
+                                                             &vertices_[8], &vertices_[9], added));
+
+  // Without commits in the meantime the merged index is taken as it is
+  EXPECT_EQ(updated.Rebase(updated, merged).base, merged.base);
+  EXPECT_TRUE(updated.Rebase(updated, merged).delta->empty());
+  // An index merged by someone else stays as it is
+  EXPECT_EQ(rebased.Rebase(updated, merged).delta, rebased.delta);
+}
+
+TEST(PointIndexStorageTest, CountsAndLookupsAfterCommits) {
+  std::unique_ptr<memgraph::storage::Storage> storage{new memgraph::storage::InMemoryStorage()};
+  const auto label = storage->NameToLabel("Place");
+  const auto property = storage->NameToProperty("location");
+  const auto cartesian = [](double x, double y) {
+    return PropertyValue{Point2d{CoordinateReferenceSystem::Cartesian_2d, x, y}};
+  };
+
+  std::vector<Gid> gids;
+  {
+    auto acc = storage->Access();
+    for (int i = 0; i < 3; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+      ASSERT_TRUE(vertex.SetProperty(property, cartesian(i, i)).HasValue());
+      gids.push_back(vertex.Gid());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    // Existing vertices are bulk loaded
+    auto unique_acc = storage->UniqueAccess();
+    ASSERT_FALSE(unique_acc->CreatePointIndex(label, property).HasError());
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+
+  auto inside = [&](memgraph::storage::Storage::Accessor &acc) {
+    std::set<Gid> result;
+    for (auto vertex : acc.PointVertices(label, property, CoordinateReferenceSystem::Cartesian_2d, cartesian(0, 0),
+                                         PropertyValue{100.0}, memgraph::storage::PointDistanceCondition::INSIDE)) {
+      result.insert(vertex.Gid());
+    }
+    return result;
+  };
+  {
+    auto acc = storage->Access();
+    EXPECT_EQ(acc->ApproximateVerticesPointCount(label, property), 3);
+    EXPECT_EQ(inside(*acc), (std::set<Gid>{gids[0], gids[1], gids[2]}));
+  }
+
+  {
+    auto acc = storage->Access();
+    auto removed = acc->FindVertex(gids[0], memgraph::storage::View::OLD);
+    auto changed_crs = acc->FindVertex(gids[1], memgraph::storage::View::OLD);
+    ASSERT_TRUE(removed && changed_crs);
+    ASSERT_TRUE(removed->SetProperty(property, PropertyValue{}).HasValue());
+    ASSERT_TRUE(
+        changed_crs->SetProperty(property, PropertyValue{Point2d{CoordinateReferenceSystem::WGS84_2d, 1, 1}})
+            .HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->Access();
+    EXPECT_EQ(acc->ApproximateVerticesPointCount(label, property), 2);
+    EXPECT_EQ(inside(*acc), (std::set<Gid>{gids[2]}));
+  }
+
+  {
+    auto acc = storage->Access();
+    auto last = acc->FindVertex(gids[2], memgraph::storage::View::OLD);
+    ASSERT_TRUE(last);
+    ASSERT_TRUE(last->SetProperty(property, PropertyValue{}).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->Access();
+    EXPECT_EQ(acc->ApproximateVerticesPointCount(label, property), 1);
+    EXPECT_TRUE(inside(*acc).empty());
+  }
+}
@@ -0,0 +1,87 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "storage/v2/durability/exceptions.hpp"
+#include "storage/v2/inmemory/replication/streamed_snapshot_load.hpp"
+
+using memgraph::storage::StagedSnapshot;
+using memgraph::storage::StreamedSnapshotLoad;
+using memgraph::storage::durability::RecoveryFailure;
+using memgraph::storage::durability::SnapshotStream;
+
+namespace {
+
+constexpr uint64_t kSize = 100;
+constexpr auto kTimeout = std::chrono::minutes(1);
+
+// Waits for the whole snapshot and stages an empty one
+StreamedSnapshotLoad::LoadFunction WaitForAll(std::atomic<bool> *abandoned) {
+  return [abandoned](const SnapshotStream &stream) -> std::unique_ptr<StagedSnapshot> {
+    try {
+      stream.wait_for(stream.size);
+      return std::make_unique<StagedSnapshot>();
+    } catch (const RecoveryFailure &) {
+      abandoned->store(true);
+      return nullptr;
+    }
+  };
+}
+
+}  // namespace
+
+TEST(StreamedSnapshotLoadTest, FinishesOnceEverythingIsReceived) {
+  std::atomic<bool> abandoned{false};
+  StreamedSnapshotLoad load{"snapshot", "snapshot.tail", kSize, kSize, 10, WaitForAll(&abandoned), kTimeout};
+  EXPECT_EQ(load.Filename(), "snapshot");
+  load.Advance(50);
+  EXPECT_FALSE(load.Failed());
+  load.Advance(kSize);
+  EXPECT_NE(load.Finish(), nullptr);
+  EXPECT_FALSE(abandoned);
+}
+
+TEST(StreamedSnapshotLoadTest, FinishAbandonsAnIncompleteLoad) {
+  std::atomic<bool> abandoned{false};
+  StreamedSnapshotLoad load{"snapshot", "snapshot.tail", kSize, kSize, 10, WaitForAll(&abandoned), kTimeout};
+  EXPECT_EQ(load.Finish(), nullptr);
+  EXPECT_TRUE(abandoned);
+}
+
+TEST(StreamedSnapshotLoadTest, DestroyingAbandonsTheLoad) {
+  std::atomic<bool> abandoned{false};
+  {
+    StreamedSnapshotLoad load{"snapshot", "snapshot.tail", kSize, kSize, 10, WaitForAll(&abandoned), kTimeout};
+    load.Advance(50);
+  }
+  EXPECT_TRUE(abandoned);
+}
+
+TEST(StreamedSnapshotLoadTest, StalledLoadFails) {
+  std::atomic<bool> abandoned{false};
+  StreamedSnapshotLoad load{
+      "snapshot", "snapshot.tail", kSize, kSize, 10, WaitForAll(&abandoned), std::chrono::milliseconds(10)};
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (!load.Failed() && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_TRUE(load.Failed());
+  EXPECT_TRUE(abandoned);
+  // Data arriving too late doesn't bring the load back
+  load.Advance(kSize);
+  EXPECT_EQ(load.Finish(), nullptr);
+}
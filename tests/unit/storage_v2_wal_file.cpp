@@ -48,6 +48,7 @@ memgraph::storage::durability::WalDeltaData::Type StorageMetadataOperationToWalD
     add_case(LABEL_INDEX_STATS_CLEAR);
     add_case(LABEL_PROPERTY_INDEX_CREATE);
     add_case(LABEL_PROPERTY_INDEX_DROP);
+    add_case(LABEL_PROPERTY_HASH_INDEX_CREATE);
     add_case(POINT_INDEX_CREATE);
     add_case(POINT_INDEX_DROP);
     add_case(LABEL_PROPERTY_INDEX_STATS_SET);
@@ -323,6 +324,7 @@ class DeltaGenerator final {
       }
       case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_INDEX_CREATE:
       case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_INDEX_DROP:
+      case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_HASH_INDEX_CREATE:
       case memgraph::storage::durability::StorageMetadataOperation::POINT_INDEX_CREATE:
       case memgraph::storage::durability::StorageMetadataOperation::POINT_INDEX_DROP:
       case memgraph::storage::durability::StorageMetadataOperation::EXISTENCE_CONSTRAINT_CREATE:
@@ -401,6 +403,7 @@ class DeltaGenerator final {
           break;
         case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_INDEX_CREATE:
         case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_INDEX_DROP:
+        case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_HASH_INDEX_CREATE:
         case memgraph::storage::durability::StorageMetadataOperation::POINT_INDEX_CREATE:
         case memgraph::storage::durability::StorageMetadataOperation::POINT_INDEX_DROP:
         case memgraph::storage::durability::StorageMetadataOperation::EXISTENCE_CONSTRAINT_CREATE:
@@ -771,6 +774,7 @@ GENERATE_SIMPLE_TEST(AllGlobalOperations, {
   OPERATION_TX(LABEL_INDEX_STATS_CLEAR, "hello");
   OPERATION_TX(LABEL_PROPERTY_INDEX_CREATE, "hello", {"world"});
   OPERATION_TX(LABEL_PROPERTY_INDEX_DROP, "hello", {"world"});
+  OPERATION_TX(LABEL_PROPERTY_HASH_INDEX_CREATE, "hello", {"world"});
   auto lp_stats = ms::ToJson(ms::LabelPropertyIndexStats{98, 76, 54., 32., 10.});
   OPERATION_TX(LABEL_PROPERTY_INDEX_STATS_SET, "hello", {"world"}, lp_stats);
   OPERATION_TX(LABEL_PROPERTY_INDEX_STATS_CLEAR, "hello");
@@ -0,0 +1,201 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "utils/background_executor.hpp"
+#include "utils/scheduler.hpp"
+
+using memgraph::utils::BackgroundExecutor;
+using memgraph::utils::TaskPriority;
+
+namespace {
+constexpr auto kLongPeriod = std::chrono::hours(1);
+
+template <typename TPred>
+bool WaitFor(TPred pred, std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (!pred()) {
+    if (std::chrono::steady_clock::now() > deadline) return false;
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  return true;
+}
+}  // namespace
+
+TEST(BackgroundExecutor, RunsPeriodically) {
+  BackgroundExecutor executor;
+  executor.Start(2, 1);
+  std::atomic<int> x{0};
+  auto id = executor.Schedule("Test", std::chrono::milliseconds(20), [&x] { ++x; }, {});
+  EXPECT_TRUE(WaitFor([&] { return x >= 5; }));
+  executor.Cancel(id);
+  const int after_cancel = x;
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(x, after_cancel);
+  EXPECT_EQ(executor.TasksNum(), 0);
+}
+
+TEST(BackgroundExecutor, DueTasksRunByPriority) {
+  BackgroundExecutor executor;
+  executor.Start(1, 1);
+  const auto now = std::chrono::system_clock::now();
+
+  // Keep the only worker busy until all tasks are due
+  std::latch started{1};
+  std::latch release{1};
+  executor.Schedule(
+      "Blocker", kLongPeriod,
+      [&] {
+        started.count_down();
+        release.wait();
+      },
+      {}, now);
+  started.wait();
+
+  std::mutex mutex;
+  std::vector<TaskPriority> order;
+  for (auto priority : {TaskPriority::LOW, TaskPriority::NORMAL, TaskPriority::HIGH}) {
+    executor.Schedule(
+        "Test", kLongPeriod,
+        [&, priority] {
+          auto lk = std::unique_lock{mutex};
+          order.push_back(priority);
+        },
+        {.priority = priority}, now);
+  }
+  release.count_down();
+
+  EXPECT_TRUE(WaitFor([&] {
+    auto lk = std::unique_lock{mutex};
+    return order.size() == 3;
+  }));
+  EXPECT_EQ(order, (std::vector{TaskPriority::HIGH, TaskPriority::NORMAL, TaskPriority::LOW}));
+}
+
+TEST(BackgroundExecutor, HighPriorityTasksHaveAReservedWorker) {
+  BackgroundExecutor executor;
+  executor.Start(1, 1);
+  const auto now = std::chrono::system_clock::now();
+
+  // Keep the only shared worker busy
+  std::latch started{1};
+  std::latch release{1};
+  executor.Schedule(
+      "Blocker", kLongPeriod,
+      [&] {
+        started.count_down();
+        release.wait();
+      },
+      {.priority = TaskPriority::LOW}, now);
+  started.wait();
+
+  std::atomic<int> high{0};
+  std::atomic<int> normal{0};
+  executor.Schedule("High", std::chrono::milliseconds(10), [&high] { ++high; }, {.priority = TaskPriority::HIGH}, now);
+  executor.Schedule("Normal", kLongPeriod, [&normal] { ++normal; }, {}, now);
+  EXPECT_TRUE(WaitFor([&] { return high >= 3; }));
+  EXPECT_EQ(normal, 0);
+
+  release.count_down();
+  EXPECT_TRUE(WaitFor([&] { return normal == 1; }));
+}
+
+TEST(BackgroundExecutor, IoHeavyTasksLimit) {
+  BackgroundExecutor executor;
+  executor.Start(4, 1);
+  const auto now = std::chrono::system_clock::now();
+
+  std::atomic<int> running{0};
+  std::atomic<int> max_running{0};
+  std::atomic<int> finished{0};
+  for (int i = 0; i < 4; ++i) {
+    executor.Schedule(
+        "Snapshot", kLongPeriod,
+        [&] {
+          const auto current = ++running;
+          auto max = max_running.load();
+          while (current > max && !max_running.compare_exchange_weak(max, current)) {
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds(20));
+          --running;
+          ++finished;
+        },
+        {.io_heavy = true}, now);
+  }
+  EXPECT_TRUE(WaitFor([&] { return finished == 4; }));
+  EXPECT_EQ(max_running, 1);
+}
+
+TEST(BackgroundExecutor, PauseAndResume) {
+  BackgroundExecutor executor;
+  executor.Start(1, 1);
+  std::atomic<int> x{0};
+  auto id = executor.Schedule("Test", std::chrono::milliseconds(10), [&x] { ++x; }, {});
+  EXPECT_TRUE(WaitFor([&] { return x >= 1; }));
+  executor.Pause(id);
+  // A run might have been in flight while pausing
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  const int paused_at = x;
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(x, paused_at);
+  executor.Resume(id);
+  EXPECT_TRUE(WaitFor([&] { return x > paused_at; }));
+  executor.Cancel(id);
+}
+
+TEST(BackgroundExecutor, CancelWaitsForRunningTask) {
+  BackgroundExecutor executor;
+  executor.Start(1, 1);
+  std::latch started{1};
+  std::atomic<bool> finished{false};
+  auto id = executor.Schedule(
+      "Test", kLongPeriod,
+      [&] {
+        started.count_down();
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        finished = true;
+      },
+      {}, std::chrono::system_clock::now());
+  started.wait();
+  executor.Cancel(id);
+  EXPECT_TRUE(finished);
+}
+
+TEST(BackgroundExecutor, SchedulerRunsOnSharedExecutor) {
+  auto &executor = memgraph::utils::global_background_executor;
+  executor.Start(2, 1);
+  {
+    std::atomic<int> x{0};
+    memgraph::utils::Scheduler scheduler{TaskPriority::HIGH};
+    scheduler.Run("Test", std::chrono::milliseconds(20), [&x] { ++x; });
+    EXPECT_TRUE(scheduler.IsRunning());
+    EXPECT_EQ(executor.TasksNum(), 1);
+    EXPECT_TRUE(WaitFor([&] { return x >= 3; }));
+    scheduler.Stop();
+    EXPECT_FALSE(scheduler.IsRunning());
+    EXPECT_EQ(executor.TasksNum(), 0);
+
+    // Schedulers without a priority keep their own thread
+    memgraph::utils::Scheduler dedicated;
+    dedicated.Run("Test", std::chrono::milliseconds(20), [&x] { ++x; });
+    EXPECT_EQ(executor.TasksNum(), 0);
+    dedicated.Stop();
+  }
+  executor.Shutdown();
+}
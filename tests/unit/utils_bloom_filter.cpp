@@ -0,0 +1,49 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+
+#include "utils/bloom_filter.hpp"
+
+using memgraph::utils::BloomFilter;
+
+TEST(BloomFilter, Empty) {
+  BloomFilter filter;
+  EXPECT_FALSE(filter.MayContain(0));
+  EXPECT_FALSE(filter.MayContain(42));
+}
+
+TEST(BloomFilter, ContainsInserted) {
+  constexpr uint64_t kElements = 10000;
+  BloomFilter filter(kElements);
+  for (uint64_t i = 0; i < kElements; ++i) filter.Insert(i * 3);
+  for (uint64_t i = 0; i < kElements; ++i) EXPECT_TRUE(filter.MayContain(i * 3));
+}
+
+TEST(BloomFilter, FalsePositiveRate) {
+  constexpr uint64_t kElements = 10000;
+  BloomFilter filter(kElements);
+  for (uint64_t i = 0; i < kElements; ++i) filter.Insert(i);
+  uint64_t false_positives = 0;
+  for (uint64_t i = kElements; i < 11 * kElements; ++i) {
+    if (filter.MayContain(i)) ++false_positives;
+  }
+  EXPECT_LT(false_positives, kElements * 10 / 50);
+}
+
+TEST(BloomFilter, Undersized) {
+  // More elements than the filter was sized for only raise the false positives
+  BloomFilter filter(1);
+  for (uint64_t i = 0; i < 100; ++i) filter.Insert(i);
+  for (uint64_t i = 0; i < 100; ++i) EXPECT_TRUE(filter.MayContain(i));
+}
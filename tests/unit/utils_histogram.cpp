@@ -9,10 +9,14 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <thread>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "utils/event_histogram.hpp"
+#include "utils/labeled_histogram.hpp"
 #include "utils/logging.hpp"
 
 TEST(Histogram, BasicFunctionality) {
@@ -45,3 +49,69 @@ TEST(Histogram, BasicFunctionality) {
 
   ASSERT_NEAR(diff, 0, 0.01);
 }
+
+TEST(Histogram, CumulativeCounts) {
+  memgraph::metrics::Histogram histo{};
+
+  for (int i = 0; i < 9000; i++) {
+    histo.Measure(10);
+  }
+  for (int i = 0; i < 900; i++) {
+    histo.Measure(25);
+  }
+  for (int i = 0; i < 99; i++) {
+    histo.Measure(47);
+  }
+  histo.Measure(500);
+
+  ASSERT_THAT(histo.CumulativeCounts({5, 10, 30, 100, 1000}), testing::ElementsAre(0, 9000, 9900, 9999, 10000));
+}
+
+TEST(LabeledHistogram, MergesThreadShards) {
+  memgraph::metrics::LabeledHistogram histo{{10, 100}};
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([&histo] {
+      for (int j = 0; j < 1000; j++) {
+        histo.Measure("memgraph", "r", 10);
+        histo.Measure("memgraph", "w", 50);
+        histo.Measure("other", "r", 1000);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  auto series = histo.Collect();
+  ASSERT_EQ(series.size(), 3);
+  ASSERT_EQ(series[0].first_label, "memgraph");
+  ASSERT_EQ(series[0].second_label, "r");
+  ASSERT_THAT(series[0].cumulative_counts, testing::ElementsAre(4000, 4000, 4000));
+  ASSERT_EQ(series[0].sum, 40000);
+  ASSERT_EQ(series[1].second_label, "w");
+  ASSERT_THAT(series[1].cumulative_counts, testing::ElementsAre(0, 4000, 4000));
+  ASSERT_EQ(series[2].first_label, "other");
+  ASSERT_THAT(series[2].cumulative_counts, testing::ElementsAre(0, 0, 4000));
+  ASSERT_EQ(series[2].sum, 4'000'000);
+}
+
+TEST(LabeledHistogram, CapsSeries) {
+  memgraph::metrics::LabeledHistogram histo{{10}, 2};
+  histo.Measure("a", "r", 1);
+  histo.Measure("b", "r", 1);
+  // Past the cap, measurements are counted together
+  histo.Measure("c", "r", 1);
+  histo.Measure("d", "w", 100);
+  // Admitted series are still counted on their own, also by other threads
+  std::thread{[&histo] { histo.Measure("a", "r", 1); }}.join();
+
+  auto series = histo.Collect();
+  ASSERT_EQ(series.size(), 3);
+  ASSERT_EQ(series[0].first_label, memgraph::metrics::LabeledHistogram::kOverflowLabel);
+  ASSERT_EQ(series[0].second_label, memgraph::metrics::LabeledHistogram::kOverflowLabel);
+  ASSERT_THAT(series[0].cumulative_counts, testing::ElementsAre(1, 2));
+  ASSERT_EQ(series[1].first_label, "a");
+  ASSERT_THAT(series[1].cumulative_counts, testing::ElementsAre(2, 2));
+  ASSERT_EQ(series[2].first_label, "b");
+  ASSERT_THAT(series[2].cumulative_counts, testing::ElementsAre(1, 1));
+}
@@ -0,0 +1,112 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <array>
+#include <cstdint>
+#include <forward_list>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "utils/allocator/page_aligned.hpp"
+#include "utils/allocator/page_pool.hpp"
+#include "utils/allocator/page_slab_memory_resource.hpp"
+
+using memgraph::utils::PagePool;
+
+TEST(PagePool, ReusesReleasedBlocks) {
+  PagePool pool;
+  auto *page = pool.Allocate(PagePool::PAGE_SIZE);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(page) % PagePool::PAGE_SIZE, 0);
+  auto *slab = pool.Allocate(4 * PagePool::PAGE_SIZE);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(slab) % PagePool::PAGE_SIZE, 0);
+
+  pool.Deallocate(page, PagePool::PAGE_SIZE);
+  pool.Deallocate(slab, 4 * PagePool::PAGE_SIZE);
+  EXPECT_EQ(pool.CachedBlocks(PagePool::PAGE_SIZE), 1);
+  EXPECT_EQ(pool.CachedBlocks(4 * PagePool::PAGE_SIZE), 1);
+
+  // Blocks are only reused for allocations of the same size
+  EXPECT_EQ(pool.Allocate(4 * PagePool::PAGE_SIZE), slab);
+  EXPECT_EQ(pool.Allocate(PagePool::PAGE_SIZE), page);
+  EXPECT_EQ(pool.CachedBlocks(PagePool::PAGE_SIZE), 0);
+  pool.Deallocate(page, PagePool::PAGE_SIZE);
+  pool.Deallocate(slab, 4 * PagePool::PAGE_SIZE);
+}
+
+TEST(PagePool, LargeBlocksAreNotCached) {
+  PagePool pool;
+  constexpr auto kSize = (PagePool::kMaxPagesPerBlock + 1) * PagePool::PAGE_SIZE;
+  auto *block = pool.Allocate(kSize);
+  pool.Deallocate(block, kSize);
+  EXPECT_EQ(pool.CachedBlocks(kSize), 0);
+}
+
+TEST(PagePool, CacheIsBounded) {
+  PagePool pool;
+  constexpr auto kSize = PagePool::PAGE_SIZE;
+  constexpr auto kMaxCached = PagePool::kMaxCachedBytesPerSize / kSize;
+  std::vector<void *> blocks;
+  for (size_t i = 0; i < kMaxCached + 10; ++i) {
+    blocks.push_back(pool.Allocate(kSize));
+  }
+  for (auto *block : blocks) {
+    pool.Deallocate(block, kSize);
+  }
+  // The shared list is full, the rest stays in this thread's cache
+  EXPECT_GE(pool.CachedBlocks(kSize), kMaxCached);
+  EXPECT_LE(pool.CachedBlocks(kSize), kMaxCached + PagePool::kThreadCacheBlocks);
+}
+
+TEST(PagePool, ThreadsShareReleasedBlocks) {
+  PagePool pool;
+  constexpr auto kSize = PagePool::PAGE_SIZE;
+  std::vector<void *> released;
+  std::thread{[&] {
+    for (size_t i = 0; i < PagePool::kThreadCacheBlocks + PagePool::kBatchSize; ++i) {
+      released.push_back(pool.Allocate(kSize));
+    }
+    for (auto *block : released) {
+      pool.Deallocate(block, kSize);
+    }
+  }}.join();
+  // The blocks left in the exited thread's cache are freed, a batch of them was handed over to the shared list
+  EXPECT_EQ(pool.CachedBlocks(kSize), PagePool::kBatchSize);
+  auto *block = pool.Allocate(kSize);
+  EXPECT_THAT(released, testing::Contains(block));
+  pool.Deallocate(block, kSize);
+}
+
+TEST(PagePool, SlabPagesAreRecycled) {
+  auto &pool = PagePool::Global();
+  void *first_page = nullptr;
+  {
+    memgraph::utils::PageSlabMemoryResource resource;
+    first_page = resource.allocate(64, 8);
+  }
+  ASSERT_GE(pool.CachedBlocks(PagePool::PAGE_SIZE), 1);
+  {
+    memgraph::utils::PageSlabMemoryResource resource;
+    auto *page = resource.allocate(64, 8);
+    // The recycled page starts with the same header, so the first allocation lands at the same address
+    EXPECT_EQ(page, first_page);
+  }
+
+  using Slab = std::array<std::byte, 4 * PagePool::PAGE_SIZE - sizeof(void *)>;
+  const auto cached_slabs = pool.CachedBlocks(4 * PagePool::PAGE_SIZE);
+  {
+    std::forward_list<Slab, memgraph::utils::PageAlignedAllocator<Slab>> slabs;
+    slabs.emplace_front();
+  }
+  EXPECT_EQ(pool.CachedBlocks(4 * PagePool::PAGE_SIZE), cached_slabs + 1);
+}
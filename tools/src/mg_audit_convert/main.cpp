@@ -0,0 +1,75 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Licensed as a Memgraph Enterprise file under the Memgraph Enterprise
+// License (the "License"); by using this file, you agree to be bound by the terms of the License, and you may not use
+// this file except in compliance with the License. You may obtain a copy of the License at https://memgraph.com/legal.
+//
+//
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+#include <gflags/gflags.h>
+
+#include "audit/record.hpp"
+
+const char *kUsage =
+    "Memgraph audit log converter.\n"
+    "Converts a binary audit log (written with --audit-log-format=binary) to the text audit log format.\n"
+    "Usage: mg_audit_convert --input audit.bin [--output audit.log]\n";
+
+DEFINE_string(input, "", "Path to the binary audit log");
+DEFINE_string(output, "", "Path to the converted text audit log, standard output if empty");
+
+int main(int argc, char **argv) {
+  gflags::SetUsageMessage(kUsage);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  if (FLAGS_input.empty()) {
+    std::cerr << kUsage;
+    return 1;
+  }
+
+  std::ifstream input(FLAGS_input, std::ios::binary);
+  if (!input) {
+    std::cerr << "Couldn't open " << FLAGS_input << std::endl;
+    return 1;
+  }
+  const std::string data{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+
+  std::ofstream output_file;
+  if (!FLAGS_output.empty()) {
+    output_file.open(FLAGS_output, std::ios::trunc);
+    if (!output_file) {
+      std::cerr << "Couldn't open " << FLAGS_output << std::endl;
+      return 1;
+    }
+  }
+  std::ostream &output = FLAGS_output.empty() ? std::cout : output_file;
+
+  std::string_view remaining{data};
+  std::string line;
+  uint64_t converted = 0;
+  while (!remaining.empty()) {
+    const auto size = memgraph::audit::NextRecordSize(remaining);
+    if (!size) {
+      // A crash while writing can leave a partial record at the end of the log.
+      std::cerr << "Ignoring truncated record at the end of " << FLAGS_input << std::endl;
+      break;
+    }
+    auto record = memgraph::audit::DecodeRecord(remaining.substr(0, *size));
+    if (!record) {
+      std::cerr << "Malformed record #" << converted + 1 << " in " << FLAGS_input << std::endl;
+      return 1;
+    }
+    line.clear();
+    memgraph::audit::AppendTextRecord(&line, *record);
+    output << line;
+    remaining.remove_prefix(*size);
+    ++converted;
+  }
+
+  return output ? 0 : 1;
+}